@@ -26,11 +26,13 @@
 #include <lsp-plug.in/dsp-units/sampling/Sample.h>
 #include <lsp-plug.in/dsp-units/3d/rt/types.h>
 #include <lsp-plug.in/dsp-units/3d/rt/context.h>
+#include <lsp-plug.in/dsp-units/3d/rt/queue.h>
 #include <lsp-plug.in/dsp-units/3d/raytrace.h>
+#include <lsp-plug.in/dsp-units/util/Semaphore.h>
 #include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/common/atomic.h>
 #include <lsp-plug.in/common/status.h>
 #include <lsp-plug.in/ipc/Thread.h>
-#include <lsp-plug.in/ipc/Mutex.h>
 #include <lsp-plug.in/lltl/parray.h>
 #include <lsp-plug.in/lltl/darray.h>
 
@@ -70,12 +72,14 @@ namespace lsp
                     dsp::bound_box3d_t              bbox;
                     lltl::darray<rtx::triangle_t>   mesh;
                     lltl::darray<rtx::edge_t>       plan;
+                    lltl::darray<rtx::bvh_node_t>   bvh;            // Bounding volume hierarchy over the mesh
                 } rt_object_t;
 
                 typedef struct stats_t
                 {
                     uint64_t            root_tasks;
                     uint64_t            local_tasks;
+                    uint64_t            stolen_tasks;
                     uint64_t            calls_scan;
                     uint64_t            calls_cull;
                     uint64_t            calls_split;
@@ -91,7 +95,9 @@ namespace lsp
                         RayTrace3D                     *trace;
                         stats_t                         stats;
                         ssize_t                         heavy_state;
-                        lltl::parray<rt::context_t>     tasks;
+                        uint32_t                        seed;           // Seed for random selection of the victim thread
+                        lltl::parray<rt::context_t>     tasks;          // Local tasks that can not be stolen
+                        rt::task_queue_t                queue;          // Tasks that can be stolen by other threads
                         lltl::parray<rt_binding_t>      bindings;       // Bindings
                         lltl::parray<rt_object_t>       objects;
 
@@ -114,9 +120,13 @@ namespace lsp
                         status_t    check_object(rt::context_t *ctx, Object3D *obj, const dsp::matrix3d_t *m);
 
                         status_t    submit_task(rt::context_t *ctx);
+                        rt::context_t  *fetch_root_task(size_t *progress);
+                        rt::context_t  *steal_task();
+                        bool        has_shared_tasks();
+                        void        wait_tasks();
 
                     public:
-                        explicit TaskThread(RayTrace3D *trace);
+                        explicit TaskThread(RayTrace3D *trace, uint32_t seed);
                         virtual ~TaskThread();
 
                     public:
@@ -146,11 +156,15 @@ namespace lsp
                 volatile bool                       bCancelled;
                 volatile bool                       bFailed;
 
-                lltl::parray<rt::context_t>         vTasks;
-                size_t                              nQueueSize;
+                lltl::parray<rt::context_t>         vTasks;             // Root tasks, read-only while processing
+                lltl::parray<TaskThread>            vThreads;           // Threads that participate in processing
+                volatile atomic_t                   nRootTask;          // Index of the next root task to process
+                volatile atomic_t                   nPending;           // Number of submitted but not processed tasks
+                volatile atomic_t                   nProgressLock;      // Lock for reporting progress
+                volatile atomic_t                   nIdle;              // Number of threads waiting for tasks
+                Semaphore                           sIdle;              // Semaphore to wake up threads waiting for tasks
                 size_t                              nProgressPoints;
                 size_t                              nProgressMax;
-                ipc::Mutex                          lkTasks;
 
             protected:
                 static void destroy_tasks(lltl::parray<rt::context_t> *tasks);
@@ -165,6 +179,7 @@ namespace lsp
                 status_t    resize_materials(size_t objects);
 
                 status_t    report_progress(float progress);
+                status_t    update_progress(size_t points);
 
                 // Main ray-tracing routines
                 void        normalize_output();
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_UNITS_3D_RT_BVH_H_
+#define LSP_PLUG_IN_DSP_UNITS_3D_RT_BVH_H_
+
+#include <lsp-plug.in/dsp-units/version.h>
+#include <lsp-plug.in/dsp-units/3d/rt/types.h>
+#include <lsp-plug.in/lltl/darray.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        namespace rt
+        {
+            /**
+             * Build bounding volume hierarchy over the triangles of the object. The triangles
+             * are re-ordered so each leaf of the hierarchy refers to a contiguous range of triangles.
+             * The root node of the hierarchy is stored at index 0, children of each inner node
+             * are stored at adjacent indices.
+             *
+             * @param bvh the list to store nodes of the hierarchy
+             * @param vt array of triangles to re-order
+             * @param nt number of triangles
+             * @return status of operation
+             */
+            LSP_DSP_UNITS_PUBLIC
+            status_t build_bvh(lltl::darray<rtx::bvh_node_t> *bvh, rtx::triangle_t *vt, size_t nt);
+
+            /**
+             * Compute side planes of the view for checking nodes of the bounding volume hierarchy,
+             * the planes are oriented to have the inner space of the view at the positive side
+             *
+             * @param pl array of three planes to store
+             * @param view the view
+             */
+            LSP_DSP_UNITS_PUBLIC
+            void bvh_view_planes(dsp::vector3d_t *pl, const rt::view_t *view);
+
+            /**
+             * Check that the bounding box of the node may intersect the view. The check is conservative:
+             * it can pass nodes which are outside of the view but never rejects visible nodes.
+             *
+             * @param node node to check
+             * @param pl three side planes computed by bvh_view_planes()
+             * @return true if the node may intersect the view
+             */
+            LSP_DSP_UNITS_PUBLIC
+            bool bvh_check_node(const rtx::bvh_node_t *node, const dsp::vector3d_t *pl);
+
+        } /* namespace rt */
+    } /* namespace dspu */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_DSP_UNITS_3D_RT_BVH_H_ */
@@ -72,6 +72,7 @@ namespace lsp
                     status_t        add_triangle(const rt::triangle_t *t);
                     status_t        add_edge(const rtm::edge_t *e);
                     status_t        add_edge(const rtx::edge_t *e);
+                    status_t        add_object_triangles(const rtx::triangle_t *vt, size_t nt);
 
                 public:
                     // Construction/destruction
@@ -146,6 +147,19 @@ namespace lsp
                      */
                     status_t        add_object(rtx::triangle_t *vt, rtx::edge_t *ve, size_t nt, size_t ne);
 
+                    /**
+                     * Add object for capturing data, skip triangles which are outside of the view
+                     * by traversing the bounding volume hierarchy built for the object.
+                     * The view should be initialized before the call.
+                     *
+                     * @param vt array of raw triangles ordered according to the hierarchy
+                     * @param ve array of edges that should be added to plan
+                     * @param bvh nodes of the bounding volume hierarchy built by rt::build_bvh()
+                     * @param ne number of edges that should be added to plan
+                     * @return status of operation
+                     */
+                    status_t        add_object(rtx::triangle_t *vt, rtx::edge_t *ve, const rtx::bvh_node_t *bvh, size_t ne);
+
                     /**
                      * Cull view with the view planes
                      * @return status of operation
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_UNITS_3D_RT_QUEUE_H_
+#define LSP_PLUG_IN_DSP_UNITS_3D_RT_QUEUE_H_
+
+#include <lsp-plug.in/dsp-units/version.h>
+#include <lsp-plug.in/dsp-units/3d/rt/context.h>
+#include <lsp-plug.in/common/atomic.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        namespace rt
+        {
+            /**
+             * Lock-free work-stealing deque of ray tracing tasks of fixed capacity (Chase-Lev).
+             * The owner thread pushes and pops tasks at the bottom, other threads steal tasks
+             * from the top.
+             */
+            typedef struct LSP_DSP_UNITS_PUBLIC task_queue_t
+            {
+                public:
+                    enum { CAPACITY = 0x4000 };
+
+                protected:
+                    rt::context_t                  *vItems[CAPACITY];
+                    volatile uatomic_t              nTop;
+                    volatile uatomic_t              nBottom;
+
+                public:
+                    explicit task_queue_t();
+                    task_queue_t(const task_queue_t &) = delete;
+                    task_queue_t(task_queue_t &&) = delete;
+                    ~task_queue_t();
+
+                    task_queue_t & operator = (const task_queue_t &) = delete;
+                    task_queue_t & operator = (task_queue_t &&) = delete;
+
+                public:
+                    /**
+                     * Push task to the bottom of the queue, should be called by the owner thread only
+                     * @param ctx task to push
+                     * @return false if the queue is full
+                     */
+                    bool            push(rt::context_t *ctx);
+
+                    /**
+                     * Pop task from the bottom of the queue, should be called by the owner thread only
+                     * @return the task or NULL if the queue is empty
+                     */
+                    rt::context_t  *pop();
+
+                    /**
+                     * Steal task from the top of the queue, can be called by any thread
+                     * @return the task or NULL if the queue is empty or the race with other thread was lost
+                     */
+                    rt::context_t  *steal();
+
+                    /**
+                     * Check that the queue has no tasks to steal, can be called by any thread
+                     * @return true if the queue is empty
+                     */
+                    bool            empty();
+
+                    /**
+                     * Destroy all tasks left in the queue, should be called when no other thread accesses it
+                     */
+                    void            destroy();
+            } task_queue_t;
+
+        } /* namespace rt */
+    } /* namespace dspu */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_DSP_UNITS_3D_RT_QUEUE_H_ */
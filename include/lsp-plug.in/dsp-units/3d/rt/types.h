@@ -125,6 +125,14 @@ namespace lsp
                 rtx::edge_t        *e[3];       // Pointer to edges
                 __IF_32(uint32_t    __pad[2];)  // Alignment to be sizeof() multiple of 16
             } triangle_t;
+
+            typedef struct bvh_node_t
+            {
+                float               min[3];     // Lower corner of the bounding box
+                float               max[3];     // Upper corner of the bounding box
+                uint32_t            first;      // Index of first triangle for leaf, index of left child for inner node
+                uint32_t            count;      // Number of triangles for leaf, zero for inner node
+            } bvh_node_t;
         #pragma pack(pop)
         } // namespace rtx
 
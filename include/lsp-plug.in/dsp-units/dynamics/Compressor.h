@@ -253,6 +253,19 @@ namespace lsp
                  */
                 float process(float *env, float in);
 
+                /** Process sidechain signals of multiple compressors at once. The envelope followers
+                 * of up to 8 compressors are computed simultaneously as independent lanes, results
+                 * are the same as calling process() for each compressor separately.
+                 *
+                 * @param list list of compressors
+                 * @param out list of output signal gain buffers to VCA, one per compressor
+                 * @param env list of envelope signal buffers, one per compressor, may be NULL or contain NULL elements
+                 * @param in list of sidechain signal buffers, one per compressor
+                 * @param count number of compressors
+                 * @param samples number of samples to process
+                 */
+                static void process(Compressor * const *list, float * const *out, float * const *env, const float * const *in, size_t count, size_t samples);
+
                 /** Get compression curve
                  *
                  * @param out output compression value
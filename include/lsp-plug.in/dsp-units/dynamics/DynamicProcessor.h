@@ -283,6 +283,19 @@ namespace lsp
                  */
                 float process(float *env, float s);
 
+                /** Process sidechain signals of multiple dynamic processors at once. The envelope followers
+                 * of up to 8 dynamic processors are computed simultaneously as independent lanes, results
+                 * are the same as calling process() for each dynamic processor separately.
+                 *
+                 * @param list list of dynamic processors
+                 * @param out list of output signal gain buffers to VCA, one per dynamic processor
+                 * @param env list of envelope signal buffers, one per dynamic processor, may be NULL or contain NULL elements
+                 * @param in list of sidechain signal buffers, one per dynamic processor
+                 * @param count number of dynamic processors
+                 * @param samples number of samples to process
+                 */
+                static void process(DynamicProcessor * const *list, float * const *out, float * const *env, const float * const *in, size_t count, size_t samples);
+
                 /** Get dynamic curve
                  *
                  * @param out output compression value
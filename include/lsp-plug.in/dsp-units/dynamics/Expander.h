@@ -247,6 +247,19 @@ namespace lsp
                  */
                 float process(float *env, float s);
 
+                /** Process sidechain signals of multiple expanders at once. The envelope followers
+                 * of up to 8 expanders are computed simultaneously as independent lanes, results
+                 * are the same as calling process() for each expander separately.
+                 *
+                 * @param list list of expanders
+                 * @param out list of output signal gain buffers to VCA, one per expander
+                 * @param env list of envelope signal buffers, one per expander, may be NULL or contain NULL elements
+                 * @param in list of sidechain signal buffers, one per expander
+                 * @param count number of expanders
+                 * @param samples number of samples to process
+                 */
+                static void process(Expander * const *list, float * const *out, float * const *env, const float * const *in, size_t count, size_t samples);
+
                 /** Get expansion curve
                  *
                  * @param out output expansion value
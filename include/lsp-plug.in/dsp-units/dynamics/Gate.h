@@ -60,6 +60,9 @@ namespace lsp
                 uint8_t     nCurve;
                 bool        bUpdate;
 
+            protected:
+                void        apply_curves(float *buf, size_t samples);
+
             public:
                 explicit Gate();
                 Gate(const Gate &) = delete;
@@ -242,6 +245,19 @@ namespace lsp
                  */
                 float process(float *env, float s);
 
+                /** Process sidechain signals of multiple gates at once. The envelope followers
+                 * of up to 8 gates are computed simultaneously as independent lanes, the curve with hysteresis is
+                 * selected for each sample the same way as the single-sample process() does.
+                 *
+                 * @param list list of gates
+                 * @param out list of output signal gain buffers to VCA, one per gate
+                 * @param env list of envelope signal buffers, one per gate, may be NULL or contain NULL elements
+                 * @param in list of sidechain signal buffers, one per gate
+                 * @param count number of gates
+                 * @param samples number of samples to process
+                 */
+                static void process(Gate * const *list, float * const *out, float * const *env, const float * const *in, size_t count, size_t samples);
+
                 /** Get curve
                  *
                  * @param out output expansion value
@@ -52,6 +52,12 @@ namespace lsp
             LM_LINE_DUCK
         };
 
+        enum limiter_engine_t
+        {
+            LE_ITERATIVE,                       // Iterative peak search with patch application for each peak
+            LE_SINGLE_PASS                      // Single-pass gain computer with iterative search for residual peaks only
+        };
+
         class LSP_DSP_UNITS_PUBLIC Limiter
         {
             protected:
@@ -132,11 +138,14 @@ namespace lsp
                 size_t      nSampleRate;
                 size_t      nUpdate;
                 size_t      nMode;
+                size_t      nEngine;
                 alr_t       sALR;
 
                 // Pre-calculated parameters
                 float      *vGainBuf;
                 float      *vTmpBuf;                // Temporary buffer to store the actual sidechain value
+                float      *vEnvBuf;                // Envelope buffer for the single-pass gain computer
+                uint32_t   *vPeakIdx;               // Sliding maximum queue for the single-pass gain computer
                 uint8_t    *vData;
 
                 union
@@ -150,6 +159,7 @@ namespace lsp
                 inline float    sat(ssize_t n);
                 inline float    exp(ssize_t n);
                 inline float    line(ssize_t n);
+                inline float    patch(ssize_t n);
                 static void     apply_sat_patch(sat_t *sat, float *dst, float amp);
                 static void     apply_exp_patch(exp_t *exp, float *dst, float amp);
                 static void     apply_line_patch(line_t *line, float *dst, float amp);
@@ -163,6 +173,7 @@ namespace lsp
                 void            init_line(line_t *line);
 
                 void            process_alr(float *gbuf, const float *sc, size_t samples);
+                void            process_envelope(float *gbuf, size_t samples);
 
                 static void     dump(IStateDumper *v, const char *name, const sat_t *sat);
                 static void     dump(IStateDumper *v, const char *name, const exp_t *exp);
@@ -219,6 +230,22 @@ namespace lsp
                  */
                 void set_mode(limiter_mode_t mode);
 
+                /**
+                 * Get gain computation engine
+                 * @return gain computation engine
+                 */
+                inline limiter_engine_t get_engine() const              { return limiter_engine_t(nEngine); }
+
+                /** Set gain computation engine. The iterative engine searches for the highest peak and applies
+                 * the patch to the gain curve until all peaks are below the threshold. The single-pass engine
+                 * computes the gain curve of the same shape using the sliding maximum of the required gain
+                 * reduction and attack/release envelope, so the iterative search is performed for residual
+                 * peaks only.
+                 *
+                 * @param engine gain computation engine
+                 */
+                void set_engine(limiter_engine_t engine);
+
                 /** Change current sample rate of processor
                  *
                  * @param sr sample rate to set
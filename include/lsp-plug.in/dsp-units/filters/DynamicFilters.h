@@ -42,7 +42,10 @@ namespace lsp
                 typedef struct filter_t
                 {
                     filter_params_t     sParams;                // Filter parameters
+                    dsp::biquad_x1_t   *vTable;                 // Gain-indexed table of biquad coefficients: nTablePoints per cascade
+                    size_t              nCascades;              // Number of cascades stored in the table
                     bool                bActive;                // Filter activity
+                    bool                bTable;                 // Gain-indexed table is up-to-date
                 } filter_t;
 
                 union biquad_bank_t
@@ -66,12 +69,27 @@ namespace lsp
                 void               *pData;              // Aligned pointer data
                 bool                bClearMem;          // Clear memory
 
+                float              *vGainGrid;          // Gain values of the table grid
+                uint32_t           *vGainIndex;         // Per-sample index of the table row
+                float              *vGainFrac;          // Per-sample interpolation factor between table rows
+                float               fTableMin;          // Minimum gain of the table
+                float               fTableMax;          // Maximum gain of the table
+                float               fTableLogMin;       // Natural logarithm of the minimum gain
+                float               fTableKStep;        // Number of table steps per one neper of gain
+                size_t              nTablePoints;       // Number of gain points in the table, 0 if table is not used
+                size_t              nTableCascades;     // Maximum number of cascades per filter stored in the table
+                uint8_t            *pTableData;         // Allocated data for tables
+
             protected:
                 size_t              quantify(size_t c, size_t nc);
                 size_t              build_filter_bank(dsp::f_cascade_t *dst, const filter_params_t *fp, size_t cj, const float *sfg, size_t samples);
                 size_t              build_lrx_ladder_filter_bank(dsp::f_cascade_t *dst, const filter_params_t *fp, size_t cj, const float *sfg, size_t samples, size_t ftype);
                 size_t              build_lrx_shelf_filter_bank(dsp::f_cascade_t *dst, const filter_params_t *fp, size_t cj, const float *sfg, size_t samples, size_t ftype);
 
+                void                build_gain_table(filter_t *f, float kf);
+                void                process_gain_table(filter_t *f, float *out, const float *in, float *fmem, const float *gain, size_t samples);
+                void                invalidate_tables();
+
                 size_t              precalc_lrx_ladder_filter_bank(dsp::f_cascade_t *dst, const filter_params_t *fp, size_t cj, const float *sfg, size_t samples);
                 void                calc_lrx_ladder_filter_bank(dsp::f_cascade_t *dst, const filter_params_t *fp, size_t cj, size_t samples, size_t ftype, size_t nc);
 
@@ -111,6 +129,30 @@ namespace lsp
                  */
                 void                set_sample_rate(size_t sr);
 
+                /** Enable gain-indexed coefficient tables. When the parameters of a filter change, the
+                 * biquad coefficients are computed for a logarithmic grid of gain values, and the processing
+                 * linearly interpolates them between the two nearest grid points instead of building the
+                 * cascades and transforming them for each sample. The coefficients are exact at the grid
+                 * points, the deviation between them is bounded by the grid step. The gain is limited to the
+                 * range of the table. Interpolated coefficients stay stable since the stability region of
+                 * the biquad filter is convex. The table takes (20*log10(max/min)/step + 1) * cascades
+                 * * sizeof(dsp::biquad_x1_t) bytes per filter. Filters that require more cascades than the table can store are processed
+                 * without the table. Should be called after init(), init() disables tables.
+                 *
+                 * @param min minimum gain of the table, should be positive
+                 * @param max maximum gain of the table, should be greater than min
+                 * @param step grid step in decibels, zero or negative value disables tables
+                 * @param cascades maximum number of cascades per filter stored in the table
+                 * @return status of operation
+                 */
+                status_t            set_gain_table(float min, float max, float step, size_t cascades = 16);
+
+                /** Check that gain-indexed coefficient tables are enabled
+                 *
+                 * @return true if gain-indexed coefficient tables are enabled
+                 */
+                inline bool         gain_table() const  { return nTablePoints > 0; }
+
                 /** Check that filter is active
                  *
                  * @param id ID of filter
@@ -27,6 +27,9 @@
 #include <lsp-plug.in/dsp-units/filters/common.h>
 #include <lsp-plug.in/dsp-units/filters/FilterBank.h>
 #include <lsp-plug.in/dsp-units/filters/Filter.h>
+#include <lsp-plug.in/dsp-units/util/Semaphore.h>
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/ipc/Thread.h>
 
 namespace lsp
 {
@@ -46,15 +49,57 @@ namespace lsp
          */
         class LSP_DSP_UNITS_PUBLIC Equalizer
         {
+            private:
+                friend class MultiEqualizer;
+
             protected:
                 enum eq_flags_t
                 {
-                    EF_REBUILD  = 1 << 0,
-                    EF_CLEAR    = 1 << 1,
-                    EF_XFADE    = 1 << 2,
-                    EF_SMOOTH   = 1 << 3
+                    EF_REBUILD    = 1 << 0,
+                    EF_CLEAR      = 1 << 1,
+                    EF_XFADE      = 1 << 2,
+                    EF_SMOOTH     = 1 << 3,
+                    EF_SUBMIT     = 1 << 4,
+                    EF_IIR_SMOOTH = 1 << 5
+                };
+
+                enum kernel_state_t
+                {
+                    KS_IDLE,                            // Worker has no job
+                    KS_PENDING,                         // Job has been submitted to the worker
+                    KS_BUSY,                            // Worker is building the kernel
+                    KS_DONE                             // Worker has built the kernel
+                };
+
+                class KernelWorker: public ipc::Thread
+                {
+                    private:
+                        Equalizer          *pEq;
+
+                    public:
+                        explicit KernelWorker(Equalizer *eq);
+                        virtual ~KernelWorker();
+
+                    public:
+                        virtual status_t run();
                 };
 
+                typedef struct kernel_t
+                {
+                    FilterBank          sBank;          // Filter bank for computing the impulse response
+                    Filter             *vFilters;       // Copy of filters owned by the background worker
+                    filter_params_t    *vParams;        // Filter parameters submitted to the background worker
+                    uint8_t            *vChanged;       // Filters which cached magnitude is outdated
+                    float              *vConv;          // Convolution data built by the background worker
+                    float              *vTemp;          // Temporary buffer of the background worker
+                    float              *vFft;           // FFT buffer of the background worker
+                    float              *vFilterMag;     // Cached magnitude response of each filter
+                    uint32_t            nGen;           // Generation of the submitted job
+                    uint32_t            nSampleRate;    // Sample rate of filters
+                    uint32_t            nActualSampleRate; // Actual sample rate
+                    equalizer_mode_t    nMode;          // Equalizer mode
+                } kernel_t;
+
             protected:
                 FilterBank          sBank;              // Filter bank
                 Filter             *vFilters;           // List of filters
@@ -73,12 +118,33 @@ namespace lsp
                 float              *vConv;              // Convolution data
                 float              *vFft;               // FFT transform data buffer (real + imaginary)
                 float              *vTemp;              // Temporary buffer for miscellaneous calculations
+                float              *vFirWindow;         // Window applied to the impulse response in FIR mode
+                float              *vIrWindow;          // Window applied to the synthesized linear-phase impulse response
+                float              *vSpmWindow;         // Window applied to the signal in SPM mode
+                float              *vFilterMag;         // Cached magnitude response of each filter
+                uint8_t            *vChanged;           // Filters which have been changed since the last rebuild
+                uint8_t            *vOutdated;          // Filters which parameters have not been passed to the background worker
+                uint32_t            nMagStride;         // Stride between magnitude responses of filters
+
+                KernelWorker       *pWorker;            // Background worker which builds the kernel
+                kernel_t            sKernel;            // Data of the background worker
+                Semaphore          *pKernelSignal;      // Signal which wakes up the background worker
+                volatile atomic_t   nKernelState;       // State of the background job
+                uint32_t            nKernelGen;         // Generation of the kernel, the job of other generation is stale
 
                 size_t              nFlags;             // Flag that identifies that equalizer has to be rebuilt
                 uint8_t            *pData;              // Allocation data
 
             protected:
                 void                reconfigure();
+                void                mark_changed();
+                void                build_kernel(float *dst, Filter *filters, uint8_t *changed, float *mag,
+                                        FilterBank *bank, float *temp, float *fft, equalizer_mode_t mode, size_t sr);
+                void                prepare_kernel();
+                void                process_kernel();
+                bool                submit_kernel();
+                void                collect_kernel();
+                void                cancel_kernel();
 
             public:
                 explicit Equalizer();
@@ -98,9 +164,13 @@ namespace lsp
                  *
                  * @param filters number of filters
                  * @param fir_rank FIR filter rank (impulse response size)
+                 * @param background build the kernel for FIR, FFT and SPM modes in the background worker
+                 *   thread when filter parameters change, the new kernel is applied with crossfade at
+                 *   one of the next frame boundaries. Changes of mode and sample rate still cause
+                 *   immediate rebuild of the kernel.
                  * @return true on success
                  */
-                bool                init(size_t filters, size_t fir_rank);
+                bool                init(size_t filters, size_t fir_rank, bool background = false);
 
                 /** Destroy equalizer
                  *
@@ -267,6 +337,19 @@ namespace lsp
                  */
                 size_t              ir_size() const;
 
+                /**
+                 * Check that the kernel is built by the background worker thread
+                 * @return true if the kernel is built by the background worker thread
+                 */
+                inline bool         background() const      { return pWorker != NULL; }
+
+                /**
+                 * Check that the equalizer has pending changes of the kernel which are not applied yet:
+                 * the kernel has to be rebuilt, is being built by the background worker or is crossfaded
+                 * @return true if there are pending changes of the kernel
+                 */
+                bool                kernel_pending() const;
+
                 /**
                  * Check that the smooth mode for FIR/FFT mode is enabled
                  * @return true if the smooth mode for FIR/FFT mode is enabled
@@ -276,10 +359,24 @@ namespace lsp
                 /**
                  * Enable smooth mode for the FIR/FFT mode which performs
                  * soft crossfade between data convolved with the old impulse response
-                 * and data convolved with the new impulse response.
+                 * and data convolved with the new impulse response
                  * @param smooth smooth mode flag
                  */
                 void                set_smooth(bool smooth);
+
+                /**
+                 * Check that the smooth mode for IIR mode is enabled
+                 * @return true if the smooth mode for IIR mode is enabled
+                 */
+                bool                iir_smooth() const;
+
+                /**
+                 * Enable smooth mode for the IIR mode which interpolates parameters of filters
+                 * over the processed block, see FilterBank::set_smooth(). The filters are processed
+                 * by the scalar state-variable filter code in this mode, so it is disabled by default.
+                 * @param smooth smooth mode flag
+                 */
+                void                set_iir_smooth(bool smooth);
             
                 /**
                  * Dump the state
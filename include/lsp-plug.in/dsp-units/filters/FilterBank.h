@@ -33,6 +33,23 @@ namespace lsp
     {
         class LSP_DSP_UNITS_PUBLIC FilterBank
         {
+            protected:
+                /**
+                 * Biquad filter represented as the state-variable filter (SVF) with trapezoidal integrators,
+                 * the output is the mix of high-pass, band-pass and low-pass outputs of the SVF.
+                 * Unlike the direct form, the SVF stays stable while its parameters are modulated.
+                 */
+                typedef struct svf_t
+                {
+                    float               g;          // Frequency warping factor
+                    float               k;          // Damping factor
+                    float               hp;         // Gain of the high-pass output
+                    float               bp;         // Gain of the band-pass output
+                    float               lp;         // Gain of the low-pass output
+                    float               s1;         // State of the first integrator
+                    float               s2;         // State of the second integrator
+                } svf_t;
+
             protected:
                 dsp::biquad_t      *vFilters;   // Optimized list of filters
                 dsp::biquad_x1_t   *vChains;    // List of biquad banks
@@ -40,10 +57,18 @@ namespace lsp
                 size_t              nMaxItems;  // Maximum number of biquad_x1 filters
                 size_t              nLastItems; // Previous number of biquad_x1 filters
                 float              *vBackup;    // Delay backup to take online impulse response
+                svf_t              *vSvf;       // Current state of filters in smooth mode
+                svf_t              *vSvfTarget; // Target parameters of filters in smooth mode
                 uint8_t            *vData;      // Unaligned data
+                bool                bSmooth;    // Smooth mode
+                bool                bRamp;      // Parameters of filters should be interpolated on next process() call
 
             protected:
                 void                clear_delays();
+                void                process_direct(float *out, const float *in, size_t samples);
+                void                process_smooth(float *out, const float *in, size_t samples);
+
+                static void         calc_svf(svf_t *svf, const dsp::biquad_x1_t *f);
 
             public:
                 explicit FilterBank();
@@ -105,6 +130,24 @@ namespace lsp
                  */
                 void                end(bool clear = false);
 
+                /**
+                 * Check that the smooth mode is enabled
+                 * @return true if the smooth mode is enabled
+                 */
+                inline bool         smooth() const      { return bSmooth; }
+
+                /**
+                 * Enable smooth mode. In smooth mode the filters are processed as state-variable filters
+                 * and the change of filter parameters committed by end() without changing the number of
+                 * filters is not applied immediately: the parameters are linearly interpolated between
+                 * the old and the new values over the samples of the next process() call. That allows
+                 * to automate filters without zipper noise at the cost of the scalar processing.
+                 * Switching the mode clears the internal state of filters.
+                 *
+                 * @param smooth smooth mode flag
+                 */
+                void                set_smooth(bool smooth);
+
                 /** Process samples
                  *
                  * @param out output buffer
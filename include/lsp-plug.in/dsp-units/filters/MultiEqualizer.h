@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_UNITS_FILTERS_MULTIEQUALIZER_H_
+#define LSP_PLUG_IN_DSP_UNITS_FILTERS_MULTIEQUALIZER_H_
+
+#include <lsp-plug.in/dsp-units/version.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/filters/Equalizer.h>
+#include <lsp-plug.in/dsp-units/filters/MultiFilterBank.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        /**
+         * Multi-channel equalizer: applies the same set of filters to multiple channels.
+         * The FIR/FFT/SPM kernel is built only once and shared between all channels,
+         * the IIR filter coefficients are computed once and applied to all channels at once
+         * by the multi-channel filter bank, or by the filter bank of each channel if there are
+         * less than MULTI_FILTERBANK_MIN_CHANNELS channels.
+         */
+        class LSP_DSP_UNITS_PUBLIC MultiEqualizer
+        {
+            protected:
+                enum meq_flags_t
+                {
+                    MF_SYNC     = 1 << 0,               // Filter coefficients of channels need to be updated
+                    MF_CLEAR    = 1 << 1                // Channel state needs to be cleared
+                };
+
+                typedef struct channel_t
+                {
+                    FilterBank          sBank;          // Filter bank of the channel for IIR mode with few channels
+                    float              *vInBuffer;      // Input buffer data
+                    float              *vOutBuffer;     // Output buffer data
+                } channel_t;
+
+            protected:
+                Equalizer           sEq;                // Equalizer that manages filters and builds the kernel
+                MultiFilterBank     sBank;              // Filter bank of all channels for IIR mode
+                channel_t          *vChannels;          // List of channels
+                uint32_t            nChannels;          // Number of channels
+                uint32_t            nBufSize;           // Buffer size
+                size_t              nFlags;             // Update flags
+                bool                bLanes;             // Use the multi-channel filter bank for IIR mode
+                uint8_t            *pData;              // Allocation data
+
+            protected:
+                void                sync_channels();
+                void                process_fir(float * const *out, const float * const *in, size_t samples);
+                void                process_spm(float * const *out, const float * const *in, size_t samples);
+
+            public:
+                explicit MultiEqualizer();
+                MultiEqualizer(const MultiEqualizer &) = delete;
+                MultiEqualizer(MultiEqualizer &&) = delete;
+                ~MultiEqualizer();
+
+                MultiEqualizer & operator = (const MultiEqualizer &) = delete;
+                MultiEqualizer & operator = (MultiEqualizer &&) = delete;
+
+                /**
+                 * Construct the object being part of memory chunk
+                 */
+                void                construct();
+
+                /** Initialize equalizer
+                 *
+                 * @param channels number of channels
+                 * @param filters number of filters
+                 * @param fir_rank FIR filter rank (impulse response size)
+                 * @param background build the kernel in the background worker thread, see Equalizer::init()
+                 * @return true on success
+                 */
+                bool                init(size_t channels, size_t filters, size_t fir_rank, bool background = false);
+
+                /** Destroy equalizer
+                 *
+                 */
+                void                destroy();
+
+            public:
+                /**
+                 * Get number of channels
+                 * @return number of channels
+                 */
+                inline size_t       channels() const        { return nChannels;             }
+
+                /**
+                 * Check if the configuration of the equalizer has changed
+                 * @return true if the configuration of the equalizer has changed
+                 */
+                inline bool         configuration_changed() const   { return sEq.configuration_changed();   }
+
+                /** Update filter parameters
+                 * @param id ID of the filter
+                 * @param params  filter parameters
+                 * @return true on success
+                 */
+                bool                set_params(size_t id, const filter_params_t *params);
+
+                /** Apply limits to filter parameters
+                 * @param id ID of the filter
+                 * @param fp filter parameters to process
+                 * @return true on success
+                 */
+                inline bool         limit_params(size_t id, filter_params_t *fp)        { return sEq.limit_params(id, fp);  }
+
+                /** Get filter parameters
+                 * @param id ID of the filter
+                 * @param params  filter parameters
+                 * @return true on success
+                 */
+                inline bool         get_params(size_t id, filter_params_t *params)      { return sEq.get_params(id, params); }
+
+                /** Check that filter is active
+                 *
+                 * @param id ID of filter
+                 * @return true if filter is active
+                 */
+                inline bool         filter_active(size_t id) const      { return sEq.filter_active(id);     }
+
+                /** Check that filter is inactive
+                 *
+                 * @param id ID of filter
+                 * @return true if filter is inactive
+                 */
+                inline bool         filter_inactive(size_t id) const    { return sEq.filter_inactive(id);   }
+
+                /** Set equalizer mode
+                 *
+                 * @param mode equalizer mode
+                 */
+                void                set_mode(equalizer_mode_t mode);
+
+                /** Set actual sample rate which can affect FFT transforms
+                 *
+                 * @param sample_rate actual sample rate
+                 */
+                void                set_actual_sample_rate(size_t sample_rate);
+
+                /** Set sample rate
+                 *
+                 * @param sr sample rate
+                 */
+                void                set_sample_rate(size_t sr);
+
+                /** Get equalizer mode
+                 *
+                 * @return equalizer mode
+                 */
+                inline equalizer_mode_t get_mode() const    { return sEq.get_mode();        }
+
+                /** Get equalizer latency
+                 *
+                 * @return equalizer latency
+                 */
+                inline size_t       get_latency()           { return sEq.get_latency();     }
+
+                /**
+                 * Get maximum possible latency for the equalizer
+                 * @return maximum possible latency
+                 */
+                inline size_t       max_latency() const     { return sEq.max_latency();     }
+
+                /** Get frequency chart of the specific filter
+                 *
+                 * @param id ID of the filter
+                 * @param c complex numbers that contain the filter transfer function
+                 * @param f frequencies to calculate filter transfer function
+                 * @param count number of points
+                 * @return status of operation
+                 */
+                inline bool         freq_chart(size_t id, float *c, const float *f, size_t count)
+                {
+                    return sEq.freq_chart(id, c, f, count);
+                }
+
+                /**
+                 * Get frequency chart of the whole equalizer
+                 * @param c complex numbers that contain the filter transfer function
+                 * @param f frequencies to calculate filter transfer function
+                 * @param count number of points
+                 */
+                inline void         freq_chart(float *c, const float *f, size_t count)
+                {
+                    sEq.freq_chart(c, f, count);
+                }
+
+                /** Process the signal of all channels
+                 *
+                 * @param out array of output buffers, one per channel
+                 * @param in array of input buffers, one per channel
+                 * @param samples number of samples to process
+                 */
+                void                process(float * const *out, const float * const *in, size_t samples);
+
+                /**
+                 * Reset the internal memory of filters
+                 */
+                void                reset();
+
+                /**
+                 * Get FIR filer rank
+                 * @return FIR filter rank
+                 */
+                inline size_t       fir_rank() const        { return sEq.fir_rank();        }
+
+                /**
+                 * Get actual impulse response size depending on the currently set equalizer mode
+                 * For IIR filter, the zero IR size is returned
+                 * @return actual impulse response size
+                 */
+                inline size_t       ir_size() const         { return sEq.ir_size();         }
+
+                /**
+                 * Check that the kernel is built by the background worker thread
+                 * @return true if the kernel is built by the background worker thread
+                 */
+                inline bool         background() const      { return sEq.background();      }
+
+                /**
+                 * Check that the smooth mode for FIR/FFT mode is enabled
+                 * @return true if the smooth mode for FIR/FFT mode is enabled
+                 */
+                inline bool         smooth() const          { return sEq.smooth();          }
+
+                /**
+                 * Enable smooth mode for the FIR/FFT mode
+                 * @param smooth smooth mode flag
+                 */
+                inline void         set_smooth(bool smooth) { sEq.set_smooth(smooth);       }
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                dump(IStateDumper *v) const;
+        };
+
+    } /* namespace dspu */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_DSP_UNITS_FILTERS_MULTIEQUALIZER_H_ */
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_UNITS_FILTERS_MULTIFILTERBANK_H_
+#define LSP_PLUG_IN_DSP_UNITS_FILTERS_MULTIFILTERBANK_H_
+
+#include <lsp-plug.in/dsp-units/version.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/filters/common.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        constexpr size_t MULTI_FILTERBANK_LANES         = 8;
+        constexpr size_t MULTI_FILTERBANK_MIN_CHANNELS  = 4;   // Fewer channels are processed faster by FilterBank of each channel
+
+        /**
+         * Multi-channel filter bank: applies the same chain of biquad filters to multiple channels.
+         * Unlike FilterBank which places successive filters of one channel into the SIMD lanes,
+         * the lanes of the multi-channel filter bank hold different channels of the same filter,
+         * so up to MULTI_FILTERBANK_LANES channels are processed in one pass over the chain.
+         */
+        class LSP_DSP_UNITS_PUBLIC MultiFilterBank
+        {
+            protected:
+                dsp::biquad_x1_t   *vChains;    // List of filters shared between channels
+                float              *vDelays;    // Delays of filters: MULTI_FILTERBANK_LANES d0 and d1 values per filter per group of channels
+                float              *vBuffer;    // Buffer for samples of one group of channels stored in lanes
+                size_t              nChannels;  // Number of channels
+                size_t              nItems;     // Current number of biquad_x1 filters
+                size_t              nMaxItems;  // Maximum number of biquad_x1 filters
+                size_t              nLastItems; // Previous number of biquad_x1 filters
+                uint8_t            *vData;      // Unaligned data
+
+            protected:
+                void                process_group(float * const *dst, const float * const *src, size_t stride,
+                                        size_t channels, float *d, size_t samples);
+
+            public:
+                explicit MultiFilterBank();
+                MultiFilterBank(const MultiFilterBank &) = delete;
+                MultiFilterBank(MultiFilterBank &&) = delete;
+                ~MultiFilterBank();
+
+                MultiFilterBank & operator = (const MultiFilterBank &) = delete;
+                MultiFilterBank & operator = (MultiFilterBank &&) = delete;
+
+                /**
+                 * Construct the filter bank being a chunk of memory
+                 */
+                void                construct();
+
+                /** Initialize filter bank
+                 *
+                 * @param channels number of channels
+                 * @param filters number of biquad filters
+                 * @return true on success
+                 */
+                bool                init(size_t channels, size_t filters);
+
+                /** Destroy filter bank
+                 *
+                 */
+                void                destroy();
+
+            public:
+                /** Start filter bank, clears number of cascades
+                 *
+                 */
+                inline void         begin()
+                {
+                    nLastItems      = nItems;
+                    nItems          = 0;
+                }
+
+                /**
+                 * Get number of channels
+                 * @return number of channels
+                 */
+                inline size_t       channels() const    { return nChannels; }
+
+                /**
+                 * Return the maximum possible number of chains
+                 * @return the maximum possible number of chains
+                 */
+                inline size_t       max_chains() const  { return nMaxItems; }
+
+                /** Add cascade to biquad filter
+                 *
+                 * @return added cascade
+                 */
+                dsp::biquad_x1_t   *add_chain();
+
+                /** Get one of the current cascades
+                 *
+                 * @param id id number of the cascade
+                 * @return cascade
+                 */
+                dsp::biquad_x1_t   *chain(size_t id);
+
+                /** Commit the structure of filter bank
+                 * @param clear force to clear delays
+                 */
+                void                end(bool clear = false);
+
+                /** Process samples of channels stored in separate buffers
+                 *
+                 * @param out array of output buffers, one per channel
+                 * @param in array of input buffers, one per channel
+                 * @param samples number of samples to process
+                 */
+                void                process(float * const *out, const float * const *in, size_t samples);
+
+                /** Process samples of channels stored in one interleaved buffer
+                 *
+                 * @param out output buffer of samples * channels() size
+                 * @param in input buffer of samples * channels() size
+                 * @param samples number of samples (frames) to process
+                 */
+                void                process_interleaved(float *out, const float *in, size_t samples);
+
+                /** Get impulse response of the bank, it is the same for all channels
+                 *
+                 * @param out output buffer to store impulse response
+                 * @param samples length of buffer in samples
+                 */
+                void                impulse_response(float *out, size_t samples);
+
+                /** Get number of biquad filters
+                 *
+                 * @return number of biquad filters
+                 */
+                inline size_t       size() const { return nItems; }
+
+                /** Reset internal state of filters (clear filter memory)
+                 *
+                 */
+                void                reset();
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                dump(IStateDumper *v) const;
+        };
+
+    } /* namespace dspu */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_DSP_UNITS_FILTERS_MULTIFILTERBANK_H_ */
@@ -49,6 +49,12 @@ namespace lsp
          * If number of channels in the configuration is 1 or 2, then the meter automatically
          * sets designation value for inputs to CENTER for mono configuration or LEFT/RIGHT
          * for stereo configuration.
+         *
+         * Additionally, the meter can operate in the histogram mode. In this mode the loudness
+         * of each gating block is stored in a loudness histogram with 0.1 LU resolution instead
+         * of the ring buffer, so the integration time becomes unlimited and the gating is
+         * performed in constant time independently of the programme length. The same mode
+         * also enables measurement of the Loudness Range (LRA) as described by EBU Tech 3342.
          */
         class LSP_DSP_UNITS_PUBLIC ILUFSMeter
         {
@@ -80,17 +86,29 @@ namespace lsp
                     uint32_t            nFlags;         // Flags
                 } split_t;
 
+                typedef struct histogram_t
+                {
+                    uint32_t           *vCount;         // Number of values in each bin
+                    double             *vSum;           // Sum of values in each bin
+                    double              fSum;           // Overall sum of values
+                    uint32_t            nCount;         // Overall number of values
+                } histogram_t;
+
             protected:
                 channel_t              *vChannels;      // List of channels
 
                 float                  *vBuffer;        // Temporary buffer for processing
                 float                  *vLoudness;      // Loudness of the gating block
+                float                  *vSTParts;       // Loudness of block parts for the short-term window
+                histogram_t             sIntHist;       // Histogram of the gating block loudness
+                histogram_t             sLraHist;       // Histogram of the short-term loudness
 
                 float                   fBlockPeriod;   // Block measuring period in milliseconds
                 float                   fIntTime;       // Integration time
                 float                   fMaxIntTime;    // Maximum integration time
                 float                   fAvgCoeff;      // Averaging coefficient
                 float                   fLoudness;      // Currently measured loudness
+                float                   fRange;         // Currently measured loudness range
 
                 uint32_t                nBlockSize;     // Block measuring samples
                 uint32_t                nBlockOffset;   // Block measuring period offset
@@ -99,11 +117,15 @@ namespace lsp
                 uint32_t                nMSHead;        // Current position to write new block to buffer
                 uint32_t                nMSInt;         // Number of blocks to integrate
                 uint32_t                nMSCount;       // Count of processed block parts
+                uint32_t                nSTParts;       // Number of block parts in the short-term window
+                uint32_t                nSTHead;        // Current position to write new block part
+                uint32_t                nSTCount;       // Number of block parts in the short-term window
 
                 uint32_t                nSampleRate;    // Sample rate
                 uint32_t                nChannels;      // Number of channels
                 uint32_t                nFlags;         // Update flags
                 bs::weighting_t         enWeight;       // Weighting function
+                bool                    bHistogram;     // Histogram mode
 
                 uint8_t                *pData;          // Unaligned data
                 uint8_t                *pVarData;       // Unaligned variable data
@@ -140,6 +162,13 @@ namespace lsp
                 float           compute_gated_loudness(float threshold) const;
                 inline float    compute_infinite_loudness(float threshold) const;
                 void            clear_block_buffers();
+                void            clear_histograms();
+                void            process_short_term(size_t part);
+                float           compute_histogram_loudness() const;
+                float           compute_loudness_range() const;
+
+                static void     histogram_clear(histogram_t *h);
+                static void     histogram_add(histogram_t *h, float value);
 
             public:
                 /**
@@ -210,6 +239,20 @@ namespace lsp
                  */
                 inline float    integration_period() const      { return fIntTime;      }
 
+                /**
+                 * Enable or disable the histogram mode. In histogram mode the integration
+                 * period is unlimited and the integration period setting is ignored. Switching
+                 * the mode resets the measured loudness.
+                 * @param enable enable the histogram mode
+                 */
+                void            set_histogram(bool enable);
+
+                /**
+                 * Check that the meter operates in histogram mode
+                 * @return true if the meter operates in histogram mode
+                 */
+                inline bool     histogram() const               { return bHistogram;    }
+
                 /**
                  * Set sample rate
                  * @param sample_rate sample rate to set
@@ -237,6 +280,14 @@ namespace lsp
                  */
                 inline float    loudness() const                { return fLoudness;     }
 
+                /**
+                 * Get currently measured loudness range (LRA), available only in histogram mode.
+                 * Unlike loudness(), the value is returned in LU because it is a difference
+                 * between two loudness levels.
+                 * @return currently measured loudness range in LU
+                 */
+                inline float    loudness_range() const          { return fRange;        }
+
                 /**
                  * Check that crossover needs to call reconfigure() before processing
                  * @return true if crossover needs to call reconfigure() before processing
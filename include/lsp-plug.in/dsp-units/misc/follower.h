@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_UNITS_MISC_FOLLOWER_H_
+#define LSP_PLUG_IN_DSP_UNITS_MISC_FOLLOWER_H_
+
+#include <lsp-plug.in/dsp-units/version.h>
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        namespace follower
+        {
+            constexpr size_t MAX_LANES          = 8;    // Maximum number of lanes processed at once
+            constexpr size_t MAX_REACTIONS      = 5;    // Maximum number of attack/release reaction levels
+
+            /**
+             * The state of the peak envelope followers for multiple independent detector channels (lanes).
+             * Data is stored as a structure of arrays, so each lane is processed in a separate SIMD lane
+             * without any data-dependent branches.
+             *
+             * The reaction time applied to the lane is selected depending on the current value of envelope:
+             * the reaction with index 0 is the default one, the reaction with index i > 0 is applied if
+             * the envelope is greater or equal to the corresponding level. Levels should be sorted in
+             * ascending order, unused reactions should have the level set to +Inf.
+             */
+            typedef struct lanes_t
+            {
+                float       vEnvelope[MAX_LANES];                   // Current value of the envelope
+                float       vPeak[MAX_LANES];                       // Current peak value
+                int32_t     vHold[MAX_LANES];                       // Current hold counter
+                int32_t     vHoldMax[MAX_LANES];                    // Hold time in samples
+                float       vAttackLvl[MAX_REACTIONS][MAX_LANES];   // Attack levels
+                float       vAttackTau[MAX_REACTIONS][MAX_LANES];   // Attack reaction coefficients
+                float       vReleaseLvl[MAX_REACTIONS][MAX_LANES];  // Release levels
+                float       vReleaseTau[MAX_REACTIONS][MAX_LANES];  // Release reaction coefficients
+                uint32_t    nAttack;                                // Number of attack reactions used by lanes
+                uint32_t    nRelease;                               // Number of release reactions used by lanes
+            } lanes_t;
+
+            /**
+             * Initialize the state of all lanes: reset envelope, peak and hold counters,
+             * set up single zero-valued attack and release reactions for all lanes
+             *
+             * @param l lanes to initialize
+             */
+            LSP_DSP_UNITS_PUBLIC
+            void init(lanes_t *l);
+
+            /**
+             * Set reaction time of the lane
+             *
+             * @param l lanes
+             * @param lane lane index
+             * @param release false for attack reaction, true for release reaction
+             * @param index index of the reaction, should be less than MAX_REACTIONS
+             * @param level the envelope level starting from which the reaction is applied, ignored for index 0
+             * @param tau reaction coefficient
+             */
+            LSP_DSP_UNITS_PUBLIC
+            void set_reaction(lanes_t *l, size_t lane, bool release, size_t index, float level, float tau);
+
+            /**
+             * Process peak envelope followers for all lanes at once
+             *
+             * @param out array of output envelope buffers, one per lane
+             * @param in array of input buffers, one per lane
+             * @param l the state of lanes
+             * @param lanes number of lanes to process, should not be greater than MAX_LANES
+             * @param samples number of samples to process
+             */
+            LSP_DSP_UNITS_PUBLIC
+            void process(float * const *out, const float * const *in, lanes_t *l, size_t lanes, size_t samples);
+
+        } /* namespace follower */
+    } /* namespace dspu */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_DSP_UNITS_MISC_FOLLOWER_H_ */
@@ -51,24 +51,28 @@ namespace lsp
                 size_t              nGcRefs;        // GC stuff: Number of references
                 Sample             *pGcNext;        // GC stuff: Pointer to the next
                 mutable void       *pUserData;      // Some user data attached to sample
+                io::Path           *pStream;        // Location of the streamed sample, NULL if sample is fully loaded
+                size_t              nStreamLength;  // Overall length of the streamed sample
 
             protected:
-                static void         put_chunk_linear(float *dst, const float *src, size_t len, size_t fade_in, size_t fade_out);
-                static void         put_chunk_const_power(float *dst, const float *src, size_t len, size_t fade_in, size_t fade_out);
+                static void         put_chunk_linear(float *dst, const float *src, size_t len, size_t fade_in, size_t fade_out, size_t first, size_t last);
+                static void         put_chunk_const_power(float *dst, const float *src, size_t len, size_t fade_in, size_t fade_out, size_t first, size_t last);
 
-                typedef void        (*put_chunk_t)(float *dst, const float *src, size_t len, size_t fade_in, size_t fade_out);
+                typedef void        (*put_chunk_t)(float *dst, const float *src, size_t len, size_t fade_in, size_t fade_out, size_t first, size_t last);
 
             protected:
                 status_t            fast_downsample(Sample *s, size_t new_sample_rate);
-                status_t            fast_upsample(Sample *s, size_t new_sample_rate);
-                status_t            complex_downsample(Sample *s, size_t new_sample_rate);
-                status_t            complex_upsample(Sample *s, size_t new_sample_rate);
+                status_t            fast_upsample(Sample *s, size_t new_sample_rate, size_t threads);
+                status_t            complex_downsample(Sample *s, size_t new_sample_rate, size_t threads);
+                status_t            complex_upsample(Sample *s, size_t new_sample_rate, size_t threads);
                 status_t            do_simple_stretch(size_t new_length, size_t start, size_t end, put_chunk_t put_chunk);
-                status_t            do_single_crossfade_stretch(size_t new_length, size_t fade_len, size_t start, size_t end, put_chunk_t put_chunk);
+                status_t            do_single_crossfade_stretch(size_t new_length, size_t fade_len, size_t start, size_t end, put_chunk_t put_chunk, size_t threads);
                 status_t            open_stream_ext(mm::IInAudioStream **is, const io::Path *path);
                 status_t            try_open_regular_file(mm::IInAudioStream **is, const io::Path *path);
                 status_t            try_open_lspc(mm::IInAudioStream **is, const io::Path *lspc, const io::Path *item);
                 status_t            try_open_sfz(mm::IInAudioStream **is, const io::Path *sfz, const io::Path *item);
+                status_t            do_load_streamed(const io::Path *path, ssize_t head, float duration);
+                void                drop_stream();
 
             public:
                 explicit Sample();
@@ -153,6 +157,19 @@ namespace lsp
                 inline size_t       samples() const                 { return nLength;       }
                 inline size_t       length() const                  { return nLength;       }
 
+                /**
+                 * Check that sample is streamed: only the head part of the sample is loaded into memory
+                 * and the rest should be read from the audio stream
+                 * @return true if sample is streamed
+                 */
+                inline bool         streamed() const                { return pStream != NULL; }
+
+                /**
+                 * Get the overall sample length including the part that is not loaded into memory
+                 * @return overall sample length in samples
+                 */
+                inline size_t       full_length() const             { return (pStream != NULL) ? nStreamLength : nLength; }
+
                 /**
                  * Return the sample duration in seconds, available only if sample rate is specified
                  * @return sample duration in seconds
@@ -254,6 +271,24 @@ namespace lsp
                     sample_crossfade_t fade_type, float fade_size,
                     size_t start, size_t end);
 
+                /** Stretch part of the sample using multiple threads. The channels and the time range
+                 * of the output are split into independent tasks, the result is bit-identical to the
+                 * result of the single-threaded stretch.
+                 *
+                 * @param new_length the new length of the stretched region in samples
+                 * @param chunk_size chunk size in samples, 0 means automatic chunk size selection
+                 * @param fade_type the crossfade type between chunks
+                 * @param fade_size the relative size of the crossfade region between two chunks in range of 0 to 1
+                 * @param start the number of the sample associated with the start of the range to be stretched
+                 * @param end the number of the first sample after the end of the range to be stretched
+                 * @param threads overall number of threads used for processing, including the caller thread
+                 * @return status of operation
+                 */
+                status_t stretch(
+                    size_t new_length, size_t chunk_size,
+                    sample_crossfade_t fade_type, float fade_size,
+                    size_t start, size_t end, size_t threads);
+
                 /** Stretch the whole sample
                  *
                  * @param new_length the new length of the sample in samples
@@ -278,6 +313,16 @@ namespace lsp
                  */
                 status_t resample(size_t new_sample_rate);
 
+                /** Resample sample using multiple threads. The channels and the time range
+                 * of the output are split into independent tasks, the result is bit-identical
+                 * to the result of the single-threaded resampling.
+                 *
+                 * @param new_sample_rate new sample rate
+                 * @param threads overall number of threads used for processing, including the caller thread
+                 * @return status of operation
+                 */
+                status_t resample(size_t new_sample_rate, size_t threads);
+
                 /**
                  * Insert some empty samples at specified position
                  * @param pos position to insert data
@@ -406,6 +451,40 @@ namespace lsp
                 status_t loads_ext(const LSPString *path, ssize_t max_samples = -1);
                 status_t loads_ext(const io::Path *path, ssize_t max_samples = -1);
 
+                /**
+                 * Load only the head part of the file into memory and mark sample as streamed.
+                 * The rest of the file is read from the audio stream during the playback. If the
+                 * length of the file is less than the head size or is not known, the file is loaded
+                 * completely.
+                 * @param path location of the file
+                 * @param head the duration of the head part in seconds
+                 * @return status of operation
+                 */
+                status_t load_streamed(const char *path, float head);
+                status_t load_streamed(const LSPString *path, float head);
+                status_t load_streamed(const io::Path *path, float head);
+
+                /**
+                 * Load only the head part of the file into memory and mark sample as streamed.
+                 * The rest of the file is read from the audio stream during the playback. If the
+                 * length of the file is less than the head size or is not known, the file is loaded
+                 * completely.
+                 * @param path location of the file
+                 * @param head the length of the head part in samples
+                 * @return status of operation
+                 */
+                status_t loads_streamed(const char *path, size_t head);
+                status_t loads_streamed(const LSPString *path, size_t head);
+                status_t loads_streamed(const io::Path *path, size_t head);
+
+                /**
+                 * Open the audio stream of the streamed sample. The caller is responsible for closing
+                 * and deleting the stream
+                 * @param is pointer to store the audio stream
+                 * @return status of operation
+                 */
+                status_t open_stream(mm::IInAudioStream **is);
+
                 /**
                  * Get some user data linked to the sample
                  * @return user data linked to the sample
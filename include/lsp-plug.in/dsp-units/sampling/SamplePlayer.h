@@ -28,6 +28,7 @@
 #include <lsp-plug.in/dsp-units/sampling/Sample.h>
 #include <lsp-plug.in/dsp-units/sampling/Playback.h>
 #include <lsp-plug.in/dsp-units/sampling/PlaySettings.h>
+#include <lsp-plug.in/dsp-units/sampling/SampleStreamer.h>
 
 namespace lsp
 {
@@ -47,6 +48,7 @@ namespace lsp
                 {
                     play_item_t *pNext;     // Pointer to the next playback in the list
                     play_item_t *pPrev;     // Pointer to the previous playback in the list
+                    ssize_t     nIndex;     // Index in the array of active playbacks, negative if not active
                 } play_item_t;
 
                 typedef struct list_t
@@ -61,24 +63,38 @@ namespace lsp
                 size_t          nSamples;
                 play_item_t    *vPlayback;
                 size_t          nPlayback;
+                play_item_t   **vActive;    // Contiguous array of active playbacks for rendering
+                size_t          nActive;    // Number of active playbacks
                 list_t          sActive;
                 list_t          sInactive;
                 float           fGain;
                 uint8_t        *pData;
                 Sample         *pGcList;    // List of garbage samples not used by the sample player
 
+            protected:
+                SampleStreamer  sStreamer;  // Streamer for streamed samples
+
             protected:
                 static inline void list_remove(list_t *list, play_item_t *pb);
                 static inline play_item_t *list_remove_first(list_t *list);
                 static inline void list_add_first(list_t *list, play_item_t *pb);
                 static inline void list_insert_from_tail(list_t *list, play_item_t *pb);
 
+                inline void active_add(play_item_t *pb);
+                inline void active_remove(play_item_t *pb);
+
                 static void dump_list(IStateDumper *v, const char *name, const list_t *list);
 
             protected:
                 void            release_sample(Sample * &s);
                 static Sample  *acquire_sample(Sample *s);
 
+            protected:
+                static size_t   stream_position(const play_item_t *pb);
+                void            start_stream(play_item_t *pb);
+                void            stop_stream(play_item_t *pb);
+                void            submit_streams();
+
             protected:
                 void            do_process(float *dst, size_t samples, uint32_t flags);
 
@@ -118,6 +134,28 @@ namespace lsp
                  */
                 Sample         *gc();
 
+                /**
+                 * Enable streaming of streamed samples: the background reader thread reads the part
+                 * of the streamed sample that is not loaded into memory ahead of the playback position.
+                 * Should not be called from the real-time thread.
+                 *
+                 * @param capacity the capacity of the ring buffer of each playback in samples
+                 * @return true on success
+                 */
+                bool            enable_streaming(size_t capacity);
+
+                /**
+                 * Disable streaming of streamed samples. Streamed samples are played only
+                 * within the part loaded into memory. Should not be called from the real-time thread.
+                 */
+                void            disable_streaming();
+
+                /**
+                 * Check that streaming of streamed samples is enabled
+                 * @return true if streaming of streamed samples is enabled
+                 */
+                inline bool     streaming() const       { return sStreamer.streams() > 0;   }
+
             public:
                 /** Set output gain
                  *
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_UNITS_SAMPLING_SAMPLESTREAMER_H_
+#define LSP_PLUG_IN_DSP_UNITS_SAMPLING_SAMPLESTREAMER_H_
+
+#include <lsp-plug.in/dsp-units/version.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/sampling/helpers/stream.h>
+#include <lsp-plug.in/dsp-units/util/Semaphore.h>
+#include <lsp-plug.in/ipc/Thread.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        /**
+         * Sample streamer: the pool of streams of streamed samples served by the background reader thread.
+         * The reader thread reads the parts of samples that are not loaded into memory to ring buffers
+         * ahead of the playback position.
+         */
+        class LSP_DSP_UNITS_PUBLIC SampleStreamer
+        {
+            private:
+                class Reader: public ipc::Thread
+                {
+                    private:
+                        SampleStreamer *pStreamer;
+
+                    public:
+                        explicit Reader(SampleStreamer *streamer);
+                        virtual ~Reader();
+
+                    public:
+                        virtual status_t run();
+                };
+
+            private:
+                playback::stream_t *vStreams;       // List of streams
+                size_t              nStreams;       // Number of streams
+                size_t              nCapacity;      // Capacity of the ring buffer of each stream
+                float              *vBuffer;        // Temporary buffer of the reader thread
+                Reader             *pReader;        // Background reader thread
+                Semaphore          *pSignal;        // Signal which wakes up the reader thread
+                uint8_t            *pData;          // Allocated data
+
+            protected:
+                bool                serve();
+
+            public:
+                explicit SampleStreamer();
+                SampleStreamer(const SampleStreamer &) = delete;
+                SampleStreamer(SampleStreamer &&) = delete;
+                ~SampleStreamer();
+
+                SampleStreamer & operator = (const SampleStreamer &) = delete;
+                SampleStreamer & operator = (SampleStreamer &&) = delete;
+
+                /**
+                 * Construct sample streamer
+                 */
+                void                construct();
+
+                /**
+                 * Initialize sample streamer and launch the reader thread
+                 * @param streams number of streams
+                 * @param capacity capacity of the ring buffer of each stream in samples
+                 * @return true on success
+                 */
+                bool                init(size_t streams, size_t capacity);
+
+                /**
+                 * Stop the reader thread and close all audio streams. The GC references to samples
+                 * held by streams are not released and should be released by the caller.
+                 */
+                void                stop();
+
+                /**
+                 * Stop the reader thread and destroy sample streamer
+                 */
+                void                destroy();
+
+            public:
+                /**
+                 * Get number of streams
+                 * @return number of streams
+                 */
+                inline size_t       streams() const                 { return nStreams;      }
+
+                /**
+                 * Get capacity of the ring buffer of each stream
+                 * @return capacity of the ring buffer in samples
+                 */
+                inline size_t       capacity() const                { return nCapacity;     }
+
+                /**
+                 * Get the stream
+                 * @param index index of the stream
+                 * @return pointer to the stream or NULL
+                 */
+                inline playback::stream_t *stream(size_t index)     { return (index < nStreams) ? &vStreams[index] : NULL; }
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void                dump(IStateDumper *v) const;
+        };
+
+    } /* namespace dspu */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_DSP_UNITS_SAMPLING_SAMPLESTREAMER_H_ */
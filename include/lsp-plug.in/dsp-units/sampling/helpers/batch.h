@@ -70,17 +70,29 @@ namespace lsp
             LSP_DSP_UNITS_PUBLIC
             void        dump_batch(IStateDumper *v, const char *name, const batch_t *b);
 
+            /**
+             * Render the batch to the destination buffer, functions differ by the playback direction
+             * and the cross-fade type
+             * @param dst destination buffer
+             * @param src sample data
+             * @param b batch to render
+             * @param timestamp the timestamp of the first sample to render
+             * @param samples number of samples to render
+             * @param gain gain of the rendered data
+             * @param origin the position in the sample of the first element of the sample data
+             * @return number of rendered samples
+             */
             LSP_DSP_UNITS_PUBLIC
-            size_t      put_batch_linear_direct(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples);
+            size_t      put_batch_linear_direct(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples, float gain = 1.0f, size_t origin = 0);
 
             LSP_DSP_UNITS_PUBLIC
-            size_t      put_batch_const_power_direct(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples);
+            size_t      put_batch_const_power_direct(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples, float gain = 1.0f, size_t origin = 0);
 
             LSP_DSP_UNITS_PUBLIC
-            size_t      put_batch_linear_reverse(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples);
+            size_t      put_batch_linear_reverse(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples, float gain = 1.0f, size_t origin = 0);
 
             LSP_DSP_UNITS_PUBLIC
-            size_t      put_batch_const_power_reverse(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples);
+            size_t      put_batch_const_power_reverse(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples, float gain = 1.0f, size_t origin = 0);
 
         } /* namespace playback */
     } /* namespace dspu */
@@ -27,6 +27,7 @@
 #include <lsp-plug.in/common/types.h>
 #include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
 #include <lsp-plug.in/dsp-units/sampling/helpers/batch.h>
+#include <lsp-plug.in/dsp-units/sampling/helpers/stream.h>
 #include <lsp-plug.in/dsp-units/sampling/types.h>
 #include <lsp-plug.in/dsp-units/sampling/Sample.h>
 #include <lsp-plug.in/dsp-units/sampling/PlaySettings.h>
@@ -72,6 +73,7 @@ namespace lsp
                 size_t              nXFade;         // The crossfade time in stamples
                 sample_crossfade_t  enXFadeType;    // The crossfade type
                 play_batch_t        sBatch[2];      // Batch queue for execution
+                stream_t           *pStream;        // Stream for the part of the sample that is not loaded into memory
             } playback_t;
 
             LSP_DSP_UNITS_PUBLIC
@@ -87,7 +89,7 @@ namespace lsp
             void        complete_current_batch(playback_t *pb);
 
             LSP_DSP_UNITS_PUBLIC
-            size_t      execute_batch(float *dst, const batch_t *b, playback_t *pb, size_t samples);
+            size_t      execute_batch(float *dst, const batch_t *b, playback_t *pb, size_t samples, float gain = 1.0f);
 
             LSP_DSP_UNITS_PUBLIC
             size_t      apply_fade_out(float *dst, playback_t *pb, size_t samples);
@@ -103,7 +105,7 @@ namespace lsp
             void        start_playback(playback_t *pb, Sample *sample, const PlaySettings *settings);
 
             LSP_DSP_UNITS_PUBLIC
-            size_t      process_playback(float *dst, playback_t *pb, size_t samples);
+            size_t      process_playback(float *dst, playback_t *pb, size_t samples, float gain = 1.0f);
 
             LSP_DSP_UNITS_PUBLIC
             void        stop_playback(playback_t *pb, size_t delay = 0);
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_UNITS_SAMPLING_HELPERS_STREAM_H_
+#define LSP_PLUG_IN_DSP_UNITS_SAMPLING_HELPERS_STREAM_H_
+
+#include <lsp-plug.in/dsp-units/version.h>
+
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/types.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/sampling/Sample.h>
+#include <lsp-plug.in/dsp-units/util/Semaphore.h>
+#include <lsp-plug.in/mm/IInAudioStream.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        namespace playback
+        {
+            /**
+             * Low-level data structure that holds the state of the single channel of the streamed sample.
+             * The real-time thread submits requests to the stream and reads data from the ring buffer,
+             * the reader thread serves requests and fills the ring buffer ahead of the read position.
+             */
+            typedef struct stream_t
+            {
+                // Real-time thread: queued request
+                Sample             *pNext;          // The sample to stream for the queued request, holds the GC reference
+                size_t              nNextChannel;   // The channel to stream for the queued request
+                size_t              nNextSeek;      // The position to stream from for the queued request
+                bool                bNextOpen;      // The queued request needs to re-open the audio stream
+                bool                bQueued;        // The request is queued and waits for submission
+
+                // Real-time thread: submitted request
+                Sample             *pSample;        // The streamed sample, holds the GC reference
+                size_t              nChannel;       // The streamed channel
+                size_t              nSeek;          // The position to start streaming from
+                bool                bOpen;          // The audio stream needs to be re-opened
+                volatile uatomic_t  nRead;          // The lowest position that can be read by the real-time thread
+                volatile uatomic_t  nRequest;       // Serial number of the last submitted request
+
+                // Reader thread
+                mm::IInAudioStream *pIn;            // The audio stream
+                size_t              nChannels;      // Number of channels in the audio stream
+                size_t              nLength;        // The length of the audio stream
+                size_t              nLimit;         // The position to stop reading at
+                volatile uatomic_t  nServed;        // Serial number of the last served request
+                volatile uatomic_t  nEnd;           // The end position of the data available in the ring buffer
+
+                // Ring buffer
+                float              *vData;          // Mirrored ring buffer of (nCapacity * 2) samples
+                size_t              nCapacity;      // Capacity of the ring buffer
+                Semaphore          *pSignal;        // Signal which wakes up the reader thread
+            } stream_t;
+
+            /**
+             * Initialize the stream
+             * @param s stream
+             * @param data mirrored ring buffer of (capacity * 2) samples
+             * @param capacity capacity of the ring buffer
+             * @param signal signal which wakes up the reader thread when the request is submitted
+             *   or the ring buffer can be filled, may be NULL
+             */
+            LSP_DSP_UNITS_PUBLIC
+            void        init_stream(stream_t *s, float *data, size_t capacity, Semaphore *signal);
+
+            /**
+             * Queue the request to stream the sample, should be called from the real-time thread.
+             * @param s stream
+             * @param sample sample to stream with acquired GC reference, NULL to close the stream
+             * @param channel channel to stream
+             * @param position position to start streaming from
+             * @return the sample with GC reference to release or NULL
+             */
+            LSP_DSP_UNITS_PUBLIC
+            Sample     *request_stream(stream_t *s, Sample *sample, size_t channel, size_t position);
+
+            /**
+             * Submit the queued request to the reader thread if the previous request has been served,
+             * should be called from the real-time thread.
+             * @param s stream
+             * @return the sample with GC reference to release or NULL
+             */
+            LSP_DSP_UNITS_PUBLIC
+            Sample     *submit_stream(stream_t *s);
+
+            /**
+             * Get the streamed data, should be called from the real-time thread. If the data is not
+             * available, the stream is re-positioned if needed.
+             * @param s stream
+             * @param position the position of the first sample
+             * @param count number of samples, should not be greater than the capacity of the stream
+             * @param reverse the data is read in reverse direction
+             * @return pointer to the sample at the specified position or NULL if data is not available
+             */
+            LSP_DSP_UNITS_PUBLIC
+            const float *fetch_stream(stream_t *s, size_t position, size_t count, bool reverse);
+
+            /**
+             * Serve the submitted request and read the audio stream to the ring buffer,
+             * should be called from the reader thread.
+             * @param s stream
+             * @param buf temporary buffer for reading interleaved frames
+             * @param size the size of the temporary buffer in samples
+             * @return true if some work has been done
+             */
+            LSP_DSP_UNITS_PUBLIC
+            bool        serve_stream(stream_t *s, float *buf, size_t size);
+
+            /**
+             * Close the audio stream, should be called from the reader thread.
+             * @param s stream
+             */
+            LSP_DSP_UNITS_PUBLIC
+            void        close_stream(stream_t *s);
+
+            LSP_DSP_UNITS_PUBLIC
+            void        dump_stream_plain(IStateDumper *v, const stream_t *s);
+
+            LSP_DSP_UNITS_PUBLIC
+            void        dump_stream(IStateDumper *v, const stream_t *s);
+
+            LSP_DSP_UNITS_PUBLIC
+            void        dump_stream(IStateDumper *v, const char *name, const stream_t *s);
+
+        } /* namespace playback */
+    } /* namespace dspu */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_DSP_UNITS_SAMPLING_HELPERS_STREAM_H_ */
@@ -38,6 +38,29 @@ namespace lsp
          */
         class LSP_DSP_UNITS_PUBLIC AudioStream
         {
+            public:
+                /**
+                 * Direct access to the data of the channel stored in the shared buffer for reading.
+                 * Because of the wrap-around of the shared buffer, data can be split into two
+                 * contiguous parts, the second part is empty if there was no wrap-around.
+                 */
+                typedef struct read_span_t
+                {
+                    const float        *vData[2];       // Pointers to the first and the second part of the data
+                    size_t              vCount[2];      // Number of samples in the first and the second part
+                } read_span_t;
+
+                /**
+                 * Direct access to the data of the channel stored in the shared buffer for writing.
+                 * Because of the wrap-around of the shared buffer, data can be split into two
+                 * contiguous parts, the second part is empty if there was no wrap-around.
+                 */
+                typedef struct write_span_t
+                {
+                    float              *vData[2];       // Pointers to the first and the second part of the data
+                    size_t              vCount[2];      // Number of samples in the first and the second part
+                } write_span_t;
+
             protected:
                 enum stream_flags_t
                 {
@@ -229,6 +252,21 @@ namespace lsp
                  */
                 status_t        read_sanitized(size_t channel, float *dst, size_t samples);
 
+                /**
+                 * Get direct access to the contents of specific channel without copying, RT safe
+                 * Should be called between begin() and end() calls. The read position of the channel
+                 * is advanced by the number of returned samples. If less samples than requested are
+                 * available, the underrun is detected and the caller should treat missing samples
+                 * as silence. The data can be sanitized by the caller while processing it, for example,
+                 * with dsp::sanitize2() instead of dsp::copy().
+                 *
+                 * @param channel number of channel
+                 * @param span pointer to store the direct access to the data
+                 * @param samples number of samples to read
+                 * @return status of operation
+                 */
+                status_t        read_span(size_t channel, read_span_t *span, size_t samples);
+
                 /**
                  * Write contents of the specific channel, RT safe
                  * Should be called between begin() and end() calls
@@ -251,6 +289,20 @@ namespace lsp
                  */
                 status_t        write_sanitized(size_t channel, const float *src, size_t samples);
 
+                /**
+                 * Get direct access to the contents of the specific channel for writing without copying, RT safe
+                 * Should be called between begin() and end() calls. The write position of the channel
+                 * is advanced by the number of returned samples, the caller is responsible for filling
+                 * all returned samples with data before calling end(). The number of returned samples
+                 * is limited by the length of the shared buffer.
+                 *
+                 * @param channel number of channel
+                 * @param span pointer to store the direct access to the data
+                 * @param samples number of samples to write
+                 * @return status of operation
+                 */
+                status_t        write_span(size_t channel, write_span_t *span, size_t samples);
+
                 /**
                  * End I/O operations on the stream, RT safe
                  * @return status of operation
@@ -60,6 +60,8 @@ namespace lsp
                     uint32_t            nSize;              // Number of records
                     uint32_t            nAllocated;         // Number of allocated records
                     volatile uint32_t   nChanges;           // Number of changes
+                    uint32_t            nIndexSize;         // Number of slots in the hash index, power of 2
+                    uint32_t            nFree;              // Head of the list of free records (index + 1), 0 if empty
                 } sh_header_t;
 
                 typedef struct sh_record_t
@@ -68,6 +70,7 @@ namespace lsp
                     uint32_t            nHash;              // Name hash
                     uint32_t            nVersion;           // Version of the record
                     uint32_t            nKeepAlive;         // Keep-alive counter
+                    uint32_t            nNextFree;          // Next record in the list of free records (index + 1), 0 if none
                     char                sName[NAME_BYTES];  // Unique name of the record
                     char                sId[ID_BYTES];      // The identifier of associated shared segment
                 } sh_record_t;
@@ -77,6 +80,7 @@ namespace lsp
                 ipc::SharedMem              hMem;           // Shared memory descriptor
                 sh_header_t                *pHeader;        // Header of the shared buffer
                 sh_record_t                *vRecords;       // Records stored in catalog
+                uint32_t                   *vIndex;         // Open-addressing hash index: record index + 1, 0 for empty slot
                 uint32_t                    nChanges;       // Number of changes
 
             protected:
@@ -87,9 +91,14 @@ namespace lsp
 
                 static status_t     fill_record(Record *dst, const sh_record_t *src);
 
+                static size_t       index_size(size_t entries);
+
                 status_t            create_catalog(const LSPString *name, size_t entries);
                 status_t            open_catalog(const LSPString *name);
-                ssize_t             find_empty() const;
+                ssize_t             alloc_record();
+                void                free_record(size_t index);
+                void                index_insert(size_t index);
+                void                index_remove(size_t index);
                 ssize_t             find_by_name(uint32_t hash, const char *name, size_t len) const;
                 void                mark_changed();
 
@@ -73,6 +73,7 @@ namespace lsp
                     uint32_t    nUserDelay;         // User-defined delay
                     bool        bFreeze;            // Freeze analysis
                     bool        bActive;            // Enable analysis
+                    bool        bDone;              // FFT already has been performed in pair with previous channel
                 } channel_t;
 
             protected:
@@ -102,10 +103,16 @@ namespace lsp
                 channel_t  *vChannels;          // List of channels
                 void       *vData;              // Allocated floating-point data
                 float      *vSigRe;             // Real part of signal
+                float      *vSigIm;             // Imaginary part of signal
                 float      *vFftReIm;           // Buffer for FFT transform (real part)
                 float      *vWindow;            // FFT window
                 float      *vEnvelope;          // FFT envelope
 
+            protected:
+                void        prepare_frame(float *dst, const channel_t *c, size_t delay);
+                void        analyze_single(channel_t *c, size_t delay);
+                void        analyze_pair(channel_t *a, channel_t *b, size_t delay);
+
             public:
                 explicit Analyzer();
                 Analyzer(const Analyzer &) = delete;
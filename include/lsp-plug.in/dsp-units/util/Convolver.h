@@ -24,6 +24,9 @@
 
 #include <lsp-plug.in/dsp-units/version.h>
 #include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/util/Semaphore.h>
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/ipc/Thread.h>
 
 #define CONVOLVER_RANK_MIN          8                               /* buffer of 256 samples (128 effective)    */
 #define CONVOLVER_RANK_MAX          16                              /* buffer of 8192 samples (4096 effective)  */
@@ -34,6 +37,28 @@ namespace lsp
     {
         class LSP_DSP_UNITS_PUBLIC Convolver
         {
+            private:
+                enum tail_state_t
+                {
+                    TS_IDLE,                            // Worker has no job
+                    TS_PENDING,                         // Job has been submitted to the worker
+                    TS_BUSY,                            // Worker is processing the job
+                    TS_DONE                             // Worker has completed the job
+                };
+
+                class TailWorker: public ipc::Thread
+                {
+                    private:
+                        Convolver      *pConv;
+
+                    public:
+                        explicit TailWorker(Convolver *conv);
+                        virtual ~TailWorker();
+
+                    public:
+                        virtual status_t run();
+                };
+
             private:
                 float          *vDataBuffer;            // Buffer for storing convolution tail data
                 float          *vFrame;                 // Pointer to the beginning of the input data frame
@@ -54,6 +79,18 @@ namespace lsp
                 size_t          nBlkInit;               // Initial number of blocks to apply at step # 0
                 float           fBlkCoef;               // The actual coefficient to compute proper block number per formula
 
+                TailWorker     *pWorker;                // Background worker for the long convolution tail
+                Semaphore      *pTailSignal;            // Signal which wakes up the background worker
+                float          *vTailIn;                // Input frame passed to the background worker
+                float          *vTailOut;               // Convolution tail of the input frame computed by the background worker
+                float          *vTailTask;              // Task data of the background worker
+                float          *vTailConv;              // Convolution buffer of the background worker
+                float          *vLateTask;              // Task data of the tail dropped by the late background worker
+                size_t          nLateDone;              // Number of applied blocks of the tail dropped by the late background worker
+                size_t          nTailDataSize;          // Size of the convolution tail computed by the background worker
+                volatile atomic_t nTailState;           // State of the background job
+                bool            bTailPending;           // The background job has been submitted and its result is expected
+
                 uint8_t        *vData;                  // Non-aligned pointer to the whole allocated data
 
             public:
@@ -75,6 +112,11 @@ namespace lsp
                  */
                 void destroy();
 
+            private:
+                void            process_tail();
+                bool            submit_tail();
+                void            collect_tail();
+
             public:
 
                 /** Initialize convolver
@@ -82,9 +124,15 @@ namespace lsp
                  * @param data convolution data
                  * @param count number of samples in convolution
                  * @param rank convolution rank
+                 * @param phase the initial phase of the convolver frame
+                 * @param background compute the constant-size tail blocks (beyond CONVOLVER_RANK_MAX) in the
+                 *   background worker thread, the result of the background job is collected at the next frame
+                 *   boundary, so the real-time thread computes only the head segments and the first tail block.
+                 *   The real-time thread never waits for the worker: if the job is not completed in time,
+                 *   the tail of the frame is computed incrementally by the real-time thread during the next frame
                  * @return true on success
                  */
-                bool init(const float *data, size_t count, size_t rank, float phase);
+                bool init(const float *data, size_t count, size_t rank, float phase, bool background = false);
 
                 /** Process samples
                  *
@@ -106,6 +154,12 @@ namespace lsp
                  */
                 inline size_t rank() const                  { return nRank;         }
 
+                /**
+                 * Check that the convolution tail is computed by the background worker thread
+                 * @return true if the convolution tail is computed by the background worker thread
+                 */
+                inline bool background() const              { return pWorker != NULL; }
+
                 /**
                  * Dump internal state
                  * @param v state dumper
@@ -90,6 +90,8 @@ namespace lsp
                     size_t count);
 
             protected:
+                static void     prune_gain(float *gain, size_t count);
+
                 void            update_band(band_t *b);
 
                 void            sync_binding(size_t band, band_t *b);
@@ -375,6 +377,20 @@ namespace lsp
                  */
                 inline size_t   rank() const                        { return sSplitter.rank();      }
 
+                /**
+                 * Enable or disable pruned synthesis of bands. In this mode the gains of each band
+                 * below -120 dB are zeroed and the inverse transform is computed only for the range
+                 * of frequencies passed by the band, so the cost of narrow bands becomes lower
+                 * @param enable enable flag
+                 */
+                void            set_pruning(bool enable);
+
+                /**
+                 * Check that pruned synthesis of bands is enabled
+                 * @return true if pruned synthesis of bands is enabled
+                 */
+                inline bool     pruning() const                     { return sSplitter.pruning();   }
+
                 /**
                  * Get the latency of the processor
                  * @return the latency
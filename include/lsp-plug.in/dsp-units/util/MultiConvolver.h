@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_UNITS_UTIL_MULTICONVOLVER_H_
+#define LSP_PLUG_IN_DSP_UNITS_UTIL_MULTICONVOLVER_H_
+
+#include <lsp-plug.in/dsp-units/version.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/util/Convolver.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        /**
+         * Multi-channel convolver: performs convolution of N inputs with the matrix of N x M impulse
+         * responses and mixes the result into M outputs. Uses the same partition scheme as the Convolver
+         * but computes the spectrum of each input only once per partition and accumulates the output
+         * spectrum of all inputs before performing single reverse FFT per output.
+         */
+        class LSP_DSP_UNITS_PUBLIC MultiConvolver
+        {
+            private:
+                typedef struct ir_t
+                {
+                    float          *vConv;                  // FFT images of all partitions
+                    float          *vDirect;                // Direct convolution data
+                    size_t          nDirect;                // Size of direct convolution data
+                    size_t          nLevels;                // Number of raising convolution levels
+                    size_t          nBlocks;                // Number of constant-size blocks
+                } ir_t;
+
+                typedef struct input_t
+                {
+                    float          *vFrame;                 // Pointer to the beginning of the input data frame
+                    float          *vFft;                   // Spectrum of the input data for the raising levels
+                    float          *vTask;                  // Spectrum of the previous frame for the tail convolution
+                } input_t;
+
+                typedef struct output_t
+                {
+                    float          *vData;                  // Buffer for storing convolution tail data
+                } output_t;
+
+            private:
+                ir_t           *vIR;                    // Impulse responses, inputs x outputs
+                input_t        *vInputs;                // Input channels
+                output_t       *vOutputs;               // Output channels
+                float          *vFftAcc;                // Accumulated output spectrum
+                float          *vFftTmp;                // Temporary buffer for spectrum
+
+                size_t          nInputs;                // Number of inputs
+                size_t          nOutputs;               // Number of outputs
+                size_t          nDataBufferSize;        // Size of data buffer
+                size_t          nFrameSize;             // Size of input data frame
+                size_t          nFrameOff;              // Offset from the beginning of the input data frame
+                size_t          nConvSize;              // The maximum convolution size in samples
+                size_t          nLevels;                // Number of raising convolution levels
+                size_t          nBlocks;                // Number of constant-size blocks
+                size_t          nBlocksDone;            // Number of applied constant-size blocks
+                size_t          nRank;                  // The actual rank of the convolution
+                size_t          nBlkInit;               // Initial number of blocks to apply at step # 0
+                float           fBlkCoef;               // The actual coefficient to compute proper block number per formula
+
+                uint8_t        *vData;                  // Non-aligned pointer to the whole allocated data
+
+            private:
+                static void     parse(float *dst, const float *src, size_t count, size_t rank);
+                void            apply(size_t output, size_t offset, size_t part, size_t rank, bool tail);
+
+            public:
+                explicit MultiConvolver();
+                MultiConvolver(const MultiConvolver &) = delete;
+                MultiConvolver(MultiConvolver &&) = delete;
+                ~MultiConvolver();
+
+                MultiConvolver & operator = (const MultiConvolver &) = delete;
+                MultiConvolver & operator = (MultiConvolver &&) = delete;
+
+                /** Construct the convolver
+                 *
+                 */
+                void construct();
+
+                /** Destroy convolver
+                 *
+                 */
+                void destroy();
+
+            public:
+                /** Initialize convolver
+                 *
+                 * @param data matrix of impulse responses, the impulse response that maps input i to
+                 *   the output o is stored at index i * outputs + o, NULL pointer means no routing
+                 * @param count matrix of impulse response lengths in samples, same layout as data
+                 * @param inputs number of inputs
+                 * @param outputs number of outputs
+                 * @param rank convolution rank
+                 * @param phase the initial phase of the convolver frame
+                 * @return true on success
+                 */
+                bool init(const float * const *data, const size_t *count, size_t inputs, size_t outputs, size_t rank, float phase);
+
+                /** Process samples
+                 *
+                 * @param dst array of destination buffers, one per output
+                 * @param src array of source buffers, one per input
+                 * @param count number of samples to process
+                 */
+                void process(float * const *dst, const float * const *src, size_t count);
+
+                /** Get the maximum convolution size in samples
+                 *
+                 * @return maximum convolution size in samples
+                 */
+                inline size_t data_size() const             { return nConvSize;     }
+
+                /**
+                 * Get actual convolution rank of the convolver
+                 * @return convolution rank
+                 */
+                inline size_t rank() const                  { return nRank;         }
+
+                /**
+                 * Get number of inputs
+                 * @return number of inputs
+                 */
+                inline size_t inputs() const                { return nInputs;       }
+
+                /**
+                 * Get number of outputs
+                 * @return number of outputs
+                 */
+                inline size_t outputs() const               { return nOutputs;      }
+
+                /**
+                 * Dump internal state
+                 * @param v state dumper
+                 */
+                void dump(IStateDumper *v) const;
+        };
+
+    } /* namespace dspu */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_DSP_UNITS_UTIL_MULTICONVOLVER_H_ */
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_UNITS_UTIL_MULTIDYNAMICDELAY_H_
+#define LSP_PLUG_IN_DSP_UNITS_UTIL_MULTIDYNAMICDELAY_H_
+
+#include <lsp-plug.in/dsp-units/version.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/common/status.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        /**
+         * Interpolation of the fractional delay
+         */
+        enum delay_interp_t
+        {
+            DI_NONE,            // No interpolation, the delay is truncated to integer value
+            DI_LINEAR,          // Linear interpolation between two adjacent samples
+            DI_CUBIC,           // Cubic Hermite (Catmull-Rom) interpolation, the minimum delay is 1 sample
+            DI_ALLPASS          // First-order all-pass interpolation
+        };
+
+        /**
+         * Multi-voice Dynamic Delay: set of taps with varying in time delay which
+         * read data from the single shared ring buffer. The ring buffer is mirrored
+         * (each sample is stored twice) so the taps do not need any wrap-around checks.
+         * The feedback signal is formed as a sum of all voices multiplied by the feedback
+         * gain and is added to the input signal.
+         */
+        class LSP_DSP_UNITS_PUBLIC MultiDynamicDelay
+        {
+            protected:
+                typedef struct voice_t
+                {
+                    float           fAllpass;       // The previous output of the all-pass interpolator
+                } voice_t;
+
+            protected:
+                float          *vBuffer;        // Mirrored ring buffer of 2*nCapacity samples
+                voice_t        *vVoices;        // List of voices
+                uint32_t        nVoices;        // Number of voices
+                uint32_t        nHead;          // Current write position
+                uint32_t        nCapacity;      // Capacity of the ring buffer
+                uint32_t        nMaxDelay;      // Maximum delay
+                delay_interp_t  enInterp;       // Interpolation type
+                uint8_t        *pData;          // Allocated data
+
+            protected:
+                void        write_input(const float *src, size_t count);
+                void        process_voice(float *dst, const float *delay, voice_t *v, size_t head, size_t count);
+                void        process_feedback(float * const *out, const float *in,
+                                    const float * const *delay, const float *fgain,
+                                    size_t offset, size_t count);
+
+            public:
+                explicit MultiDynamicDelay();
+                MultiDynamicDelay(const MultiDynamicDelay &) = delete;
+                MultiDynamicDelay(MultiDynamicDelay &&) = delete;
+                ~MultiDynamicDelay();
+
+                MultiDynamicDelay & operator = (const MultiDynamicDelay &) = delete;
+                MultiDynamicDelay & operator = (MultiDynamicDelay &&) = delete;
+
+                void        construct();
+                void        destroy();
+
+            public:
+                /**
+                 * Initialize delay
+                 * @param voices number of voices
+                 * @param max_size maximum delay size in samples
+                 * @return status of operation
+                 */
+                status_t    init(size_t voices, size_t max_size);
+
+                /**
+                 * Get number of voices
+                 * @return number of voices
+                 */
+                inline size_t voices() const                { return nVoices;       }
+
+                /**
+                 * Obtain the maximum possible value for the delay
+                 * @return the maximum possible value for the delay in samples
+                 */
+                inline size_t max_delay() const             { return nMaxDelay;     }
+
+                /**
+                 * Obtain the overall delay capacity
+                 * @return the overall delay capacity in samples
+                 */
+                inline size_t capacity() const              { return nCapacity;     }
+
+                /**
+                 * Set interpolation of the fractional delay
+                 * @param interp interpolation type
+                 */
+                void        set_interpolation(delay_interp_t interp);
+
+                /**
+                 * Get interpolation of the fractional delay
+                 * @return interpolation type
+                 */
+                inline delay_interp_t interpolation() const { return enInterp;      }
+
+                /**
+                 * Process the signal using dynamic settings of delay and feedback
+                 * @param out list of output buffers, one per voice
+                 * @param in input buffer
+                 * @param delay list of delay values in samples, one buffer per voice
+                 * @param fgain feedback gain values applied to the sum of all voices, can be NULL
+                 * @param samples number of samples to process
+                 */
+                void        process(float * const *out, const float *in,
+                                    const float * const *delay, const float *fgain,
+                                    size_t samples);
+
+                /**
+                 * Clear delay state
+                 */
+                void        clear();
+
+                /**
+                 * Dump internal state
+                 * @param v state dumper
+                 */
+                void        dump(IStateDumper *v) const;
+        };
+
+    } /* namespace dspu */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_DSP_UNITS_UTIL_MULTIDYNAMICDELAY_H_ */
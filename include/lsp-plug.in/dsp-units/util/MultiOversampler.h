@@ -0,0 +1,279 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_UNITS_UTIL_MULTIOVERSAMPLER_H_
+#define LSP_PLUG_IN_DSP_UNITS_UTIL_MULTIOVERSAMPLER_H_
+
+#include <lsp-plug.in/dsp-units/version.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/filters/Filter.h>
+#include <lsp-plug.in/dsp-units/filters/FilterBank.h>
+#include <lsp-plug.in/dsp-units/filters/MultiFilterBank.h>
+#include <lsp-plug.in/dsp-units/util/Oversampler.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        /** Callback to perform processing of multi-channel oversampled signal
+         *
+         */
+        class LSP_DSP_UNITS_PUBLIC IMultiOversamplerCallback
+        {
+            public:
+                /** Virtual destructor
+                 *
+                 */
+                virtual ~IMultiOversamplerCallback();
+
+                /** Processing routine
+                 *
+                 * @param out array of output buffers of samples size, one per channel
+                 * @param in array of input buffers of samples size, one per channel
+                 * @param channels number of channels
+                 * @param samples number of samples to process
+                 */
+                virtual void process(float * const *out, const float * const *in, size_t channels, size_t samples);
+        };
+
+        /**
+         * Multi-channel oversampler callback routine
+         * @param out array of output buffers (oversampled), one per channel
+         * @param in array of input buffers (oversampled), one per channel
+         * @param channels number of channels
+         * @param samples number of oversampled samples in each buffer
+         * @param arg additional argument which is passed to the routine
+         */
+        typedef void (*multi_oversampler_callback_t)(float * const *out, const float * const *in, size_t channels, size_t samples, void *arg);
+
+        constexpr size_t MULTI_OVERSAMPLER_MAX_CHANNELS     = 8;
+
+        /** Multi-channel oversampler: performs oversampling of up to 8 channels with the same settings
+         * and calls the processing routine once per block for all channels. The oversampled data of each
+         * channel is stored in a separate buffer, the anti-aliasing IIR filter is computed once and applied
+         * to all channels at once by the MultiFilterBank which holds different channels in the SIMD lanes.
+         * For less than MULTI_FILTERBANK_MIN_CHANNELS channels the filter is applied by the filter bank
+         * of each channel.
+         */
+        class LSP_DSP_UNITS_PUBLIC MultiOversampler
+        {
+            protected:
+                typedef void (*resample_func_t)(float *dst, const float *src, size_t count);
+
+                enum update_t
+                {
+                    UP_MODE         = 1 << 0,
+                    UP_SAMPLE_RATE  = 1 << 2,
+                    UP_OTHER        = 1 << 3,
+
+                    UP_ALL          = UP_MODE | UP_OTHER | UP_SAMPLE_RATE
+                };
+
+                typedef struct channel_t
+                {
+                    FilterBank              sBank;              // Anti-aliasing filter of the channel for few channels
+                    float                  *vUpBuffer;          // Buffer for oversampled data
+                    float                  *vFirBuffer;         // Polyphase FIR filter history buffer
+                } channel_t;
+
+            protected:
+                IMultiOversamplerCallback  *pCallback;
+                resample_func_t             pUpFunc;
+                resample_func_t             pDownFunc;
+                size_t                      nChannels;
+                size_t                      nRatio;
+                size_t                      nUpHead;
+                size_t                      nMode;
+                size_t                      nSampleRate;
+                size_t                      nUpdate;
+                size_t                      nFilterType;        // Type of the anti-aliasing filter
+                size_t                      nFirLength;         // Length of the FIR filter kernel, 0 if FIR filter is not used
+                float                      *vFirKernel;         // Polyphase FIR filter kernel
+                Filter                      sFilter;            // Anti-aliasing filter, computes the filter chains
+                FilterBank                  sFilterBank;        // Filter chains of the anti-aliasing filter
+                MultiFilterBank             sBank;              // Anti-aliasing filter applied to all channels at once
+                channel_t                   vChannels[MULTI_OVERSAMPLER_MAX_CHANNELS];
+                float                      *vUpPtr[MULTI_OVERSAMPLER_MAX_CHANNELS];
+                uint8_t                    *pData;
+                bool                        bFilter;
+                bool                        bLanes;             // Use the multi-channel filter bank
+
+            protected:
+                size_t                      upsample_block(const float * const *src, size_t offset, size_t samples);
+                void                        downsample_block(float * const *dst, size_t offset, size_t samples);
+
+            public:
+                explicit MultiOversampler();
+                MultiOversampler(const MultiOversampler &) = delete;
+                MultiOversampler(MultiOversampler &&) = delete;
+                ~MultiOversampler();
+
+                MultiOversampler & operator = (const MultiOversampler &) = delete;
+                MultiOversampler & operator = (MultiOversampler &&) = delete;
+
+                void construct();
+
+            public:
+                /** Initialize oversampler
+                 *
+                 * @param channels number of channels, should be between 1 and MULTI_OVERSAMPLER_MAX_CHANNELS
+                 * @return true on success
+                 */
+                bool init(size_t channels);
+
+                /** Destroy oversampler
+                 *
+                 */
+                void destroy();
+
+                /**
+                 * Get number of channels
+                 * @return number of channels
+                 */
+                inline size_t channels() const              { return nChannels;     }
+
+                /** Set sample rate
+                 *
+                 * @param sr sample rate
+                 */
+                void set_sample_rate(size_t sr);
+
+                /** Set oversampling callback
+                 *
+                 * @param callback calback to call on process()
+                 */
+                inline void set_callback(IMultiOversamplerCallback *callback)
+                {
+                    pCallback       = callback;
+                }
+
+                /** Set oversampling mode
+                 *
+                 * @param mode oversampling mode
+                 */
+                void set_mode(over_mode_t mode);
+
+                /**
+                 * Get oversampling mode
+                 * @return current oversampling mode
+                 */
+                inline over_mode_t mode() const             { return over_mode_t(nMode); }
+
+                /** Enable/disable low-pass filter when performing downsampling
+                 *
+                 * @param filter enables/diables low-pass filter
+                 */
+                inline void set_filtering(bool filter)
+                {
+                    if (bFilter == filter)
+                        return;
+                    bFilter     = filter;
+                    nUpdate   |= UP_MODE;
+                }
+
+                /**
+                 * Get filtering option
+                 * @return filtering option
+                 */
+                inline bool filtering() const               { return bFilter;       }
+
+                /** Set the type of the anti-aliasing filter applied when performing downsampling
+                 *
+                 * @param type type of the anti-aliasing filter
+                 */
+                void set_filter_type(over_filter_t type);
+
+                /**
+                 * Get the type of the anti-aliasing filter
+                 * @return type of the anti-aliasing filter
+                 */
+                inline over_filter_t filter_type() const    { return over_filter_t(nFilterType); }
+
+                /** Check that module needs re-configuration
+                 *
+                 * @return true if needs reconfiguration
+                 */
+                inline bool modified() const                { return nUpdate;       }
+
+                /** Get current oversampling multiplier
+                 *
+                 * @return current oversampling multiplier
+                 */
+                inline size_t get_oversampling() const      { return nRatio;        }
+
+                /** Update settings
+                 *
+                 */
+                void update_settings();
+
+                /** Perform processing of the signal
+                 *
+                 * @param dst array of destination buffers of samples size, one per channel
+                 * @param src array of source buffers of samples size, one per channel
+                 * @param samples number of samples to process
+                 * @param callback callback to handle buffers (optional, can be NULL)
+                 */
+                void process(float * const *dst, const float * const *src, size_t samples, IMultiOversamplerCallback *callback);
+
+                /** Perform processing of the signal
+                 *
+                 * @param dst array of destination buffers of samples size, one per channel
+                 * @param src array of source buffers of samples size, one per channel
+                 * @param samples number of samples to process
+                 * @param callback callback routine that processes the oversampled data (optional, can be NULL)
+                 * @param arg additional argument passed to the callback routine (optional, can be NULL)
+                 */
+                void process(float * const *dst, const float * const *src, size_t samples, multi_oversampler_callback_t callback, void *arg);
+
+                /** Perform processing of the signal
+                 *
+                 * @param dst array of destination buffers of samples size, one per channel
+                 * @param src array of source buffers of samples size, one per channel
+                 * @param samples number of samples to process
+                 */
+                inline void process(float * const *dst, const float * const *src, size_t samples)
+                {
+                    process(dst, src, samples, pCallback);
+                }
+
+                /**
+                 * Get oversampler latency
+                 * @return oversampler latency in normal (non-oversampled) samples
+                 */
+                size_t latency() const;
+
+                /**
+                 * Get maximum possible latency
+                 * @return maximum possible latency
+                 */
+                inline size_t max_latency() const           { return OVERSAMPLER_MAX_LATENCY; }
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void dump(IStateDumper *v) const;
+        };
+
+    } /* namespace dspu */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_DSP_UNITS_UTIL_MULTIOVERSAMPLER_H_ */
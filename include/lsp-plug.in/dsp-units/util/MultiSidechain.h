@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_UNITS_UTIL_MULTISIDECHAIN_H_
+#define LSP_PLUG_IN_DSP_UNITS_UTIL_MULTISIDECHAIN_H_
+
+#include <lsp-plug.in/dsp-units/version.h>
+#include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/util/Sidechain.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        /**
+         * Multi-lane sidechain: computes the detector function for a set of mono lanes
+         * (for example, bands of multiple channels) at once. All lanes share the same
+         * sidechain mode while reactivity and pre-amplification gain can be set per lane.
+         *
+         * The RMS and Uniform windows are computed without running subtraction: the window
+         * sum is formed as the sum of the suffix of the previous window and the prefix sum of
+         * the current window, so the result does not drift and does not need periodic refresh.
+         * The LPF mode is computed for all lanes in parallel over the interleaved data.
+         */
+        class LSP_DSP_UNITS_PUBLIC MultiSidechain
+        {
+            protected:
+                enum flags_t
+                {
+                    MSF_UPDATE      = 1 << 0,
+                    MSF_CLEAR       = 1 << 1
+                };
+
+                typedef struct lane_t
+                {
+                    float          *vHistory;           // History of processed values
+                    float          *vSuffix;            // Suffix sums of the previous window
+                    float           fReactivity;        // Reactivity (in time)
+                    float           fGain;              // Pre-amplification gain
+                    float           fSum;               // Sum of values of the current window
+                    uint32_t        nWindow;            // Window size (in samples)
+                    uint32_t        nPhase;             // Number of values in the current window
+                    uint32_t        nFlags;             // Flags
+                } lane_t;
+
+            protected:
+                lane_t         *vLanes;                 // List of lanes
+                float          *vTau;                   // Tau for LPF, one per lane
+                float          *vValue;                 // LPF value, one per lane
+                float          *vTemp;                  // Temporary buffer for interleaved data
+                size_t          nLanes;                 // Number of lanes
+                size_t          nSampleRate;            // Sample rate
+                size_t          nCapacity;              // Capacity of the history buffer
+                size_t          nMaxWindow;             // Maximum window size
+                size_t          nHead;                  // Position of the history head
+                float           fMaxReactivity;         // Maximum reactivity
+                uint32_t        nMode;                  // Sidechain mode
+                uint32_t        nFlags;                 // Flags
+                uint8_t        *pData;                  // Allocated data
+                uint8_t        *pVarData;               // Allocated data that depends on sample rate
+
+            protected:
+                void            update_settings();
+                void            rebuild_window(lane_t *l, size_t head);
+                void            process_window(lane_t *l, float *dst, size_t count, size_t head);
+                void            process_lpf(float * const *out, size_t offset, size_t samples);
+
+            public:
+                explicit MultiSidechain();
+                MultiSidechain(const MultiSidechain &) = delete;
+                MultiSidechain(MultiSidechain &&) = delete;
+                ~MultiSidechain();
+
+                MultiSidechain & operator = (const MultiSidechain &) = delete;
+                MultiSidechain & operator = (MultiSidechain &&) = delete;
+
+                /**
+                 * Construct the object
+                 */
+                void            construct();
+
+                /** Initialize sidechain
+                 *
+                 * @param lanes number of lanes
+                 * @param max_reactivity maximum reactivity
+                 * @return true on success
+                 */
+                bool            init(size_t lanes, float max_reactivity);
+
+                /** Destroy sidechain
+                 *
+                 */
+                void            destroy();
+
+            public:
+                /**
+                 * Get number of lanes
+                 * @return number of lanes
+                 */
+                inline size_t   lanes() const                       { return nLanes;    }
+
+                /** Set sample rate
+                 *
+                 * @param sr sample rate
+                 * @return true on success
+                 */
+                bool            set_sample_rate(size_t sr);
+
+                /** Set sidechain reactivity of the lane
+                 *
+                 * @param lane lane index
+                 * @param reactivity sidechain reactivity
+                 */
+                void            set_reactivity(size_t lane, float reactivity);
+
+                /** Set sidechain reactivity of all lanes
+                 *
+                 * @param reactivity sidechain reactivity
+                 */
+                void            set_reactivity(float reactivity);
+
+                /** Set sidechain mode for all lanes
+                 *
+                 * @param mode sidechain mode
+                 */
+                void            set_mode(sidechain_mode_t mode);
+
+                /**
+                 * Get sidechain mode
+                 * @return sidechain mode
+                 */
+                inline sidechain_mode_t mode() const                { return sidechain_mode_t(nMode); }
+
+                /** Set-up pre-amplification gain of the lane
+                 *
+                 * @param lane lane index
+                 * @param gain sidechain pre-amplification gain
+                 */
+                void            set_gain(size_t lane, float gain);
+
+                /** Get pre-amplification gain of the lane
+                 *
+                 * @param lane lane index
+                 * @return pre-amplification gain
+                 */
+                float           get_gain(size_t lane) const;
+
+                /**
+                 * Mark the sidechain state for clear
+                 */
+                void            clear();
+
+                /** Process sidechain signal
+                 *
+                 * @param out array of output buffers, one per lane
+                 * @param in array of input buffers, one per lane, NULL buffer is treated as silence
+                 * @param samples number of samples to process
+                 */
+                void            process(float * const *out, const float * const *in, size_t samples);
+
+                /**
+                 * Dump the state
+                 * @param v state dumper
+                 */
+                void            dump(IStateDumper *v) const;
+        };
+
+    } /* namespace dspu */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_DSP_UNITS_UTIL_MULTISIDECHAIN_H_ */
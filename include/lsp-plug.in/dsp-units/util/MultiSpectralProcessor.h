@@ -24,8 +24,11 @@
 
 #include <lsp-plug.in/dsp-units/version.h>
 
+#include <lsp-plug.in/common/atomic.h>
 #include <lsp-plug.in/common/status.h>
 #include <lsp-plug.in/dsp-units/iface/IStateDumper.h>
+#include <lsp-plug.in/dsp-units/util/Semaphore.h>
+#include <lsp-plug.in/ipc/Thread.h>
 
 namespace lsp
 {
@@ -40,6 +43,21 @@ namespace lsp
          */
         typedef void (* multi_spectral_processor_func_t)(void *object, void *subject, float * const * spectrum, size_t rank);
 
+        /**
+         * Batched transform function, performs in-place FFT of all passed buffers at once.
+         * The result should match the result of dsp::packed_direct_fft() and dsp::packed_reverse_fft()
+         * called for each buffer, including the normalization of the reverse transform.
+         * @param object the object that handles callback
+         * @param buf the list of buffers to transform (packed complex numbers), each buffer is aligned
+         *   and the buffers of the neighbour channels are placed at the same distance from each other
+         * @param count number of buffers to transform
+         * @param rank the overall rank of the FFT transform (log2(size))
+         * @param inverse perform reverse transform instead of direct transform
+         */
+        typedef void (* multi_spectral_transform_func_t)(void *object, float * const * buf, size_t count, size_t rank, bool inverse);
+
+        constexpr size_t MULTI_SPECTRAL_MAX_WORKERS     = 8;
+
         /**
          * Multi-Spectral processor class, performs multi-channel spectral transform of the input signal
          * and launches callback function to process the signal spectrum
@@ -54,10 +72,60 @@ namespace lsp
                     float                  *pInBuf;     // Input buffer
                     float                  *pOutBuf;    // Output buffer
                     float                  *pFftBuf;    // FFT buffer
+                    float                  *pJobBuf;    // Buffer of the job passed to the worker threads
+                    float                  *pResult;    // Buffer which holds the result of the last job
+                    volatile atomic_t       nState;     // State of the job passed to the worker threads
                 } channel_t;
 
+                enum job_t
+                {
+                    JOB_NONE,                           // No job
+                    JOB_DIRECT,                         // Window and perform direct FFT of the channel
+                    JOB_REVERSE                         // Perform reverse FFT of the channel and apply it to the output buffer
+                };
+
+                enum channel_state_t
+                {
+                    CS_IDLE,                            // The job buffer is owned by the caller thread
+                    CS_PENDING,                         // The job has been passed to the worker threads
+                    CS_BUSY,                            // The job is processed by the worker thread
+                    CS_DONE,                            // The job has been completed by the worker thread
+                    CS_STOLEN                           // The job has been taken over by the caller thread,
+                                                        // the worker still owns the job buffer
+                };
+
+                class FrameWorker: public ipc::Thread
+                {
+                    private:
+                        MultiSpectralProcessor *pProc;
+
+                    public:
+                        explicit FrameWorker(MultiSpectralProcessor *proc);
+                        FrameWorker(const FrameWorker &) = delete;
+                        FrameWorker(FrameWorker &&) = delete;
+                        virtual ~FrameWorker() override;
+
+                        FrameWorker & operator = (const FrameWorker &) = delete;
+                        FrameWorker & operator = (FrameWorker &&) = delete;
+
+                    public:
+                        virtual status_t run() override;
+                };
+
             protected:
                 void                        clear_buffers();
+                void                        stop_workers();
+                bool                        claim_job(uatomic_t *job);
+                void                        process_job(uatomic_t job);
+                bool                        run_job();
+                void                        execute(job_t job);
+                void                        execute_parallel(job_t job);
+                void                        process_channel(job_t job, size_t index);
+                void                        transform(job_t job);
+                void                        apply_frame(channel_t *c, const float *src);
+
+                static void                 transform_buffer(job_t job, float *buf, size_t rank);
+                static uatomic_t            make_job(job_t type, size_t rank, size_t index);
 
             protected:
                 uint32_t                    nChannels;  // Number of channels
@@ -66,6 +134,7 @@ namespace lsp
                 uint32_t                    nOffset;    // Read/Write offset
                 channel_t                  *vChannels;  // Channels
                 float                     **vFftBuf;    // FFT transform buffers
+                float                     **vXfBuf;     // Buffers passed to the batched transform
                 float                      *pWnd;       // Window function
                 float                       fPhase;     // Phase
                 bool                        bUpdate;    // Update flag
@@ -74,6 +143,14 @@ namespace lsp
                 multi_spectral_processor_func_t pFunc;  // Function
                 void                       *pObject;    // Object to operate
                 void                       *pSubject;   // Subject to operate
+                multi_spectral_transform_func_t pXfFunc;    // Batched transform function
+                void                       *pXfObject;  // Object to pass to the batched transform function
+
+                // Frame workers
+                FrameWorker                *vWorkers[MULTI_SPECTRAL_MAX_WORKERS];   // Worker threads
+                size_t                      nWorkers;   // Number of running worker threads
+                Semaphore                  *pSignal;    // Signal which wakes up the worker threads
+                volatile uatomic_t          nJob;       // Current job: rank, type and index of the next channel
 
                 // Misc
                 uint8_t                    *pData;      // Data buffer
@@ -96,9 +173,14 @@ namespace lsp
                  * Initialize spectral processor
                  * @param channels number of channels
                  * @param max_rank maximum FFT rank
+                 * @param workers number of worker threads which perform the per-channel direct and reverse
+                 *   transforms of the frame together with the caller thread, should be not greater than
+                 *   MULTI_SPECTRAL_MAX_WORKERS, zero means that all transforms are performed by the caller thread.
+                 *   The caller thread never waits for the workers: it takes over the transforms which have
+                 *   not been completed by the workers when it runs out of its own part of the frame
                  * @return status of operation
                  */
-                bool            init(size_t channels, size_t max_rank);
+                bool            init(size_t channels, size_t max_rank, size_t workers = 0);
 
                 /**
                  * Destroy spectral processor
@@ -119,6 +201,28 @@ namespace lsp
                  */
                 void            unbind_handler();
 
+                /**
+                 * Bind batched transform function. If bound, the processor calls it once per frame for
+                 * direct and once per frame for reverse transform of all active channels instead of
+                 * transforming the channels one by one, so the function can process multiple channels
+                 * at once using SIMD-friendly layout of data. Windowing and overlap-add are still
+                 * performed by the processor.
+                 * @param func function to call
+                 * @param object the target object to pass to the function
+                 */
+                void            bind_transform(multi_spectral_transform_func_t func, void *object);
+
+                /**
+                 * Unbind batched transform function
+                 */
+                void            unbind_transform();
+
+                /**
+                 * Get number of running worker threads
+                 * @return number of running worker threads
+                 */
+                inline size_t   workers() const             { return nWorkers;          }
+
                 /**
                  * Bind buffers to the channel.
                  * @param index index of the channel
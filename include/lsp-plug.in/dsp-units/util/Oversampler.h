@@ -99,15 +99,39 @@ namespace lsp
             OM_LANCZOS_8X24BIT,
         };
 
-        constexpr size_t OVERSAMPLER_MAX_LATENCY        = 62;
+        /**
+         * Type of the anti-aliasing filter applied when performing downsampling
+         */
+        enum over_filter_t
+        {
+            OF_IIR,                 // IIR filter applied to each oversampled sample
+            OF_FIR_LINEAR           // Linear-phase polyphase FIR filter which computes only decimated samples
+        };
+
+        /*
+         * The linear-phase FIR filter is a Kaiser-windowed (beta = 8) sinc filter designed
+         * for the following specification relative to the output sample rate Fs:
+         *   - pass band 0 .. 0.42 Fs with the ripple less than 0.001 dB;
+         *   - stop band 0.58 Fs .. Nyquist frequency of the oversampled signal with at least 80 dB attenuation.
+         * The signal between 0.5 Fs and 0.58 Fs folds back only into the 0.42 Fs .. 0.5 Fs band
+         * and does not affect the pass band.
+         */
+        constexpr size_t OVERSAMPLER_FIR_PHASE_TAPS     = 32;   // Number of taps per each phase of polyphase FIR filter
+        constexpr size_t OVERSAMPLER_FIR_MAX_LENGTH     = 8 * OVERSAMPLER_FIR_PHASE_TAPS + 1;
+        constexpr size_t OVERSAMPLER_FIR_LATENCY        = OVERSAMPLER_FIR_PHASE_TAPS / 2;
+        constexpr size_t OVERSAMPLER_MAX_LATENCY        = 62 + OVERSAMPLER_FIR_LATENCY;
 
         /** Oversampler class
          *
          */
         class LSP_DSP_UNITS_PUBLIC Oversampler
         {
+            private:
+                friend class MultiOversampler;
+
             protected:
                 typedef void (*resample_func_t)(float *dst, const float *src, size_t count);
+                typedef void (*decimate_func_t)(Oversampler *self, float *dst, const float *src, size_t samples);
 
             protected:
                 enum update_t
@@ -123,9 +147,16 @@ namespace lsp
                 IOversamplerCallback   *pCallback;
                 float                  *fUpBuffer;
                 float                  *fDownBuffer;
+                float                  *vFirKernel;         // Polyphase FIR filter kernel
+                float                  *vFirBuffer;         // Polyphase FIR filter history buffer
                 resample_func_t         pFunc;
+                resample_func_t         pDownFunc;          // Decimation routine
+                decimate_func_t         pDecimate;          // Anti-aliasing filter and decimation routine, selected by update_settings()
                 size_t                  nUpHead;
+                size_t                  nRatio;             // Oversampling ratio
                 size_t                  nMode;
+                size_t                  nFilterType;        // Type of the anti-aliasing filter
+                size_t                  nFirLength;         // Length of the FIR filter kernel, 0 if FIR filter is not used
                 size_t                  nSampleRate;
                 size_t                  nUpdate;
                 Filter                  sFilter;
@@ -134,6 +165,19 @@ namespace lsp
 
             protected:
                 static resample_func_t  get_function(size_t mode);
+                static resample_func_t  get_down_function(size_t ratio);
+                static size_t           get_ratio(size_t mode);
+                static size_t           get_latency(size_t mode);
+                static size_t           fir_buffer_size();
+                static size_t           build_fir_kernel(float *dst, size_t ratio);
+                static void             fir_downsample(float *dst, float *buf, const float *src,
+                                            const float *kernel, size_t length, size_t ratio, size_t samples);
+
+                static void             decimate_plain(Oversampler *self, float *dst, const float *src, size_t samples);
+                static void             decimate_iir(Oversampler *self, float *dst, const float *src, size_t samples);
+                static void             decimate_fir(Oversampler *self, float *dst, const float *src, size_t samples);
+
+                void                    check_up_buffer();
 
             public:
                 explicit Oversampler();
@@ -202,6 +246,20 @@ namespace lsp
                  */
                 bool filtering() const;
 
+                /** Set the type of the anti-aliasing filter applied when performing downsampling.
+                 * The polyphase FIR filter computes only the samples that are kept after decimation
+                 * and introduces additional OVERSAMPLER_FIR_LATENCY samples of latency.
+                 *
+                 * @param type type of the anti-aliasing filter
+                 */
+                void set_filter_type(over_filter_t type);
+
+                /**
+                 * Get the type of the anti-aliasing filter
+                 * @return type of the anti-aliasing filter
+                 */
+                inline over_filter_t filter_type() const { return over_filter_t(nFilterType); }
+
                 /** Check that module needs re-configuration
                  *
                  * @return true if needs reconfiguration
@@ -275,7 +333,8 @@ namespace lsp
                 size_t latency() const;
 
                 /**
-                 * Get maximum possible latency
+                 * Get maximum possible latency. Includes OVERSAMPLER_FIR_LATENCY samples
+                 * of the linear-phase FIR filter
                  * @return maximum possible latency
                  */
                 inline size_t max_latency() const       { return OVERSAMPLER_MAX_LATENCY; }
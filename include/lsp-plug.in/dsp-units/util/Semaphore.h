@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef LSP_PLUG_IN_DSP_UNITS_UTIL_SEMAPHORE_H_
+#define LSP_PLUG_IN_DSP_UNITS_UTIL_SEMAPHORE_H_
+
+#include <lsp-plug.in/dsp-units/version.h>
+#include <lsp-plug.in/common/types.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        /**
+         * Counting semaphore used for waking up the worker threads. The post() method
+         * never blocks and can be called from the real-time thread, the wait() methods
+         * block the caller until the semaphore is posted.
+         */
+        class LSP_DSP_UNITS_PUBLIC Semaphore
+        {
+            protected:
+                void               *hHandle;        // Native semaphore handle
+
+            public:
+                explicit Semaphore();
+                Semaphore(const Semaphore &) = delete;
+                Semaphore(Semaphore &&) = delete;
+                ~Semaphore();
+
+                Semaphore & operator = (const Semaphore &) = delete;
+                Semaphore & operator = (Semaphore &&) = delete;
+
+            public:
+                /**
+                 * Check that the semaphore has been successfully created
+                 * @return true if the semaphore has been successfully created
+                 */
+                inline bool     valid() const           { return hHandle != NULL;   }
+
+                /**
+                 * Increment the semaphore and wake up one of the waiting threads, does not block
+                 */
+                void            post();
+
+                /**
+                 * Increment the semaphore multiple times, does not block
+                 * @param count number of increments
+                 */
+                void            post(size_t count);
+
+                /**
+                 * Wait until the semaphore is posted and decrement it
+                 * @return true if the semaphore has been decremented
+                 */
+                bool            wait();
+
+                /**
+                 * Wait until the semaphore is posted and decrement it
+                 * @param millis maximum time to wait in milliseconds
+                 * @return true if the semaphore has been decremented, false on timeout
+                 */
+                bool            wait(size_t millis);
+
+                /**
+                 * Decrement the semaphore if it is posted, does not block
+                 * @return true if the semaphore has been decremented
+                 */
+                bool            try_wait();
+        };
+
+    } /* namespace dspu */
+} /* namespace lsp */
+
+#endif /* LSP_PLUG_IN_DSP_UNITS_UTIL_SEMAPHORE_H_ */
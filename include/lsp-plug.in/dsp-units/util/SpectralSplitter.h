@@ -88,15 +88,23 @@ namespace lsp
                 float                      *vInBuf;         // Input buffer
                 float                      *vFftBuf;        // FFT buffer
                 float                      *vFftTmp;        // Temporary FFT buffer
+                float                      *vTwiddle;       // Twiddle factors for pruned reverse FFT
+                float                      *vPruneBuf;      // Band buffer for pruned reverse FFT
                 size_t                      nFrameSize;     // Current frame size
                 size_t                      nInOffset;      // Offset of input buffer
+                size_t                      nTwiddleRank;   // FFT rank the twiddle factors were computed for
                 bool                        bUpdate;        // Update flag
+                bool                        bPruning;       // Pruned reverse FFT mode
                 handler_t                  *vHandlers;      // Handlers
                 size_t                      nHandlers;      // Number of handlers
                 size_t                      nBindings;      // Number of bindings
 
                 uint8_t                    *pData;          // Data buffer
 
+            protected:
+                void            build_twiddles(size_t rank);
+                bool            pruned_reverse_fft(float *dst, const float *src, size_t frame_size);
+
             public:
                 explicit SpectralSplitter();
                 SpectralSplitter(const SpectralSplitter &) = delete;
@@ -221,6 +229,23 @@ namespace lsp
                  */
                 void            set_chunk_rank(ssize_t rank);
 
+                /**
+                 * Enable or disable pruned reverse FFT. In this mode the splitter detects the range
+                 * of non-zero bins in the spectrum produced by each handler and, if the band is narrow
+                 * enough, synthesizes the output by the set of short inverse transforms of the
+                 * frequency-shifted band instead of the full-size inverse FFT. The synthesis cost
+                 * then scales with the bandwidth of the handler's spectrum rather than with the FFT size.
+                 * Bins are considered to be zero only if both real and imaginary parts are exactly zero.
+                 * @param enable enable flag
+                 */
+                void            set_pruning(bool enable);
+
+                /**
+                 * Check that pruned reverse FFT mode is enabled
+                 * @return true if pruned reverse FFT mode is enabled
+                 */
+                inline bool     pruning() const             { return bPruning;          }
+
                 /**
                  * Get latency of the spectral processor
                  * @return latency of the spectral processor
@@ -20,6 +20,7 @@
  */
 
 #include <lsp-plug.in/dsp-units/3d/RayTrace3D.h>
+#include <lsp-plug.in/dsp-units/3d/rt/bvh.h>
 #include <lsp-plug.in/dsp-units/const.h>
 #include <lsp-plug.in/common/debug.h>
 #include <lsp-plug.in/stdlib/math.h>
@@ -28,6 +29,7 @@
 #define SAMPLE_QUANTITY     512
 #define TASK_LO_THRESH      0x2000
 #define TASK_HI_THRESH      0x4000
+#define BVH_MIN_TRIANGLES   16
 
 
 namespace lsp
@@ -51,11 +53,12 @@ namespace lsp
         };
 
 
-        RayTrace3D::TaskThread::TaskThread(RayTrace3D *trace)
+        RayTrace3D::TaskThread::TaskThread(RayTrace3D *trace, uint32_t seed)
         {
             this->trace             = trace;
             clear_stats(&stats);
             heavy_state             = rt::S_SCAN_OBJECTS;
+            this->seed              = seed;
         }
 
         RayTrace3D::TaskThread::~TaskThread()
@@ -81,6 +84,7 @@ namespace lsp
             }
 
             destroy_objects(&objects);
+            queue.destroy();
             bindings.flush();
         }
 
@@ -102,8 +106,8 @@ namespace lsp
 
         status_t RayTrace3D::TaskThread::main_loop()
         {
-            rt::context_t *ctx   = NULL;
-            bool report         = false;
+            rt::context_t *ctx  = NULL;
+            size_t progress     = 0;
             status_t res        = STATUS_OK;
 
             // Perform main loop of raytracing
@@ -116,46 +120,34 @@ namespace lsp
                     break;
                 }
 
-                // Try to fetch new task from internal queue
-                if (!tasks.pop(&ctx))
+                // Try to fetch new task from internal queues first, then from the
+                // list of root tasks, and steal the task from other threads at last
+                if (tasks.pop(&ctx))
+                    ++stats.local_tasks;
+                else if ((ctx = queue.pop()) != NULL)
+                    ++stats.local_tasks;
+                else if ((ctx = fetch_root_task(&progress)) != NULL)
+                    ++stats.root_tasks;
+                else if ((ctx = steal_task()) != NULL)
+                    ++stats.stolen_tasks;
+                else
                 {
-                    // Are there any tasks left in global space?
-                    trace->lkTasks.lock();
-                    if (!trace->vTasks.pop(&ctx))
-                    {
-                        trace->lkTasks.unlock();
+                    // Leave the loop if there is no more work left, otherwise wait for other threads
+                    if (atomic_load(&trace->nPending) <= 0)
                         break;
-                    }
-
-                    // Update statistics
-                    if (trace->nQueueSize > trace->vTasks.size())
-                    {
-                        report      = true;
-                        trace->nQueueSize  = trace->vTasks.size();
-                    }
-                    ++stats.root_tasks;
-                    trace->lkTasks.unlock();
+                    wait_tasks();
+                    continue;
                 }
-                else
-                    ++stats.local_tasks;
-
-                if (ctx == NULL)
-                    break;
 
                 // Process context state
                 res     = process_context(ctx);
+                atomic_add(&trace->nPending, -1);
 
                 // Report status if required
-                if ((res == STATUS_OK) && (report))
+                if ((res == STATUS_OK) && (progress > 0))
                 {
-                    report      = false;
-
-                    trace->lkTasks.lock();
-                    float prg   = float(trace->nProgressPoints) / float(trace->nProgressMax);
-                    lsp_trace("Reporting progress %d/%d = %.2f%%", int(trace->nProgressPoints), int(trace->nProgressMax), prg * 100.0f);
-                    ++trace->nProgressPoints;
-                    res         = trace->report_progress(prg);
-                    trace->lkTasks.unlock();
+                    res         = trace->update_progress(progress);
+                    progress    = 0;
                 }
 
                 if (res != STATUS_OK)
@@ -165,25 +157,103 @@ namespace lsp
                 }
             }
 
+            // Wake up all waiting threads: there is no more work, or the processing has been interrupted
+            if (trace->sIdle.valid())
+                trace->sIdle.post(trace->vThreads.size());
+
             return res;
         }
 
+        bool RayTrace3D::TaskThread::has_shared_tasks()
+        {
+            for (size_t i=0, n=trace->vThreads.size(); i<n; ++i)
+            {
+                TaskThread *t       = trace->vThreads.uget(i);
+                if (!t->queue.empty())
+                    return true;
+            }
+
+            return false;
+        }
+
+        void RayTrace3D::TaskThread::wait_tasks()
+        {
+            if (!trace->sIdle.valid())
+            {
+                ipc::Thread::yield();
+                return;
+            }
+
+            // Register as waiting thread first and check the state after that: any thread which
+            // submits the shared task or leaves the main loop later will wake us up
+            atomic_add(&trace->nIdle, 1);
+            if ((!trace->bCancelled) && (!trace->bFailed) &&
+                (atomic_load(&trace->nPending) > 0) && (!has_shared_tasks()))
+                trace->sIdle.wait();
+            atomic_add(&trace->nIdle, -1);
+        }
+
+        rt::context_t *RayTrace3D::TaskThread::fetch_root_task(size_t *progress)
+        {
+            const atomic_t count = atomic_t(trace->vTasks.size());
+
+            while (true)
+            {
+                const atomic_t index = atomic_load(&trace->nRootTask);
+                if (index >= count)
+                    return NULL;
+                if (!atomic_cas(&trace->nRootTask, index, index + 1))
+                    continue;
+
+                // The progress point 1 has already been reported before the main loop
+                *progress   = index + 2;
+                return trace->vTasks.uget(index);
+            }
+        }
+
+        rt::context_t *RayTrace3D::TaskThread::steal_task()
+        {
+            const size_t count  = trace->vThreads.size();
+            if (count <= 1)
+                return NULL;
+
+            // Select the random victim and walk through all threads starting with it
+            seed                = seed * 1103515245 + 12345;
+            const size_t first  = (seed >> 16) % count;
+
+            for (size_t i=0; i<count; ++i)
+            {
+                TaskThread *t       = trace->vThreads.uget((first + i) % count);
+                if (t == this)
+                    continue;
+
+                rt::context_t *ctx  = t->queue.steal();
+                if (ctx != NULL)
+                    return ctx;
+            }
+
+            return NULL;
+        }
+
         status_t RayTrace3D::TaskThread::submit_task(rt::context_t *ctx)
         {
-            // 'Heavy' state and pretty high number of pending tasks - submit task to global queue
-            if (ctx->state == heavy_state)
+            atomic_add(&trace->nPending, 1);
+
+            // 'Heavy' state - submit task to the queue which can be stolen by other threads
+            if ((ctx->state == heavy_state) && (queue.push(ctx)))
             {
-                if (trace->vTasks.size() < TASK_LO_THRESH)
-                {
-                    trace->lkTasks.lock();
-                    status_t res = (trace->vTasks.push(ctx)) ? STATUS_OK : STATUS_NO_MEM;
-                    trace->lkTasks.unlock();
-                    return res;
-                }
+                // Wake up one of the waiting threads to steal the task
+                if (atomic_load(&trace->nIdle) > 0)
+                    trace->sIdle.post();
+                return STATUS_OK;
             }
 
             // Otherwise, submit to local task queue
-            return (tasks.push(ctx)) ? STATUS_OK : STATUS_NO_MEM;
+            if (tasks.push(ctx))
+                return STATUS_OK;
+
+            atomic_add(&trace->nPending, -1);
+            return STATUS_NO_MEM;
         }
 
         status_t RayTrace3D::TaskThread::process_context(rt::context_t *ctx)
@@ -475,6 +545,15 @@ namespace lsp
                 }
             }
 
+            // Build bounding volume hierarchy for large objects
+            o->bvh.clear();
+            if (o->mesh.size() > BVH_MIN_TRIANGLES)
+            {
+                status_t res = rt::build_bvh(&o->bvh, o->mesh.array(), o->mesh.size());
+                if (res != STATUS_OK)
+                    return res;
+            }
+
             // Apply changes to bound box
             const obj_boundbox_t *bbox = obj->bound_box();
             for (size_t i=0; i<8; ++i)
@@ -520,7 +599,7 @@ namespace lsp
                     return STATUS_BAD_STATE;
 
                 // Check bound box
-                bool check = rt->mesh.size() > 16;
+                bool check = rt->mesh.size() > BVH_MIN_TRIANGLES;
                 if (check)
                 {
 
@@ -530,8 +609,11 @@ namespace lsp
                 if (check)
                     continue;
 
-                // Add object to context
-                res = ctx->add_object(rt->mesh.array(), rt->plan.array(), rt->mesh.size(), rt->plan.size());
+                // Add object to context, use the bounding volume hierarchy if present
+                if (rt->bvh.size() > 0)
+                    res = ctx->add_object(rt->mesh.array(), rt->plan.array(), rt->bvh.array(), rt->plan.size());
+                else
+                    res = ctx->add_object(rt->mesh.array(), rt->plan.array(), rt->mesh.size(), rt->plan.size());
                 if (res != STATUS_OK)
                     return res;
             }
@@ -1064,16 +1146,18 @@ namespace lsp
                 estimate.swap(&tasks);
             } while ((estimate.size() > 0) && (estimate.size() < TASK_LO_THRESH));
 
-            heavy_state         = rt::S_SCAN_OBJECTS; // Enable global task queue for this thread
-            trace->vTasks.swap(&estimate); // Now all generated tasks are global
+            heavy_state         = rt::S_SCAN_OBJECTS; // Enable shared task queue for this thread
+            trace->vTasks.swap(&estimate); // Now all generated tasks are root tasks
 
-            // Values to report progress
+            // Values to process root tasks and report progress
+            trace->nRootTask        = 0;
+            trace->nPending         = trace->vTasks.size();
+            trace->nProgressLock    = 0;
             trace->nProgressPoints  = 1;
-            trace->nQueueSize       = trace->vTasks.size();
-            trace->nProgressMax     = trace->nQueueSize + 2;
+            trace->nProgressMax     = trace->vTasks.size() + 2;
 
             // Report progress
-            res         = trace->report_progress(float(trace->nProgressPoints++) / float(trace->nProgressMax));
+            res         = trace->report_progress(float(trace->nProgressPoints) / float(trace->nProgressMax));
             if (res != STATUS_OK)
             {
                 destroy_tasks(&trace->vTasks);
@@ -1176,6 +1260,8 @@ namespace lsp
                     return STATUS_NO_MEM;
                 if (!d->mesh.add(&s->mesh))
                     return STATUS_NO_MEM;
+                if (!d->bvh.add(&s->bvh))
+                    return STATUS_NO_MEM;
 
                 // Patch pointers
                 se = s->plan.array();
@@ -1273,7 +1359,10 @@ namespace lsp
             bNormalize      = true;
             bCancelled      = false;
             bFailed         = false;
-            nQueueSize      = 0;
+            nRootTask       = 0;
+            nPending        = 0;
+            nProgressLock   = 0;
+            nIdle           = 0;
             nProgressPoints = 0;
             nProgressMax    = 0;
         }
@@ -1287,6 +1376,7 @@ namespace lsp
         {
             stats->root_tasks       = 0;
             stats->local_tasks      = 0;
+            stats->stolen_tasks     = 0;
             stats->calls_scan       = 0;
             stats->calls_cull       = 0;
             stats->calls_split      = 0;
@@ -1300,6 +1390,7 @@ namespace lsp
             lsp_trace("%s:\n"
                     "  root tasks processed     : %lld\n"
                     "  local tasks processed    : %lld\n"
+                    "  stolen tasks processed   : %lld\n"
                     "  scan_objects             : %lld\n"
                     "  cull_view                : %lld\n"
                     "  split_view               : %lld\n"
@@ -1309,6 +1400,7 @@ namespace lsp
                 label,
                 (long long)stats->root_tasks,
                 (long long)stats->local_tasks,
+                (long long)stats->stolen_tasks,
                 (long long)stats->calls_scan,
                 (long long)stats->calls_cull,
                 (long long)stats->calls_split,
@@ -1322,6 +1414,7 @@ namespace lsp
         {
             dst->root_tasks        += src->root_tasks;
             dst->local_tasks       += src->local_tasks;
+            dst->stolen_tasks      += src->stolen_tasks;
             dst->calls_scan        += src->calls_scan;
             dst->calls_cull        += src->calls_cull;
             dst->calls_split       += src->calls_split;
@@ -1351,6 +1444,7 @@ namespace lsp
                 {
                     obj->mesh.flush();
                     obj->plan.flush();
+                    obj->bvh.flush();
                     delete obj;
                 }
             }
@@ -1552,11 +1646,38 @@ namespace lsp
             return pProgress(progress, pProgressData);
         }
 
+        status_t RayTrace3D::update_progress(size_t points)
+        {
+            // Only one thread reports the progress at a time, other threads just skip the report
+            if (!atomic_cas(&nProgressLock, 0, 1))
+                return STATUS_OK;
+
+            status_t res    = STATUS_OK;
+            if (points > nProgressPoints)
+            {
+                nProgressPoints = points;
+                float prg       = float(nProgressPoints) / float(nProgressMax);
+                lsp_trace("Reporting progress %d/%d = %.2f%%", int(nProgressPoints), int(nProgressMax), prg * 100.0f);
+                res             = report_progress(prg);
+            }
+
+            atomic_store(&nProgressLock, 0);
+            return res;
+        }
+
         status_t RayTrace3D::do_process(size_t threads, float initial)
         {
             status_t res = STATUS_OK;
             bCancelled   = false;
             bFailed      = false;
+            nIdle        = 0;
+
+            // Drop wake-ups left from the previous run
+            if (sIdle.valid())
+            {
+                while (sIdle.try_wait())
+                    /* nothing */ ;
+            }
 
             // Get time of execution start
         #ifdef LSP_TRACE
@@ -1565,7 +1686,7 @@ namespace lsp
         #endif
 
             // Create main thread
-            TaskThread *root = new TaskThread(this);
+            TaskThread *root = new TaskThread(this, 1);
             if (root == NULL)
                 return STATUS_NO_MEM;
 
@@ -1577,14 +1698,14 @@ namespace lsp
                 return res;
             }
 
-            // Launch supplementary threads
+            // Create supplementary threads
             lltl::parray<TaskThread> workers;
             if (vTasks.size() > 0)
             {
                 for (size_t i=1; i<threads; ++i)
                 {
                     // Create thread object
-                    TaskThread *t   = new TaskThread(this);
+                    TaskThread *t   = new TaskThread(this, uint32_t(i + 1));
                     if ((t == NULL) || (!workers.add(t)))
                     {
                         if (t != NULL)
@@ -1597,9 +1718,25 @@ namespace lsp
                     res = t->prepare_supplementary_loop(root);
                     if (res != STATUS_OK)
                         break;
+                }
+            }
 
-                    // Launch thread
-                    res = t->start();
+            // Publish the list of threads which can steal tasks from each other
+            if ((res == STATUS_OK) && (!vThreads.add(root)))
+                res = STATUS_NO_MEM;
+            for (size_t i=0, n=workers.size(); (res == STATUS_OK) && (i<n); ++i)
+            {
+                if (!vThreads.add(workers.uget(i)))
+                    res = STATUS_NO_MEM;
+            }
+
+            // Launch supplementary threads
+            size_t started = 0;
+            if (res == STATUS_OK)
+            {
+                for (size_t n=workers.size(); started<n; ++started)
+                {
+                    res = workers.uget(started)->start();
                     if (res != STATUS_OK)
                         break;
                 }
@@ -1612,7 +1749,7 @@ namespace lsp
                 bFailed = true;
 
             // Wait for supplementary threads
-            for (size_t i=0,n=workers.size(); i<n; ++i)
+            for (size_t i=0; i<started; ++i)
             {
                 // Wait for thread completion
                 TaskThread *t = workers.get(i);
@@ -1648,6 +1785,7 @@ namespace lsp
             }
             delete root;
             workers.flush();
+            vThreads.flush();
 
             // Dump overall statistics
             if (res != STATUS_BREAK_POINT)
@@ -1663,8 +1801,14 @@ namespace lsp
                 lsp_trace("Overall execution time:      %f s", etime);
             }
 
-            // Destroy all tasks
-            destroy_tasks(&vTasks);
+            // Destroy all root tasks which have not been processed
+            for (size_t i=nRootTask, n=vTasks.size(); i<n; ++i)
+            {
+                rt::context_t *ctx   = vTasks.uget(i);
+                if (ctx != NULL)
+                    delete ctx;
+            }
+            vTasks.flush();
             if (res != STATUS_OK)
                 return res;
 
@@ -1672,11 +1816,10 @@ namespace lsp
             if (bNormalize)
                 normalize_output();
 
-            float prg   = float(nProgressPoints) / float(nProgressMax);
-            lsp_trace("Reporting progress %d/%d = %.2f%%", int(nProgressPoints), int(nProgressMax), prg * 100.0f);
-            ++nProgressPoints;
+            nProgressPoints = nProgressMax;
+            lsp_trace("Reporting progress %d/%d = %.2f%%", int(nProgressPoints), int(nProgressMax), 100.0f);
 
-            return report_progress(prg);
+            return report_progress(1.0f);
         }
 
         status_t RayTrace3D::process(size_t threads, float initial)
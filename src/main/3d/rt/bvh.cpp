@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp-units/3d/rt/bvh.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdlib.h>
+#include <lsp-plug.in/stdlib/string.h>
+
+#define BVH_LEAF_SIZE       8
+
+namespace lsp
+{
+    namespace dspu
+    {
+        namespace rt
+        {
+            typedef struct bvh_item_t
+            {
+                float       c[3];       // Centroid of the triangle
+                uint32_t    index;      // Original index of the triangle
+            } bvh_item_t;
+
+            static void bvh_compute_bounds(rtx::bvh_node_t *node, const rtx::triangle_t *vt, const bvh_item_t *items)
+            {
+                const dsp::point3d_t *p0 = &vt[items[0].index].v[0];
+                node->min[0]    = p0->x;
+                node->min[1]    = p0->y;
+                node->min[2]    = p0->z;
+                node->max[0]    = p0->x;
+                node->max[1]    = p0->y;
+                node->max[2]    = p0->z;
+
+                for (size_t i=0; i<node->count; ++i)
+                {
+                    const rtx::triangle_t *t = &vt[items[i].index];
+                    for (size_t j=0; j<3; ++j)
+                    {
+                        const dsp::point3d_t *p = &t->v[j];
+                        node->min[0]    = lsp_min(node->min[0], p->x);
+                        node->min[1]    = lsp_min(node->min[1], p->y);
+                        node->min[2]    = lsp_min(node->min[2], p->z);
+                        node->max[0]    = lsp_max(node->max[0], p->x);
+                        node->max[1]    = lsp_max(node->max[1], p->y);
+                        node->max[2]    = lsp_max(node->max[2], p->z);
+                    }
+                }
+            }
+
+            static size_t bvh_split_axis(const bvh_item_t *items, size_t n)
+            {
+                float cmin[3], cmax[3];
+                for (size_t j=0; j<3; ++j)
+                {
+                    cmin[j]         = items[0].c[j];
+                    cmax[j]         = items[0].c[j];
+                }
+
+                for (size_t i=1; i<n; ++i)
+                    for (size_t j=0; j<3; ++j)
+                    {
+                        cmin[j]         = lsp_min(cmin[j], items[i].c[j]);
+                        cmax[j]         = lsp_max(cmax[j], items[i].c[j]);
+                    }
+
+                // Select the axis with the maximum extent of centroids
+                size_t axis     = 0;
+                for (size_t j=1; j<3; ++j)
+                    if ((cmax[j] - cmin[j]) > (cmax[axis] - cmin[axis]))
+                        axis            = j;
+
+                return axis;
+            }
+
+            static void bvh_select(bvh_item_t *items, size_t n, size_t k, size_t axis)
+            {
+                // Wirth's selection algorithm: put k-th item at it's place, all items before it
+                // are not greater, all items after it are not less
+                ssize_t lo = 0, hi = n - 1;
+                const ssize_t sk = k;
+
+                while (lo < hi)
+                {
+                    const float pivot   = items[sk].c[axis];
+                    ssize_t i = lo, j = hi;
+
+                    do
+                    {
+                        while (items[i].c[axis] < pivot)
+                            ++i;
+                        while (pivot < items[j].c[axis])
+                            --j;
+                        if (i <= j)
+                        {
+                            const bvh_item_t tmp    = items[i];
+                            items[i]                = items[j];
+                            items[j]                = tmp;
+                            ++i;
+                            --j;
+                        }
+                    } while (i <= j);
+
+                    if (j < sk)
+                        lo  = i;
+                    if (sk < i)
+                        hi  = j;
+                }
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            status_t build_bvh(lltl::darray<rtx::bvh_node_t> *bvh, rtx::triangle_t *vt, size_t nt)
+            {
+                bvh->clear();
+                if (nt <= 0)
+                    return STATUS_OK;
+
+                // Prepare the list of triangle centroids
+                bvh_item_t *items   = static_cast<bvh_item_t *>(malloc(sizeof(bvh_item_t) * nt));
+                if (items == NULL)
+                    return STATUS_NO_MEM;
+                lsp_finally { free(items); };
+
+                for (size_t i=0; i<nt; ++i)
+                {
+                    const rtx::triangle_t *t = &vt[i];
+                    bvh_item_t *it  = &items[i];
+                    it->c[0]        = (t->v[0].x + t->v[1].x + t->v[2].x) * (1.0f / 3.0f);
+                    it->c[1]        = (t->v[0].y + t->v[1].y + t->v[2].y) * (1.0f / 3.0f);
+                    it->c[2]        = (t->v[0].z + t->v[1].z + t->v[2].z) * (1.0f / 3.0f);
+                    it->index       = uint32_t(i);
+                }
+
+                // Create root node
+                rtx::bvh_node_t *node = bvh->add();
+                if (node == NULL)
+                    return STATUS_NO_MEM;
+                node->first     = 0;
+                node->count     = uint32_t(nt);
+
+                // Split nodes in breadth-first order, new nodes are appended to the end of the list
+                for (size_t i=0; i<bvh->size(); ++i)
+                {
+                    node            = bvh->uget(i);
+                    bvh_item_t *it  = &items[node->first];
+                    const size_t first  = node->first;
+                    const size_t count  = node->count;
+
+                    bvh_compute_bounds(node, vt, it);
+                    if (count <= BVH_LEAF_SIZE)
+                        continue;
+
+                    // Split the node by the median of centroids along the longest axis
+                    const size_t half   = count >> 1;
+                    bvh_select(it, count, half, bvh_split_axis(it, count));
+
+                    const size_t left   = bvh->size();
+                    if ((bvh->add() == NULL) || (bvh->add() == NULL))
+                        return STATUS_NO_MEM;
+
+                    rtx::bvh_node_t *children = bvh->uget(left);
+
+                    children[0].first   = uint32_t(first);
+                    children[0].count   = uint32_t(half);
+                    children[1].first   = uint32_t(first + half);
+                    children[1].count   = uint32_t(count - half);
+
+                    node            = bvh->uget(i);
+                    node->first     = uint32_t(left);
+                    node->count     = 0;
+                }
+
+                // Re-order triangles according to the order of leaves
+                rtx::triangle_t *tmp = static_cast<rtx::triangle_t *>(malloc(sizeof(rtx::triangle_t) * nt));
+                if (tmp == NULL)
+                    return STATUS_NO_MEM;
+                lsp_finally { free(tmp); };
+
+                memcpy(tmp, vt, sizeof(rtx::triangle_t) * nt);
+                for (size_t i=0; i<nt; ++i)
+                    vt[i]           = tmp[items[i].index];
+
+                return STATUS_OK;
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            void bvh_view_planes(dsp::vector3d_t *pl, const rt::view_t *view)
+            {
+                // Side planes of the view and points that lie inside of the view for each plane
+                const dsp::point3d_t *inner[3] = { &view->p[2], &view->p[0], &view->p[1] };
+
+                for (size_t i=0; i<3; ++i)
+                {
+                    const dsp::vector3d_t *src  = &view->pl[i + 1];
+                    const dsp::point3d_t *p     = inner[i];
+                    dsp::vector3d_t *dst        = &pl[i];
+
+                    const float d   = src->dx * p->x + src->dy * p->y + src->dz * p->z + src->dw;
+                    if (d > DSP_3D_TOLERANCE)
+                        *dst            = *src;
+                    else if (d < -DSP_3D_TOLERANCE)
+                    {
+                        dst->dx         = -src->dx;
+                        dst->dy         = -src->dy;
+                        dst->dz         = -src->dz;
+                        dst->dw         = -src->dw;
+                    }
+                    else
+                    {
+                        // Degenerate view, the plane should not reject anything
+                        dst->dx         = 0.0f;
+                        dst->dy         = 0.0f;
+                        dst->dz         = 0.0f;
+                        dst->dw         = 1.0f;
+                    }
+                }
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            bool bvh_check_node(const rtx::bvh_node_t *node, const dsp::vector3d_t *pl)
+            {
+                for (size_t i=0; i<3; ++i, ++pl)
+                {
+                    // Take the corner of the box which is the most distant in the direction of plane's normal
+                    const float x   = (pl->dx >= 0.0f) ? node->max[0] : node->min[0];
+                    const float y   = (pl->dy >= 0.0f) ? node->max[1] : node->min[1];
+                    const float z   = (pl->dz >= 0.0f) ? node->max[2] : node->min[2];
+
+                    // The whole box is outside of the view
+                    if ((pl->dx * x + pl->dy * y + pl->dz * z + pl->dw) < -DSP_3D_TOLERANCE)
+                        return false;
+                }
+
+                return true;
+            }
+
+        } /* namespace rt */
+    } /* namespace dspu */
+} /* namespace lsp */
@@ -20,8 +20,11 @@
  */
 
 #include <lsp-plug.in/dsp-units/3d/rt/context.h>
+#include <lsp-plug.in/dsp-units/3d/rt/bvh.h>
 #include <lsp-plug.in/dsp-units/units.h>
 
+#define RT_BVH_STACK_SIZE       64
+
 #define RT_FOREACH(type, var, collection) \
     for (size_t __ci=0,__ne=collection.size(), __nc=collection.chunks(); (__ci<__nc) && (__ne>0); ++__ci) \
     { \
@@ -921,15 +924,10 @@ namespace lsp
                 return STATUS_OK;
             }
 
-            status_t context_t::add_object(rtx::triangle_t *vt, rtx::edge_t *ve, size_t nt, size_t ne)
+            status_t context_t::add_object_triangles(const rtx::triangle_t *vt, size_t nt)
             {
                 status_t res;
 
-                // Set-up tag for the edge
-                for (size_t i=0; i<ne; ++i)
-                    ve[i].itag      = 1;
-
-                // Add all triangles
                 for (size_t i=0; i<nt; ++i)
                 {
                     const rtx::triangle_t *t = &vt[i];
@@ -938,7 +936,7 @@ namespace lsp
                         continue;
 
                     // Add triangle
-                    res = add_triangle(reinterpret_cast<const rt::triangle_t *>(&vt[i]));
+                    res = add_triangle(reinterpret_cast<const rt::triangle_t *>(t));
                     if (res == STATUS_SKIP)
                         continue;
                     else if (res != STATUS_OK)
@@ -968,6 +966,52 @@ namespace lsp
                 return STATUS_OK;
             }
 
+            status_t context_t::add_object(rtx::triangle_t *vt, rtx::edge_t *ve, size_t nt, size_t ne)
+            {
+                // Set-up tag for the edge
+                for (size_t i=0; i<ne; ++i)
+                    ve[i].itag      = 1;
+
+                // Add all triangles
+                return add_object_triangles(vt, nt);
+            }
+
+            status_t context_t::add_object(rtx::triangle_t *vt, rtx::edge_t *ve, const rtx::bvh_node_t *bvh, size_t ne)
+            {
+                status_t res;
+                dsp::vector3d_t pl[3];
+                uint32_t stack[RT_BVH_STACK_SIZE];
+                size_t top = 0;
+
+                // Set-up tag for the edge
+                for (size_t i=0; i<ne; ++i)
+                    ve[i].itag      = 1;
+
+                // Traverse the hierarchy and add triangles of all leaves that may be visible
+                rt::bvh_view_planes(pl, &view);
+                stack[top++]    = 0;
+
+                while (top > 0)
+                {
+                    const rtx::bvh_node_t *node = &bvh[stack[--top]];
+                    if (!rt::bvh_check_node(node, pl))
+                        continue;
+
+                    if (node->count > 0)
+                    {
+                        if ((res = add_object_triangles(&vt[node->first], node->count)) != STATUS_OK)
+                            return res;
+                    }
+                    else
+                    {
+                        stack[top++]    = node->first + 1;
+                        stack[top++]    = node->first;
+                    }
+                }
+
+                return STATUS_OK;
+            }
+
             status_t context_t::cull_view()
             {
                 dsp::vector3d_t pl[4]; // Split plane
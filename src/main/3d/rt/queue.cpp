@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp-units/3d/rt/queue.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        namespace rt
+        {
+            task_queue_t::task_queue_t()
+            {
+                for (size_t i=0; i<CAPACITY; ++i)
+                    vItems[i]               = NULL;
+                nTop                    = 0;
+                nBottom                 = 0;
+            }
+
+            task_queue_t::~task_queue_t()
+            {
+                destroy();
+            }
+
+            bool task_queue_t::push(rt::context_t *ctx)
+            {
+                const uatomic_t b       = nBottom;
+                const uatomic_t t       = atomic_load(&nTop);
+                if (atomic_t(b - t) >= atomic_t(CAPACITY))
+                    return false;
+
+                // Store the item and only then publish it
+                vItems[b & (CAPACITY - 1)]  = ctx;
+                atomic_store(&nBottom, uatomic_t(b + 1));
+                return true;
+            }
+
+            rt::context_t *task_queue_t::pop()
+            {
+                // Reserve the bottom item
+                const uatomic_t b       = nBottom - 1;
+                atomic_store(&nBottom, b);
+                const uatomic_t t       = atomic_load(&nTop);
+
+                const atomic_t size     = atomic_t(b - t);
+                if (size < 0)
+                {
+                    // The queue is empty
+                    atomic_store(&nBottom, uatomic_t(b + 1));
+                    return NULL;
+                }
+
+                rt::context_t *ctx      = vItems[b & (CAPACITY - 1)];
+                if (size > 0)
+                    return ctx;
+
+                // This is the last item in the queue, compete with thieves for it
+                if (!atomic_cas(&nTop, t, uatomic_t(t + 1)))
+                    ctx                     = NULL;
+                atomic_store(&nBottom, uatomic_t(b + 1));
+
+                return ctx;
+            }
+
+            rt::context_t *task_queue_t::steal()
+            {
+                const uatomic_t t       = atomic_load(&nTop);
+                const uatomic_t b       = atomic_load(&nBottom);
+                if (atomic_t(b - t) <= 0)
+                    return NULL;
+
+                // Read the item and try to commit the change of the top
+                rt::context_t *ctx      = vItems[t & (CAPACITY - 1)];
+                return (atomic_cas(&nTop, t, uatomic_t(t + 1))) ? ctx : NULL;
+            }
+
+            bool task_queue_t::empty()
+            {
+                const uatomic_t t       = atomic_load(&nTop);
+                const uatomic_t b       = atomic_load(&nBottom);
+                return atomic_t(b - t) <= 0;
+            }
+
+            void task_queue_t::destroy()
+            {
+                for (uatomic_t i=nTop; atomic_t(nBottom - i) > 0; ++i)
+                {
+                    rt::context_t *ctx      = vItems[i & (CAPACITY - 1)];
+                    if (ctx != NULL)
+                        delete ctx;
+                }
+
+                nTop                    = 0;
+                nBottom                 = 0;
+            }
+
+        } /* namespace rt */
+    } /* namespace dspu */
+} /* namespace lsp */
@@ -21,6 +21,7 @@
 
 #include <lsp-plug.in/dsp-units/dynamics/DynamicProcessor.h>
 #include <lsp-plug.in/dsp-units/const.h>
+#include <lsp-plug.in/dsp-units/misc/follower.h>
 #include <lsp-plug.in/dsp-units/misc/interpolation.h>
 #include <lsp-plug.in/stdlib/math.h>
 #include <lsp-plug.in/dsp/dsp.h>
@@ -471,6 +472,47 @@ namespace lsp
             return reduction(fEnvelope);
         }
 
+        void DynamicProcessor::process(DynamicProcessor * const *list, float * const *out, float * const *env, const float * const *in, size_t count, size_t samples)
+        {
+            follower::lanes_t lanes;
+
+            for (size_t i=0; i<count; i += follower::MAX_LANES)
+            {
+                const size_t n = lsp_min(count - i, follower::MAX_LANES);
+
+                // Gather the state of envelope followers
+                follower::init(&lanes);
+                for (size_t k=0; k<n; ++k)
+                {
+                    DynamicProcessor *p = list[i+k];
+                    for (size_t j=0; j<p->fCount[CT_ATTACK]; ++j)
+                        follower::set_reaction(&lanes, k, false, j, p->vAttack[j].fLevel, p->vAttack[j].fTau);
+                    for (size_t j=0; j<p->fCount[CT_RELEASE]; ++j)
+                        follower::set_reaction(&lanes, k, true, j, p->vRelease[j].fLevel, p->vRelease[j].fTau);
+                    lanes.vEnvelope[k]      = p->fEnvelope;
+                    lanes.vPeak[k]          = p->fPeak;
+                    lanes.vHold[k]          = p->nHoldCounter;
+                    lanes.vHoldMax[k]       = p->nHold;
+                }
+
+                // Compute envelopes of all lanes at once
+                follower::process(&out[i], &in[i], &lanes, n, samples);
+
+                // Store the state and compute the gain
+                for (size_t k=0; k<n; ++k)
+                {
+                    DynamicProcessor *p = list[i+k];
+                    p->fEnvelope            = lanes.vEnvelope[k];
+                    p->fPeak                = lanes.vPeak[k];
+                    p->nHoldCounter         = lanes.vHold[k];
+
+                    if ((env != NULL) && (env[i+k] != NULL))
+                        dsp::copy(env[i+k], out[i+k], samples);
+                    p->reduction(out[i+k], out[i+k], samples);
+                }
+            }
+        }
+
         void DynamicProcessor::curve(float *out, const float *in, size_t dots)
         {
             size_t splines  = fCount[CT_SPLINES];
@@ -20,6 +20,7 @@
  */
 
 #include <lsp-plug.in/dsp-units/dynamics/Expander.h>
+#include <lsp-plug.in/dsp-units/misc/follower.h>
 #include <lsp-plug.in/dsp-units/misc/interpolation.h>
 #include <lsp-plug.in/stdlib/math.h>
 #include <lsp-plug.in/dsp/dsp.h>
@@ -322,6 +323,47 @@ namespace lsp
             return amplification(fEnvelope);
         }
 
+        void Expander::process(Expander * const *list, float * const *out, float * const *env, const float * const *in, size_t count, size_t samples)
+        {
+            follower::lanes_t lanes;
+
+            for (size_t i=0; i<count; i += follower::MAX_LANES)
+            {
+                const size_t n = lsp_min(count - i, follower::MAX_LANES);
+
+                // Gather the state of envelope followers
+                follower::init(&lanes);
+                for (size_t k=0; k<n; ++k)
+                {
+                    Expander *p = list[i+k];
+                    p->update_settings();
+                    follower::set_reaction(&lanes, k, false, 0, 0.0f, p->fTauAttack);
+                    follower::set_reaction(&lanes, k, true, 0, 0.0f, p->fTauAttack);
+                    follower::set_reaction(&lanes, k, true, 1, nextafterf(p->fReleaseThresh, INFINITY), p->fTauRelease);
+                    lanes.vEnvelope[k]      = p->fEnvelope;
+                    lanes.vPeak[k]          = p->fPeak;
+                    lanes.vHold[k]          = p->nHoldCounter;
+                    lanes.vHoldMax[k]       = p->nHold;
+                }
+
+                // Compute envelopes of all lanes at once
+                follower::process(&out[i], &in[i], &lanes, n, samples);
+
+                // Store the state and compute the gain
+                for (size_t k=0; k<n; ++k)
+                {
+                    Expander *p = list[i+k];
+                    p->fEnvelope            = lanes.vEnvelope[k];
+                    p->fPeak                = lanes.vPeak[k];
+                    p->nHoldCounter         = lanes.vHold[k];
+
+                    if ((env != NULL) && (env[i+k] != NULL))
+                        dsp::copy(env[i+k], out[i+k], samples);
+                    p->amplification(out[i+k], out[i+k], samples);
+                }
+            }
+        }
+
         void Expander::curve(float *out, const float *in, size_t dots)
         {
             if (bUpward)
@@ -20,6 +20,7 @@
  */
 
 #include <lsp-plug.in/dsp-units/dynamics/Gate.h>
+#include <lsp-plug.in/dsp-units/misc/follower.h>
 #include <lsp-plug.in/dsp-units/misc/interpolation.h>
 #include <lsp-plug.in/dsp-units/units.h>
 #include <lsp-plug.in/stdlib/math.h>
@@ -406,6 +407,66 @@ namespace lsp
             return s;
         }
 
+        void Gate::apply_curves(float *buf, size_t samples)
+        {
+            size_t head = 0;
+
+            // Split the envelope into parts of usage of the same curve
+            for (size_t i=0; i<samples; ++i)
+            {
+                const dsp::gate_knee_t *k   = &sCurves[nCurve].sKnee;
+                const float e               = buf[i];
+                const uint8_t curve         = (e < k->start) ? 0 : (e > k->end) ? 1 : nCurve;
+                if (curve == nCurve)
+                    continue;
+
+                dsp::gate_x1_gain(&buf[head], &buf[head], k, i - head);
+                nCurve                      = curve;
+                head                        = i;
+            }
+
+            dsp::gate_x1_gain(&buf[head], &buf[head], &sCurves[nCurve].sKnee, samples - head);
+        }
+
+        void Gate::process(Gate * const *list, float * const *out, float * const *env, const float * const *in, size_t count, size_t samples)
+        {
+            follower::lanes_t lanes;
+
+            for (size_t i=0; i<count; i += follower::MAX_LANES)
+            {
+                const size_t n = lsp_min(count - i, follower::MAX_LANES);
+
+                // Gather the state of envelope followers
+                follower::init(&lanes);
+                for (size_t k=0; k<n; ++k)
+                {
+                    Gate *p = list[i+k];
+                    follower::set_reaction(&lanes, k, false, 0, 0.0f, p->fTauAttack);
+                    follower::set_reaction(&lanes, k, true, 0, 0.0f, p->fTauRelease);
+                    lanes.vEnvelope[k]      = p->fEnvelope;
+                    lanes.vPeak[k]          = p->fPeak;
+                    lanes.vHold[k]          = p->nHoldCounter;
+                    lanes.vHoldMax[k]       = p->nHold;
+                }
+
+                // Compute envelopes of all lanes at once
+                follower::process(&out[i], &in[i], &lanes, n, samples);
+
+                // Store the state and compute the gain
+                for (size_t k=0; k<n; ++k)
+                {
+                    Gate *p = list[i+k];
+                    p->fEnvelope            = lanes.vEnvelope[k];
+                    p->fPeak                = lanes.vPeak[k];
+                    p->nHoldCounter         = lanes.vHold[k];
+
+                    if ((env != NULL) && (env[i+k] != NULL))
+                        dsp::copy(env[i+k], out[i+k], samples);
+                    p->apply_curves(out[i+k], samples);
+                }
+            }
+        }
+
         void Gate::dump(IStateDumper *v) const
         {
             v->begin_array("sCurves", sCurves, 2);
@@ -60,6 +60,7 @@ namespace lsp
             nSampleRate     = 0;
             nUpdate         = UP_ALL;
             nMode           = LM_HERM_THIN;
+            nEngine         = LE_ITERATIVE;
 
             sALR.fAttack    = 10.0f;
             sALR.fRelease   = 50.0f;
@@ -69,6 +70,8 @@ namespace lsp
 
             vGainBuf        = NULL;
             vTmpBuf         = NULL;
+            vEnvBuf         = NULL;
+            vPeakIdx        = NULL;
             vData           = NULL;
         }
 
@@ -82,6 +85,8 @@ namespace lsp
 
             vGainBuf    = NULL;
             vTmpBuf     = NULL;
+            vEnvBuf     = NULL;
+            vPeakIdx    = NULL;
         }
 
         bool Limiter::init(size_t max_sr, float max_lookahead)
@@ -90,7 +95,8 @@ namespace lsp
             nHead               = 0;
             size_t buf_gap      = nMaxLookahead*8;
             size_t buf_size     = buf_gap + nMaxLookahead*4 + BUF_GRANULARITY;
-            size_t alloc        = buf_size + BUF_GRANULARITY;
+            size_t env_size     = nMaxLookahead*4 + BUF_GRANULARITY;
+            size_t alloc        = buf_size + BUF_GRANULARITY*2 + env_size;
             float *ptr          = alloc_aligned<float>(vData, alloc, DEFAULT_ALIGN);
             if (ptr == NULL)
                 return false;
@@ -99,6 +105,10 @@ namespace lsp
             ptr                += buf_size;
             vTmpBuf             = ptr;
             ptr                += BUF_GRANULARITY;
+            vEnvBuf             = ptr;
+            ptr                += env_size;
+            vPeakIdx            = reinterpret_cast<uint32_t *>(ptr);
+            ptr                += BUF_GRANULARITY;
 
             dsp::fill_one(vGainBuf, buf_size);
             dsp::fill_zero(vTmpBuf, BUF_GRANULARITY);
@@ -151,6 +161,11 @@ namespace lsp
             nUpdate |= UP_MODE;
         }
 
+        void Limiter::set_engine(limiter_engine_t engine)
+        {
+            nEngine     = engine;
+        }
+
         void Limiter::set_sample_rate(size_t sr)
         {
             if (sr == nSampleRate)
@@ -606,6 +621,35 @@ namespace lsp
             return 1.0f;
         }
 
+        inline float Limiter::patch(ssize_t n)
+        {
+            switch (nMode)
+            {
+                case LM_HERM_THIN:
+                case LM_HERM_WIDE:
+                case LM_HERM_TAIL:
+                case LM_HERM_DUCK:
+                    return sat(n);
+
+                case LM_EXP_THIN:
+                case LM_EXP_WIDE:
+                case LM_EXP_TAIL:
+                case LM_EXP_DUCK:
+                    return exp(n);
+
+                case LM_LINE_THIN:
+                case LM_LINE_WIDE:
+                case LM_LINE_TAIL:
+                case LM_LINE_DUCK:
+                    return line(n);
+
+                default:
+                    break;
+            }
+
+            return 0.0f;
+        }
+
         void Limiter::apply_sat_patch(sat_t *sat, float *dst, float amp)
         {
             ssize_t t = 0;
@@ -692,6 +736,117 @@ namespace lsp
             sALR.fEnvelope  = e;
         }
 
+        void Limiter::process_envelope(float *gbuf, size_t samples)
+        {
+            ssize_t attack, plane, release, middle;
+
+            switch (nMode)
+            {
+                case LM_HERM_THIN:
+                case LM_HERM_WIDE:
+                case LM_HERM_TAIL:
+                case LM_HERM_DUCK:
+                    attack      = sSat.nAttack;
+                    plane       = sSat.nPlane;
+                    release     = sSat.nRelease;
+                    middle      = sSat.nMiddle;
+                    break;
+
+                case LM_EXP_THIN:
+                case LM_EXP_WIDE:
+                case LM_EXP_TAIL:
+                case LM_EXP_DUCK:
+                    attack      = sExp.nAttack;
+                    plane       = sExp.nPlane;
+                    release     = sExp.nRelease;
+                    middle      = sExp.nMiddle;
+                    break;
+
+                case LM_LINE_THIN:
+                case LM_LINE_WIDE:
+                case LM_LINE_TAIL:
+                case LM_LINE_DUCK:
+                    attack      = sLine.nAttack;
+                    plane       = sLine.nPlane;
+                    release     = sLine.nRelease;
+                    middle      = sLine.nMiddle;
+                    break;
+
+                default:
+                    return;
+            }
+
+            // Compute the gain reduction required for each sample
+            float *red          = vTmpBuf;
+            const float thresh  = fThreshold - 0.000001f;
+            for (size_t i=0; i<samples; ++i)
+            {
+                const float s       = red[i];
+                red[i]              = (s > fThreshold) ? (s - thresh) / s : 0.0f;
+            }
+
+            /*
+             * The patch applied to the peak at position i covers the range of [i, i + release] samples
+             * in the envelope buffer, the plane of the patch covers the range of [i + attack, i + plane]
+             * samples. Compute the plane part as the sliding maximum of the gain reduction.
+             */
+            const ssize_t count = samples + release;
+            float *env          = vEnvBuf;
+            size_t head         = 0;
+            size_t tail         = 0;
+
+            for (ssize_t i=0; i<count; ++i)
+            {
+                // Add new peak to the queue
+                const ssize_t k     = i - attack;
+                if ((k >= 0) && (k < ssize_t(samples)) && (red[k] > 0.0f))
+                {
+                    while ((tail > head) && (red[vPeakIdx[tail - 1]] <= red[k]))
+                        --tail;
+                    vPeakIdx[tail++]    = uint32_t(k);
+                }
+
+                // Remove peaks that are out of the plane
+                while ((tail > head) && (ssize_t(vPeakIdx[head]) < (i - plane)))
+                    ++head;
+
+                env[i]              = (tail > head) ? red[vPeakIdx[head]] : 0.0f;
+            }
+
+            // Apply attack curve to the envelope, starting from the beginning of each plane
+            float level         = 0.0f;
+            ssize_t start       = 0;
+            for (ssize_t i=count-1; i>=0; --i)
+            {
+                const float c       = level * patch(attack - (start - i));
+                if (env[i] >= c)
+                {
+                    level               = env[i];
+                    start               = i;
+                }
+                else
+                    env[i]              = c;
+            }
+
+            // Apply release curve to the envelope, starting from the end of each plane
+            level               = 0.0f;
+            start               = 0;
+            for (ssize_t i=0; i<count; ++i)
+            {
+                float c             = level * patch(plane + (i - start));
+                if (env[i] >= c)
+                {
+                    level               = env[i];
+                    start               = i;
+                    c                   = env[i];
+                }
+                env[i]              = 1.0f - c;
+            }
+
+            // Apply the envelope to the gain buffer
+            dsp::mul2(&gbuf[-middle], env, count);
+        }
+
         void Limiter::process(float *gain, const float *sc, size_t samples)
         {
             // Force settings update if there are any
@@ -712,6 +867,13 @@ namespace lsp
                     dsp::abs_mul3(vTmpBuf, gbuf, sc, to_do);    // Apply gain to sidechain
                 }
 
+                // Compute the gain curve in a single pass, the iterative search will process residual peaks only
+                if ((nEngine == LE_SINGLE_PASS) && (dsp::max(vTmpBuf, to_do) > fThreshold))
+                {
+                    process_envelope(gbuf, to_do);
+                    dsp::abs_mul3(vTmpBuf, gbuf, sc, to_do);    // Apply gain to sidechain
+                }
+
                 float knee          = 1.0f;
                 size_t iterations   = 0;
 
@@ -841,6 +1003,7 @@ namespace lsp
             v->write("nSampleRate", nSampleRate);
             v->write("nUpdate", nUpdate);
             v->write("nMode", nMode);
+            v->write("nEngine", nEngine);
             v->begin_object("sALR", &sALR, sizeof(alr_t));
             {
                 v->write("fKS", sALR.fKS);
@@ -859,6 +1022,8 @@ namespace lsp
 
             v->write("vGainBuf", vGainBuf);
             v->write("vTmpBuf", vTmpBuf);
+            v->write("vEnvBuf", vEnvBuf);
+            v->write("vPeakIdx", vPeakIdx);
             v->write("vData", vData);
 
             switch (nMode)
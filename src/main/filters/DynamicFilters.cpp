@@ -20,6 +20,7 @@
  */
 
 #include <lsp-plug.in/dsp-units/filters/DynamicFilters.h>
+#include <lsp-plug.in/dsp-units/misc/quickmath.h>
 #include <lsp-plug.in/dsp/dsp.h>
 #include <lsp-plug.in/common/alloc.h>
 #include <lsp-plug.in/stdlib/math.h>
@@ -36,6 +37,47 @@ namespace lsp
         constexpr float C_PI_MUL_2          = M_PI * 2.0;
         constexpr float C_PI_DIV_2          = M_PI_2;
 
+        namespace
+        {
+            /**
+             * Fill the bank of biquad filters for dsp::dyn_biquad_process_xN() functions:
+             * row r, lane j contains the coefficients of cascade j for sample r - j,
+             * the coefficients are interpolated between the rows of the gain-indexed table.
+             */
+            template <class T, size_t N>
+            void fill_gain_bank(T *dst, const dsp::biquad_x1_t *tab, size_t points,
+                const uint32_t *idx, const float *frac, size_t samples)
+            {
+                const size_t rows   = samples + N - 1;
+                for (size_t r=0; r<rows; ++r, ++dst)
+                {
+                    for (size_t j=0; j<N; ++j)
+                    {
+                        const size_t s  = r - j;
+                        if ((r < j) || (s >= samples))
+                        {
+                            dst->b0[j]      = 1.0f;
+                            dst->b1[j]      = 0.0f;
+                            dst->b2[j]      = 0.0f;
+                            dst->a1[j]      = 0.0f;
+                            dst->a2[j]      = 0.0f;
+                            continue;
+                        }
+
+                        const dsp::biquad_x1_t *c0  = &tab[j * points + idx[s]];
+                        const dsp::biquad_x1_t *c1  = &c0[1];
+                        const float k   = frac[s];
+
+                        dst->b0[j]      = c0->b0 + (c1->b0 - c0->b0) * k;
+                        dst->b1[j]      = c0->b1 + (c1->b1 - c0->b1) * k;
+                        dst->b2[j]      = c0->b2 + (c1->b2 - c0->b2) * k;
+                        dst->a1[j]      = c0->a1 + (c1->a1 - c0->a1) * k;
+                        dst->a2[j]      = c0->a2 + (c1->a2 - c0->a2) * k;
+                    }
+                }
+            }
+        } /* namespace */
+
         // Normal analog filter that does not affect any changes to the signal
         const dsp::f_cascade_t DynamicFilters::sNormal =
         {
@@ -63,10 +105,26 @@ namespace lsp
             nSampleRate     = 0;
             pData           = NULL;
             bClearMem       = false;
+
+            vGainGrid       = NULL;
+            vGainIndex      = NULL;
+            vGainFrac       = NULL;
+            fTableMin       = 0.0f;
+            fTableMax       = 0.0f;
+            fTableLogMin    = 0.0f;
+            fTableKStep     = 0.0f;
+            nTablePoints    = 0;
+            nTableCascades  = 0;
+            pTableData      = NULL;
         }
 
         status_t DynamicFilters::init(size_t filters)
         {
+            // Disable gain-indexed tables
+            free_aligned(pTableData);
+            nTablePoints                = 0;
+            nTableCascades              = 0;
+
             // Determine how many bytes to allocate
             size_t b_per_filter_t       = align_size(sizeof(filter_t) * filters, 64);
             size_t b_per_memory         = FILTER_CHAINS_MAX * 2 * filters * sizeof(float);
@@ -102,7 +160,10 @@ namespace lsp
                 fp->fGain       = 0.0f;
                 fp->nSlope      = 0;
                 fp->fQuality    = 0.0f;
+                f->vTable       = NULL;
+                f->nCascades    = 0;
                 f->bActive      = false;
+                f->bTable       = false;
             }
 
             // Cleanup filter memory
@@ -115,6 +176,8 @@ namespace lsp
         {
             if (pData != NULL)
                 free_aligned(pData);
+            if (pTableData != NULL)
+                free_aligned(pTableData);
 
             construct();
         }
@@ -122,6 +185,75 @@ namespace lsp
         void DynamicFilters::set_sample_rate(size_t sr)
         {
             nSampleRate         = sr;
+            invalidate_tables();
+        }
+
+        void DynamicFilters::invalidate_tables()
+        {
+            for (size_t i=0; i<nFilters; ++i)
+                vFilters[i].bTable  = false;
+        }
+
+        status_t DynamicFilters::set_gain_table(float min, float max, float step, size_t cascades)
+        {
+            // Disable tables
+            if ((step <= 0.0f) || (cascades <= 0))
+            {
+                free_aligned(pTableData);
+                for (size_t i=0; i<nFilters; ++i)
+                    vFilters[i].vTable  = NULL;
+                vGainGrid       = NULL;
+                vGainIndex      = NULL;
+                vGainFrac       = NULL;
+                nTablePoints    = 0;
+                nTableCascades  = 0;
+                invalidate_tables();
+                return STATUS_OK;
+            }
+
+            if ((min <= 0.0f) || (max <= min))
+                return STATUS_BAD_ARGUMENTS;
+            if (nFilters <= 0)
+                return STATUS_BAD_STATE;
+
+            // Compute the grid
+            const float kstep       = 20.0f / (step * M_LN10);          // Steps per neper
+            const float lmin        = logf(min);
+            const size_t points     = lsp_max(size_t(ceilf((logf(max) - lmin) * kstep)) + 1, size_t(2));
+            cascades                = lsp_min(cascades, size_t(FILTER_CHAINS_MAX));
+
+            // Allocate memory
+            const size_t b_grid     = align_size(sizeof(float) * points, 64);
+            const size_t b_index    = align_size(sizeof(uint32_t) * BUF_SIZE, 64);
+            const size_t b_frac     = align_size(sizeof(float) * BUF_SIZE, 64);
+            const size_t b_table    = sizeof(dsp::biquad_x1_t) * points * cascades;
+            const size_t to_alloc   = b_grid + b_index + b_frac + b_table * nFilters;
+
+            uint8_t *data           = NULL;
+            uint8_t *ptr            = alloc_aligned<uint8_t>(data, to_alloc, 64);
+            if (ptr == NULL)
+                return STATUS_NO_MEM;
+
+            free_aligned(pTableData);
+            pTableData              = data;
+            vGainGrid               = advance_ptr_bytes<float>(ptr, b_grid);
+            vGainIndex              = advance_ptr_bytes<uint32_t>(ptr, b_index);
+            vGainFrac               = advance_ptr_bytes<float>(ptr, b_frac);
+            for (size_t i=0; i<nFilters; ++i)
+                vFilters[i].vTable      = advance_ptr_bytes<dsp::biquad_x1_t>(ptr, b_table);
+
+            for (size_t i=0; i<points; ++i)
+                vGainGrid[i]            = expf(lmin + i / kstep);
+
+            fTableMin               = min;
+            fTableMax               = vGainGrid[points - 1];
+            fTableLogMin            = lmin;
+            fTableKStep             = kstep;
+            nTablePoints            = points;
+            nTableCascades          = cascades;
+            invalidate_tables();
+
+            return STATUS_OK;
         }
 
         bool DynamicFilters::set_params(size_t id, const filter_params_t *params)
@@ -133,6 +265,7 @@ namespace lsp
                 bClearMem           = true;
 
             *fp     = *params;
+            vFilters[id].bTable     = false;
 
             // Swap frequencies if f2 < f for band-filters
             switch (fp->nType)
@@ -225,6 +358,18 @@ namespace lsp
                     1.0f / tanf(f->sParams.fFreq * C_PI / float(nSampleRate)) : // bilinear transform coefficient
                     C_PI_MUL_2 / nSampleRate; // Matched transfomr coefficient
 
+            // Use gain-indexed table if possible
+            if (nTablePoints > 0)
+            {
+                if (!f->bTable)
+                    build_gain_table(f, kf);
+                if (f->nCascades <= nTableCascades)
+                {
+                    process_gain_table(f, out, in, &vMemory[id * FILTER_CHAINS_MAX * 2], gain, samples);
+                    return;
+                }
+            }
+
             // Filter memory
             while (samples > 0)
             {
@@ -317,6 +462,135 @@ namespace lsp
             }
         }
 
+        void DynamicFilters::build_gain_table(filter_t *f, float kf)
+        {
+            const size_t points     = nTablePoints;
+            size_t nj               = 0;
+
+            f->bTable               = true;
+            f->nCascades            = 0;
+
+            for (size_t cj=0; ; cj += nj)
+            {
+                // Generate cascades for all grid points
+                for (size_t offset=0; offset < points; )
+                {
+                    const size_t count  = lsp_min(points - offset, size_t(BUF_SIZE));
+                    nj                  = build_filter_bank(vCascades, &f->sParams, cj, &vGainGrid[offset], count);
+                    if (nj <= 0)
+                        return;
+                    if (cj + nj > nTableCascades)
+                    {
+                        // Table can not store all cascades, the filter will be processed without table
+                        f->nCascades        = cj + nj;
+                        return;
+                    }
+
+                    // Cascade j for sample s is stored in row s + j
+                    for (size_t j=0; j<nj; ++j)
+                    {
+                        dsp::biquad_x1_t *dst   = &f->vTable[(cj + j) * points + offset];
+                        const dsp::f_cascade_t *src = &vCascades[j * nj + j];
+
+                        for (size_t s=0; s<count; ++s, ++dst, src += nj)
+                        {
+                            if (f->sParams.nType & 1)
+                                dsp::bilinear_transform_x1(dst, src, kf, 1);
+                            else
+                                dsp::matched_transform_x1(dst, src, f->sParams.fFreq, kf, 1);
+                        }
+                    }
+
+                    offset             += count;
+                }
+
+                f->nCascades        = cj + nj;
+            }
+        }
+
+        void DynamicFilters::process_gain_table(filter_t *f, float *out, const float *in, float *fmem, const float *gain, size_t samples)
+        {
+            const size_t points     = nTablePoints;
+            const size_t last       = points - 1;
+            const size_t nc         = f->nCascades;
+
+            while (samples > 0)
+            {
+                size_t to_process       = (samples > BUF_SIZE) ? BUF_SIZE : samples;
+
+                // Compute position of each sample in the table
+                for (size_t i=0; i<to_process; ++i)
+                {
+                    const float g           = lsp_limit(gain[i], fTableMin, fTableMax);
+                    const float x           = lsp_max(quick_logf(g) - fTableLogMin, 0.0f) * fTableKStep;
+                    const size_t idx        = size_t(x);
+                    if (idx < last)
+                    {
+                        vGainIndex[i]           = uint32_t(idx);
+                        vGainFrac[i]            = x - float(idx);
+                    }
+                    else
+                    {
+                        vGainIndex[i]           = uint32_t(last - 1);
+                        vGainFrac[i]            = 1.0f;
+                    }
+                }
+
+                // Process all cascades
+                const float *src        = in;
+                float *mem              = fmem;
+                for (size_t cj=0; cj < nc; )
+                {
+                    const size_t nj         = quantify(cj, nc);
+                    const dsp::biquad_x1_t *tab = &f->vTable[cj * points];
+
+                    if (nj == 8)
+                    {
+                        fill_gain_bank<dsp::biquad_x8_t, 8>(vBiquads.x8, tab, points, vGainIndex, vGainFrac, to_process);
+                        dsp::dyn_biquad_process_x8(out, src, mem, to_process, vBiquads.x8);
+                    }
+                    else if (nj == 4)
+                    {
+                        fill_gain_bank<dsp::biquad_x4_t, 4>(vBiquads.x4, tab, points, vGainIndex, vGainFrac, to_process);
+                        dsp::dyn_biquad_process_x4(out, src, mem, to_process, vBiquads.x4);
+                    }
+                    else if (nj == 2)
+                    {
+                        fill_gain_bank<dsp::biquad_x2_t, 2>(vBiquads.x2, tab, points, vGainIndex, vGainFrac, to_process);
+                        dsp::dyn_biquad_process_x2(out, src, mem, to_process, vBiquads.x2);
+                    }
+                    else
+                    {
+                        dsp::biquad_x1_t *dst   = vBiquads.x1;
+                        for (size_t i=0; i<to_process; ++i, ++dst)
+                        {
+                            const dsp::biquad_x1_t *c0  = &tab[vGainIndex[i]];
+                            const dsp::biquad_x1_t *c1  = &c0[1];
+                            const float k       = vGainFrac[i];
+
+                            dst->b0             = c0->b0 + (c1->b0 - c0->b0) * k;
+                            dst->b1             = c0->b1 + (c1->b1 - c0->b1) * k;
+                            dst->b2             = c0->b2 + (c1->b2 - c0->b2) * k;
+                            dst->a1             = c0->a1 + (c1->a1 - c0->a1) * k;
+                            dst->a2             = c0->a2 + (c1->a2 - c0->a2) * k;
+                        }
+                        dsp::dyn_biquad_process_x1(out, src, mem, to_process, vBiquads.x1);
+                    }
+
+                    // Update counters and pointers
+                    cj                     += nj;
+                    mem                    += nj*2;
+                    src                     = out;
+                }
+
+                // Update samples and pointers
+                samples                -= to_process;
+                gain                   += to_process;
+                out                    += to_process;
+                in                     += to_process;
+            }
+        }
+
         size_t DynamicFilters::precalc_lrx_ladder_filter_bank(dsp::f_cascade_t *dst, const filter_params_t *fp, size_t cj, const float *sfg, size_t samples)
         {
             size_t slope            = fp->nSlope * 4;
@@ -1984,7 +2258,10 @@ namespace lsp
                     v->write("fGain", f->sParams.fGain);
                     v->write("nSlope", f->sParams.nSlope);
                     v->write("fQuality", f->sParams.fQuality);
+                    v->write("vTable", f->vTable);
+                    v->write("nCascades", f->nCascades);
                     v->write("bActive", f->bActive);
+                    v->write("bTable", f->bTable);
                 }
                 v->end_object();
             }
@@ -1995,6 +2272,16 @@ namespace lsp
             v->write("nSampleRate", nSampleRate);
             v->write("pData", pData);
             v->write("bClearMem", bClearMem);
+            v->write("vGainGrid", vGainGrid);
+            v->write("vGainIndex", vGainIndex);
+            v->write("vGainFrac", vGainFrac);
+            v->write("fTableMin", fTableMin);
+            v->write("fTableMax", fTableMax);
+            v->write("fTableLogMin", fTableLogMin);
+            v->write("fTableKStep", fTableKStep);
+            v->write("nTablePoints", nTablePoints);
+            v->write("nTableCascades", nTableCascades);
+            v->write("pTableData", pTableData);
         }
     }
 } /* namespace lsp */
@@ -30,6 +30,39 @@ namespace lsp
 {
     namespace dspu
     {
+        Equalizer::KernelWorker::KernelWorker(Equalizer *eq)
+        {
+            pEq                 = eq;
+        }
+
+        Equalizer::KernelWorker::~KernelWorker()
+        {
+            pEq                 = NULL;
+        }
+
+        status_t Equalizer::KernelWorker::run()
+        {
+            // Initialize DSP context
+            dsp::context_t ctx;
+            dsp::start(&ctx);
+
+            while (!ipc::Thread::is_cancelled())
+            {
+                // Sleep until the job is submitted or the thread is cancelled
+                pEq->pKernelSignal->wait();
+                if (!atomic_cas(&pEq->nKernelState, KS_PENDING, KS_BUSY))
+                    continue;
+
+                // Build the kernel and notify the real-time thread
+                pEq->process_kernel();
+                atomic_swap(&pEq->nKernelState, KS_DONE);
+            }
+
+            // Finalize DSP context and return result
+            dsp::finish(&ctx);
+            return STATUS_OK;
+        }
+
         Equalizer::Equalizer()
         {
             construct();
@@ -60,14 +93,43 @@ namespace lsp
             vNewConv            = NULL;
             vFft                = NULL;
             vTemp               = NULL;
+            vFirWindow          = NULL;
+            vIrWindow           = NULL;
+            vSpmWindow          = NULL;
+            vFilterMag          = NULL;
+            vChanged            = NULL;
+            vOutdated           = NULL;
+            nMagStride          = 0;
+
+            pWorker             = NULL;
+            sKernel.sBank.construct();
+            sKernel.vFilters    = NULL;
+            sKernel.vParams     = NULL;
+            sKernel.vChanged    = NULL;
+            sKernel.vConv       = NULL;
+            sKernel.vTemp       = NULL;
+            sKernel.vFft        = NULL;
+            sKernel.vFilterMag  = NULL;
+            sKernel.nGen        = 0;
+            sKernel.nSampleRate = 0;
+            sKernel.nActualSampleRate = 0;
+            sKernel.nMode       = EQM_BYPASS;
+            pKernelSignal       = NULL;
+            nKernelState        = KS_IDLE;
+            nKernelGen          = 0;
+
             pData               = NULL;
             nFlags              = EF_REBUILD | EF_CLEAR;
         }
 
-        bool Equalizer::init(size_t filters, size_t fir_rank)
+        bool Equalizer::init(size_t filters, size_t fir_rank, bool background)
         {
+            // The background worker makes sense only for FIR, FFT and SPM modes
+            if (fir_rank <= 0)
+                background          = false;
+
             // Check if we do not need to do something
-            if ((nFilters == filters) && (nFirRank == fir_rank))
+            if ((nFilters == filters) && (nFirRank == fir_rank) && (background == (pWorker != NULL)))
             {
                 reset();
                 return true;
@@ -82,6 +144,7 @@ namespace lsp
                 destroy();
                 return false;
             }
+            sBank.set_smooth(nFlags & EF_IIR_SMOOTH);
 
             // Initialize filters
             nSampleRate     = 0;
@@ -98,10 +161,16 @@ namespace lsp
             {
                 nFirSize            = 1 << fir_rank;
                 nFirRank            = fir_rank;
+                nMagStride          = align_size((nFirSize >> 1) + 1, 0x10);
                 size_t fft_size     = nFirSize << 1;
                 size_t conv_size    = nFirSize << 2;
                 size_t tmp_size     = lsp_max(conv_size, BUFFER_SIZE);
-                size_t allocate     = fft_size*2 + conv_size*3 + tmp_size + nFirSize;
+                size_t mag_size     = nMagStride * filters;
+                size_t flags_size   = align_size(filters * 3, 0x10) / sizeof(float);
+                size_t allocate     = fft_size*2 + conv_size*3 + tmp_size + nFirSize +
+                                      fft_size + nFirSize*2 + mag_size + flags_size;
+                if (background)
+                    allocate           += conv_size * 3 + mag_size;
 
                 float *ptr          = alloc_aligned<float>(pData, allocate);
                 if (ptr == NULL)
@@ -119,6 +188,25 @@ namespace lsp
                 vNewConv            = advance_ptr<float>(ptr, conv_size);       // nFirSize * 4
                 vFft                = advance_ptr<float>(ptr, conv_size);       // nFirSize * 4
                 vTemp               = advance_ptr<float>(ptr, tmp_size);        // nFirSize * 4
+                vFirWindow          = advance_ptr<float>(ptr, fft_size);        // nFirSize * 2
+                vIrWindow           = advance_ptr<float>(ptr, nFirSize);        // nFirSize
+                vSpmWindow          = advance_ptr<float>(ptr, nFirSize);        // nFirSize
+                vFilterMag          = advance_ptr<float>(ptr, mag_size);        // nMagStride * filters
+                if (background)
+                {
+                    sKernel.vConv       = advance_ptr<float>(ptr, conv_size);   // nFirSize * 4
+                    sKernel.vTemp       = advance_ptr<float>(ptr, conv_size);   // nFirSize * 4
+                    sKernel.vFft        = advance_ptr<float>(ptr, conv_size);   // nFirSize * 4
+                    sKernel.vFilterMag  = advance_ptr<float>(ptr, mag_size);    // nMagStride * filters
+                }
+                vChanged            = reinterpret_cast<uint8_t *>(ptr);         // filters * 3
+                sKernel.vChanged    = &vChanged[filters];
+                vOutdated           = &vChanged[filters * 2];
+
+                // Window functions depend only on the kernel size, compute them once
+                windows::blackman_nuttall(vFirWindow, fft_size);
+                windows::blackman_nuttall(vIrWindow, nFirSize);
+                windows::sqr_cosine(vSpmWindow, nFirSize);
             }
             else
             {
@@ -133,6 +221,7 @@ namespace lsp
 
                 nFirSize            = 0;
                 nFirRank            = 0;
+                nMagStride          = 0;
                 vInBuffer           = NULL;
                 vOutBuffer          = NULL;
                 vConv               = NULL;
@@ -151,7 +240,48 @@ namespace lsp
                 }
             }
 
+            // Initialize the copy of filters for the background worker and launch it
+            if (background)
+            {
+                if (!sKernel.sBank.init(filters * FILTER_CHAINS_MAX))
+                {
+                    destroy();
+                    return false;
+                }
+
+                sKernel.vFilters    = new Filter[filters];
+                sKernel.vParams     = new filter_params_t[filters];
+                if ((sKernel.vFilters == NULL) || (sKernel.vParams == NULL))
+                {
+                    destroy();
+                    return false;
+                }
+
+                for (size_t i=0; i<filters; ++i)
+                {
+                    if (!sKernel.vFilters[i].init(&sKernel.sBank))
+                    {
+                        destroy();
+                        return false;
+                    }
+                    vFilters[i].get_params(&sKernel.vParams[i]);
+                }
+
+                // Fall back to building of the kernel in the real-time thread on error
+                pKernelSignal       = new Semaphore();
+                if ((pKernelSignal != NULL) && (pKernelSignal->valid()))
+                {
+                    pWorker             = new KernelWorker(this);
+                    if ((pWorker != NULL) && (pWorker->start() != STATUS_OK))
+                    {
+                        delete pWorker;
+                        pWorker             = NULL;
+                    }
+                }
+            }
+
             // Mark equalizer for rebuild
+            mark_changed();
             nFlags             |= EF_REBUILD | EF_CLEAR;
             nLatency            = 0;
             nBufSize            = 0;
@@ -161,6 +291,37 @@ namespace lsp
 
         void Equalizer::destroy()
         {
+            // Stop the background worker
+            if (pWorker != NULL)
+            {
+                pWorker->cancel();
+                pKernelSignal->post();
+                pWorker->join();
+                delete pWorker;
+                pWorker         = NULL;
+            }
+            if (pKernelSignal != NULL)
+            {
+                delete pKernelSignal;
+                pKernelSignal   = NULL;
+            }
+            nKernelState    = KS_IDLE;
+            nKernelGen      = 0;
+
+            if (sKernel.vFilters != NULL)
+            {
+                for (size_t i=0; i<nFilters; ++i)
+                    sKernel.vFilters[i].destroy();
+                delete [] sKernel.vFilters;
+                sKernel.vFilters    = NULL;
+            }
+            if (sKernel.vParams != NULL)
+            {
+                delete [] sKernel.vParams;
+                sKernel.vParams     = NULL;
+            }
+            sKernel.sBank.destroy();
+
             if (vFilters != NULL)
             {
                 for (size_t i=0; i<nFilters; ++i)
@@ -179,12 +340,34 @@ namespace lsp
                 vNewConv        = NULL;
                 vFft            = NULL;
                 vTemp           = NULL;
+                vFirWindow      = NULL;
+                vIrWindow       = NULL;
+                vSpmWindow      = NULL;
+                vFilterMag      = NULL;
+                vChanged        = NULL;
+                vOutdated       = NULL;
+                sKernel.vConv   = NULL;
+                sKernel.vTemp   = NULL;
+                sKernel.vFft    = NULL;
+                sKernel.vFilterMag  = NULL;
+                sKernel.vChanged= NULL;
                 pData           = NULL;
             }
 
             sBank.destroy();
         }
 
+        void Equalizer::mark_changed()
+        {
+            if (vChanged == NULL)
+                return;
+            for (size_t i=0; i<nFilters; ++i)
+            {
+                vChanged[i]     = 1;
+                vOutdated[i]    = 1;
+            }
+        }
+
         void Equalizer::set_sample_rate(size_t sr)
         {
             if (nSampleRate == sr)
@@ -199,6 +382,7 @@ namespace lsp
                 vFilters[i].update(nSampleRate, &fp);
             }
 
+            mark_changed();
             nFlags     |= EF_REBUILD | EF_CLEAR;
         }
 
@@ -213,6 +397,11 @@ namespace lsp
                 return false;
 
             vFilters[id].update(nSampleRate, params);
+            if (vChanged != NULL)
+            {
+                vChanged[id]    = 1;
+                vOutdated[id]   = 1;
+            }
             nFlags     |= EF_REBUILD;
             return true;
         }
@@ -247,6 +436,7 @@ namespace lsp
 
             if (nMode == EQM_BYPASS)
             {
+                cancel_kernel();
                 nFlags         &= ~(EF_REBUILD | EF_CLEAR | EF_XFADE);
                 nLatency        = 0;
                 return;
@@ -261,11 +451,27 @@ namespace lsp
             // Quit if working in IIR mode
             if (nMode == EQM_IIR)
             {
+                cancel_kernel();
                 nFlags         &= ~(EF_REBUILD | EF_CLEAR | EF_XFADE);
                 nLatency        = 0;
                 return;
             }
 
+            if (pWorker != NULL)
+            {
+                // Pass the job to the background worker, the submission is retried
+                // by collect_kernel() if the worker is busy at this moment
+                if (!(nFlags & EF_CLEAR))
+                {
+                    nFlags          = (nFlags & (~EF_REBUILD)) | EF_SUBMIT;
+                    submit_kernel();
+                    return;
+                }
+
+                // The pending job is outdated, the kernel should be rebuilt immediately
+                cancel_kernel();
+            }
+
             // Clear state of equalizer?
             size_t fft_size     = nFirSize << 1;
             size_t half_size    = nFirSize >> 1;
@@ -277,84 +483,184 @@ namespace lsp
                 nBufSize    = 0;
             }
 
+            // Build the kernel
+            float *dst          = ((nMode != EQM_SPM) && (nFlags & EF_SMOOTH)) ? vNewConv : vConv;
+            build_kernel(dst, vFilters, vChanged, vFilterMag, &sBank, vTemp, vFft, nMode, actual_sample_rate());
+
+            if (nMode != EQM_SPM)
+            {
+                nFlags          = lsp_setflag(nFlags, EF_XFADE, dst == vNewConv);
+                nLatency        = nFirSize + half_size;
+                nFlags         &= ~(EF_REBUILD | EF_CLEAR);
+            }
+            else
+            {
+                nLatency        = nFirSize;
+                nFlags         &= ~(EF_REBUILD | EF_CLEAR | EF_XFADE);
+            }
+        }
+
+        void Equalizer::build_kernel(float *dst, Filter *filters, uint8_t *changed, float *mag,
+            FilterBank *bank, float *temp, float *fft, equalizer_mode_t mode, size_t sr)
+        {
+            size_t half_size    = nFirSize >> 1;
+
             // Build filter's magnitude characteristics
-            if (nMode == EQM_FIR)
+            if (mode == EQM_FIR)
             {
-                windows::blackman_nuttall(vNewConv, fft_size);
-                sBank.impulse_response(vTemp, nFirSize);                        // Generate impulse response of the filter
-                dsp::mul2(vTemp, &vNewConv[nFirSize], nFirSize);                // Apply window function to the impulse response
-                dsp::pcomplex_r2c(vFft, vTemp, nFirSize);                       // Prepare for FFT transform
-                dsp::packed_direct_fft(vFft, vFft, nFirRank);                   // Perform FFT
-                dsp::pcomplex_mod(vTemp, vFft, nFirSize);                       // Now we have FFT magnitude in vTemp
+                bank->impulse_response(temp, nFirSize);                         // Generate impulse response of the filter
+                dsp::mul2(temp, &vFirWindow[nFirSize], nFirSize);               // Apply window function to the impulse response
+                dsp::pcomplex_r2c(fft, temp, nFirSize);                         // Prepare for FFT transform
+                dsp::packed_direct_fft(fft, fft, nFirRank);                     // Perform FFT
+                dsp::pcomplex_mod(temp, fft, nFirSize);                         // Now we have FFT magnitude in temp
             }
-            else if ((nMode == EQM_FFT) || (nMode == EQM_SPM))
+            else
             {
                 size_t num_filters  = 0;
                 size_t freq_size    = half_size + 1;
-                const uint32_t sr   = actual_sample_rate();
+                float *freqs        = &fft[nFirSize << 1];
 
-                dsp::lin_inter_set(vNewConv, 0, 0.0f, int32_t(half_size), 0.5f * sr, 0, uint32_t(freq_size)); // Compute frequencies
+                dsp::lin_inter_set(freqs, 0, 0.0f, int32_t(half_size), 0.5f * sr, 0, uint32_t(freq_size)); // Compute frequencies
 
-                // Build frequency chart for all filters
+                // Build frequency chart for all filters, update the cached magnitude only for changed filters
                 for (size_t i=0; i<nFilters; ++i)
                 {
                     // Skip inactive filters
-                    if (vFilters[i].inactive())
+                    Filter *f           = &filters[i];
+                    if (f->inactive())
                         continue;
 
-                    // Get the frequency chart of the filter
-                    if ((num_filters++) > 0)
+                    float *fmag         = &mag[i * nMagStride];
+                    if (changed[i])
                     {
-                        vFilters[i].freq_chart(vFft, vNewConv, freq_size);
-                        dsp::pcomplex_mod(vFft, vFft, freq_size);
-                        dsp::mul2(vTemp, vFft, freq_size);
+                        f->freq_chart(fft, freqs, freq_size);
+                        dsp::pcomplex_mod(fmag, fft, freq_size);
+                        changed[i]          = 0;
                     }
+
+                    if ((num_filters++) > 0)
+                        dsp::mul2(temp, fmag, freq_size);
                     else
-                    {
-                        vFilters[i].freq_chart(vFft, vNewConv, freq_size);
-                        dsp::pcomplex_mod(vTemp, vFft, freq_size);
-                    }
+                        dsp::copy(temp, fmag, freq_size);
                 }
 
                 // Finally, build the correct frequency chart for reverse FFT
                 if (num_filters > 0)
-                    dsp::reverse2(&vTemp[freq_size], &vTemp[1], half_size-1);
+                    dsp::reverse2(&temp[freq_size], &temp[1], half_size-1);
                 else
-                    dsp::fill_one(vTemp, nFirSize);
+                    dsp::fill_one(temp, nFirSize);
             }
-            else
-                dsp::fill_one(vTemp, nFirSize);                                 // Flat response
 
-            if (nMode != EQM_SPM)
+            if (mode == EQM_SPM)
             {
-                // Transform the magnitude into linear-phase filter
-                dsp::pcomplex_r2c(vFft, vTemp, nFirSize);                           // Set phase to 0 for all frequencies
-                dsp::packed_reverse_fft(vFft, vFft, nFirRank);                      // Get the synthesized impulse response
-                dsp::pcomplex_c2r(&vTemp[half_size], vFft, nFirSize);               // Get real part of the impulse response
-                dsp::copy(vTemp, &vTemp[nFirSize], half_size);                      // Make impulse response symmetric
-                windows::blackman_nuttall(vNewConv, nFirSize);                      // Compute the window function
-                dsp::mul2(vTemp, vNewConv, nFirSize);                               // Apply the window function
+                dsp::pcomplex_r2c(dst, temp, nFirSize);                         // Convert magnitude to complex value
+                return;
+            }
 
-                // Get the final impulse response data
-                if (nFlags & EF_SMOOTH)
-                {
-                    nFlags     |= EF_XFADE;
-                    dsp::fastconv_parse(vNewConv, vTemp, nFirRank + 1);                 // Get the IR function
-                }
-                else
-                    dsp::fastconv_parse(vConv, vTemp, nFirRank + 1);                 // Get the IR function
+            // Transform the magnitude into linear-phase filter
+            dsp::pcomplex_r2c(fft, temp, nFirSize);                             // Set phase to 0 for all frequencies
+            dsp::packed_reverse_fft(fft, fft, nFirRank);                        // Get the synthesized impulse response
+            dsp::pcomplex_c2r(&temp[half_size], fft, nFirSize);                 // Get real part of the impulse response
+            dsp::copy(temp, &temp[nFirSize], half_size);                        // Make impulse response symmetric
+            dsp::mul2(temp, vIrWindow, nFirSize);                               // Apply the window function
+            dsp::fastconv_parse(dst, temp, nFirRank + 1);                       // Get the IR function
+        }
 
-                nLatency    = nFirSize + half_size;
-                nFlags     &= ~(EF_REBUILD | EF_CLEAR);
+        void Equalizer::prepare_kernel()
+        {
+            // Pass parameters of changed filters to the background worker
+            for (size_t i=0; i<nFilters; ++i)
+            {
+                if (!vOutdated[i])
+                    continue;
+                vFilters[i].get_params(&sKernel.vParams[i]);
+                sKernel.vChanged[i] = 1;
+                vOutdated[i]        = 0;
             }
-            else // EQM_SPM
+
+            sKernel.nSampleRate         = nSampleRate;
+            sKernel.nActualSampleRate   = uint32_t(actual_sample_rate());
+            sKernel.nMode               = nMode;
+        }
+
+        void Equalizer::process_kernel()
+        {
+            // Update own copy of filters
+            sKernel.sBank.begin();
+            for (size_t i=0; i<nFilters; ++i)
             {
-                dsp::pcomplex_r2c(vConv, vTemp, nFirSize);                          // Convert magnitude to complex value
-                windows::sqr_cosine(vFft, nFirSize);                                // Also provide window
+                Filter *f           = &sKernel.vFilters[i];
+                if (sKernel.vChanged[i])
+                    f->update(sKernel.nSampleRate, &sKernel.vParams[i]);
+                f->rebuild();
+            }
+            sKernel.sBank.end(true);
+
+            build_kernel(sKernel.vConv, sKernel.vFilters, sKernel.vChanged, sKernel.vFilterMag,
+                &sKernel.sBank, sKernel.vTemp, sKernel.vFft, sKernel.nMode, sKernel.nActualSampleRate);
+        }
+
+        bool Equalizer::submit_kernel()
+        {
+            if (!(nFlags & EF_SUBMIT))
+                return false;
+
+            // Do not overwrite the job or the kernel which has not been applied yet
+            if ((atomic_load(&nKernelState) != KS_IDLE) || (nFlags & EF_XFADE))
+                return false;
+
+            prepare_kernel();
+            sKernel.nGen        = nKernelGen;
+            atomic_swap(&nKernelState, KS_PENDING);
+            pKernelSignal->post();
+            nFlags             &= ~EF_SUBMIT;
+
+            return true;
+        }
+
+        void Equalizer::collect_kernel()
+        {
+            if (pWorker == NULL)
+                return;
 
-                nLatency    = nFirSize;
-                nFlags     &= ~(EF_REBUILD | EF_CLEAR | EF_XFADE);
+            // Do not wait for the job, check it on the next call
+            if (atomic_load(&nKernelState) == KS_DONE)
+            {
+                if (sKernel.nGen != nKernelGen)
+                    atomic_swap(&nKernelState, KS_IDLE);    // Stale job, drop the result
+                else if (!(nFlags & EF_XFADE))
+                {
+                    // Apply the new kernel, the worker does not touch its buffer until the next job
+                    if (sKernel.nMode == EQM_SPM)
+                        lsp::swap(vConv, sKernel.vConv);
+                    else
+                    {
+                        lsp::swap(vNewConv, sKernel.vConv);
+                        nFlags             |= EF_XFADE;
+                    }
+                    atomic_swap(&nKernelState, KS_IDLE);
+                }
             }
+
+            // Retry the submission of the job
+            submit_kernel();
+        }
+
+        void Equalizer::cancel_kernel()
+        {
+            // Never wait for the worker: mark the submitted job stale, its result will be dropped
+            ++nKernelGen;
+            nFlags             &= ~EF_SUBMIT;
+        }
+
+        bool Equalizer::kernel_pending() const
+        {
+            if (nFlags & (EF_REBUILD | EF_CLEAR | EF_SUBMIT | EF_XFADE))
+                return true;
+            if (pWorker == NULL)
+                return false;
+
+            return (nKernelState != KS_IDLE) && (sKernel.nGen == nKernelGen);
         }
 
         void Equalizer::set_mode(equalizer_mode_t mode)
@@ -370,6 +676,7 @@ namespace lsp
             if (nActualSampleRate == sample_rate)
                 return;
             nActualSampleRate   = sample_rate;
+            mark_changed();
             if ((nMode == EQM_IIR) || (nMode == EQM_SPM))
                 nFlags     |= EF_REBUILD;
         }
@@ -460,6 +767,7 @@ namespace lsp
         void Equalizer::process(float *out, const float *in, size_t samples)
         {
             reconfigure();
+            collect_kernel();
 
             switch (nMode)
             {
@@ -537,7 +845,7 @@ namespace lsp
                             dsp::pcomplex_mul2(vTemp, vConv, nFirSize);                 // Apply magnitude
                             dsp::packed_reverse_fft(vTemp, vTemp, nFirRank);            // Transform back
                             dsp::pcomplex_c2r(vTemp, vTemp, nFirSize);                  // Add result of convolution to output
-                            dsp::fmadd3(vOutBuffer, vTemp, vFft, nFirSize);             // Apply window to the signal and add to buffer
+                            dsp::fmadd3(vOutBuffer, vTemp, vSpmWindow, nFirSize);       // Apply window to the signal and add to buffer
 
                             dsp::move(vInBuffer, &vInBuffer[half_len], half_len);       // Shift input buffer
 
@@ -625,6 +933,17 @@ namespace lsp
             nFlags = lsp_setflag(nFlags, EF_SMOOTH, smooth);
         }
 
+        bool Equalizer::iir_smooth() const
+        {
+            return nFlags & EF_IIR_SMOOTH;
+        }
+
+        void Equalizer::set_iir_smooth(bool smooth)
+        {
+            nFlags = lsp_setflag(nFlags, EF_IIR_SMOOTH, smooth);
+            sBank.set_smooth(smooth);
+        }
+
         void Equalizer::dump(IStateDumper *v) const
         {
             v->write_object("sBank", &sBank);
@@ -647,6 +966,33 @@ namespace lsp
             v->write("vNewConv", vNewConv);
             v->write("vFft", vFft);
             v->write("vTemp", vTemp);
+            v->write("vFirWindow", vFirWindow);
+            v->write("vIrWindow", vIrWindow);
+            v->write("vSpmWindow", vSpmWindow);
+            v->write("vFilterMag", vFilterMag);
+            v->write("vChanged", vChanged);
+            v->write("vOutdated", vOutdated);
+            v->write("nMagStride", nMagStride);
+            v->write("pWorker", pWorker);
+            v->begin_object("sKernel", &sKernel, sizeof(kernel_t));
+            {
+                v->write_object("sBank", &sKernel.sBank);
+                v->write("vFilters", sKernel.vFilters);
+                v->write("vParams", sKernel.vParams);
+                v->write("vChanged", sKernel.vChanged);
+                v->write("vConv", sKernel.vConv);
+                v->write("vTemp", sKernel.vTemp);
+                v->write("vFft", sKernel.vFft);
+                v->write("vFilterMag", sKernel.vFilterMag);
+                v->write("nGen", sKernel.nGen);
+                v->write("nSampleRate", sKernel.nSampleRate);
+                v->write("nActualSampleRate", sKernel.nActualSampleRate);
+                v->write("nMode", int(sKernel.nMode));
+            }
+            v->end_object();
+            v->write("pKernelSignal", pKernelSignal);
+            v->write("nKernelState", int(nKernelState));
+            v->write("nKernelGen", nKernelGen);
             v->write("nFlags", nFlags);
             v->write("pData", pData);
         }
@@ -46,6 +46,10 @@ namespace lsp
             nLastItems  = -1;
             vData       = NULL;
             vBackup     = NULL;
+            vSvf        = NULL;
+            vSvfTarget  = NULL;
+            bSmooth     = false;
+            bRamp       = false;
         }
 
         void FilterBank::destroy()
@@ -68,9 +72,10 @@ namespace lsp
             size_t bank_alloc   = align_size(sizeof(dsp::biquad_t), LSP_DSP_BIQUAD_ALIGN) * n_banks;
             size_t chain_alloc  = sizeof(dsp::biquad_x1_t) * filters;
             size_t backup_alloc = sizeof(float) * LSP_DSP_BIQUAD_D_ITEMS * n_banks;
+            size_t svf_alloc    = sizeof(svf_t) * filters;
 
             // Allocate data
-            size_t allocate     = bank_alloc + chain_alloc + backup_alloc;
+            size_t allocate     = bank_alloc + chain_alloc + backup_alloc + svf_alloc * 2;
             uint8_t *ptr        = alloc_aligned<uint8_t>(vData, allocate, LSP_DSP_BIQUAD_ALIGN);
             if (ptr == NULL)
                 return false;
@@ -82,11 +87,16 @@ namespace lsp
             ptr                += chain_alloc;
             vBackup             = reinterpret_cast<float *>(ptr);
             ptr                += backup_alloc;
+            vSvf                = reinterpret_cast<svf_t *>(ptr);
+            ptr                += svf_alloc;
+            vSvfTarget          = reinterpret_cast<svf_t *>(ptr);
+            ptr                += svf_alloc;
 
             // Update parameters
             nItems              = 0;
             nMaxItems           = filters;
             nLastItems          = -1;
+            bRamp               = false;
 
             return true;
         }
@@ -229,12 +239,53 @@ namespace lsp
                 b          ++;
             }
 
+            // Compute the parameters of state-variable filters
+            if (bSmooth)
+            {
+                for (size_t i=0; i<nItems; ++i)
+                    calc_svf(&vSvfTarget[i], &vChains[i]);
+                bRamp           = true;
+            }
+
             // Clear delays if structure has changed
             if ((clear) || (nItems != nLastItems))
                 reset();
             nLastItems      = nItems;
         }
 
+        void FilterBank::calc_svf(svf_t *svf, const dsp::biquad_x1_t *f)
+        {
+            // The denominator of the trapezoidal SVF after the bilinear transform is:
+            //   (1 + g*k + g^2) + 2*(g^2 - 1)*z^-1 + (1 - g*k + g^2)*z^-2
+            // The values of the denominator and the numerator at z = 1 and z = -1
+            // allow to find the parameters of the SVF from the biquad coefficients.
+            // Coefficients a1 and a2 are stored with inverted sign as required by biquad_process_x1().
+            const float s   = lsp_max(1.0f - f->a1 - f->a2, 1e-12f);
+            const float p   = lsp_max(1.0f + f->a1 - f->a2, 1e-12f);
+            const float g   = sqrtf(s / p);
+            const float kp  = 1.0f / (p * g);
+
+            svf->g          = g;
+            svf->k          = 2.0f * (1.0f + f->a2) * kp;
+            svf->hp         = (f->b0 - f->b1 + f->b2) / p;
+            svf->bp         = 2.0f * (f->b0 - f->b2) * kp;
+            svf->lp         = (f->b0 + f->b1 + f->b2) / s;
+        }
+
+        void FilterBank::set_smooth(bool smooth)
+        {
+            if (bSmooth == smooth)
+                return;
+
+            bSmooth         = smooth;
+            if (smooth)
+            {
+                for (size_t i=0; i<nItems; ++i)
+                    calc_svf(&vSvfTarget[i], &vChains[i]);
+            }
+            reset();
+        }
+
         void FilterBank::reset()
         {
             size_t items    = nItems >> 3;
@@ -251,19 +302,35 @@ namespace lsp
                 dsp::fill_zero(b->d, LSP_DSP_BIQUAD_D_ITEMS);
                 b++;
             }
+
+            // Apply the target parameters of state-variable filters immediately
+            if (bSmooth)
+            {
+                for (size_t i=0; i<nItems; ++i)
+                {
+                    vSvf[i]         = vSvfTarget[i];
+                    vSvf[i].s1      = 0.0f;
+                    vSvf[i].s2      = 0.0f;
+                }
+            }
+            bRamp           = false;
         }
 
         void FilterBank::process(float *out, const float *in, size_t samples)
+        {
+            if (nItems == 0)
+                dsp::copy(out, in, samples);
+            else if (bSmooth)
+                process_smooth(out, in, samples);
+            else
+                process_direct(out, in, samples);
+        }
+
+        void FilterBank::process_direct(float *out, const float *in, size_t samples)
         {
             size_t items        = nItems;
             dsp::biquad_t *f    = vFilters;
 
-            if (items == 0)
-            {
-                dsp::copy(out, in, samples);
-                return;
-            }
-
             while (items >= 8)
             {
                 dsp::biquad_process_x8(out, in, samples, f);
@@ -290,6 +357,81 @@ namespace lsp
                 dsp::biquad_process_x1(out, in, samples, f);
         }
 
+        void FilterBank::process_smooth(float *out, const float *in, size_t samples)
+        {
+            if (samples <= 0)
+                return;
+
+            for (size_t j=0; j<nItems; ++j)
+            {
+                svf_t *f            = &vSvf[j];
+                float s1            = f->s1;
+                float s2            = f->s2;
+
+                if (bRamp)
+                {
+                    // Linearly interpolate parameters of the filter over the block
+                    const svf_t *t      = &vSvfTarget[j];
+                    const float kd      = 1.0f / samples;
+                    const float dg      = (t->g - f->g) * kd;
+                    const float dk      = (t->k - f->k) * kd;
+                    const float dhp     = (t->hp - f->hp) * kd;
+                    const float dbp     = (t->bp - f->bp) * kd;
+                    const float dlp     = (t->lp - f->lp) * kd;
+
+                    for (size_t i=0; i<samples; ++i)
+                    {
+                        const float x   = in[i];
+                        const float di  = i + 1;
+                        const float g   = f->g + dg * di;
+                        const float k   = f->k + dk * di;
+                        const float a1  = 1.0f / (1.0f + g * (g + k));
+                        const float a2  = g * a1;
+                        const float a3  = g * a2;
+
+                        const float v3  = x - s2;
+                        const float v1  = a1 * s1 + a2 * v3;
+                        const float v2  = s2 + a2 * s1 + a3 * v3;
+                        s1              = 2.0f * v1 - s1;
+                        s2              = 2.0f * v2 - s2;
+
+                        out[i]          =
+                            (f->hp + dhp * di) * (x - k * v1 - v2) +
+                            (f->bp + dbp * di) * v1 +
+                            (f->lp + dlp * di) * v2;
+                    }
+
+                    *f              = *t;
+                }
+                else
+                {
+                    const float g   = f->g;
+                    const float k   = f->k;
+                    const float a1  = 1.0f / (1.0f + g * (g + k));
+                    const float a2  = g * a1;
+                    const float a3  = g * a2;
+
+                    for (size_t i=0; i<samples; ++i)
+                    {
+                        const float x   = in[i];
+                        const float v3  = x - s2;
+                        const float v1  = a1 * s1 + a2 * v3;
+                        const float v2  = s2 + a2 * s1 + a3 * v3;
+                        s1              = 2.0f * v1 - s1;
+                        s2              = 2.0f * v2 - s2;
+
+                        out[i]          = f->hp * (x - k * v1 - v2) + f->bp * v1 + f->lp * v2;
+                    }
+                }
+
+                f->s1           = s1;
+                f->s2           = s2;
+                in              = out;  // actual data for the next filter is in output buffer now
+            }
+
+            bRamp           = false;
+        }
+
         void FilterBank::impulse_response(float *out, size_t samples)
         {
             // Backup and clean all delays
@@ -315,7 +457,8 @@ namespace lsp
             // Generate impulse response
             dsp::fill_zero(out, samples);
             out[0]              = 1.0f;
-            process(out, out, samples);
+            if (nItems > 0)
+                process_direct(out, out, samples);
 
             // Restore all delays
             dst                 = vBackup;
@@ -416,11 +559,31 @@ namespace lsp
                 v->end_object();
             }
             v->end_array();
+            v->begin_array("vSvf", vSvf, nItems);
+            for (size_t i=0; i<nItems; ++i)
+            {
+                const svf_t *f = &vSvf[i];
+                v->begin_object(f, sizeof(svf_t));
+                {
+                    v->write("g", f->g);
+                    v->write("k", f->k);
+                    v->write("hp", f->hp);
+                    v->write("bp", f->bp);
+                    v->write("lp", f->lp);
+                    v->write("s1", f->s1);
+                    v->write("s2", f->s2);
+                }
+                v->end_object();
+            }
+            v->end_array();
+            v->write("vSvfTarget", vSvfTarget);
             v->write("nItems", nItems);
             v->write("nMaxItems", nMaxItems);
             v->write("nLastItems", nLastItems);
             v->write("vBackup", vBackup);
             v->write("vData", vData);
+            v->write("bSmooth", bSmooth);
+            v->write("bRamp", bRamp);
         }
 
     } /* namespace dspu */
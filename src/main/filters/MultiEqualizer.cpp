@@ -0,0 +1,410 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp-units/filters/MultiEqualizer.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        MultiEqualizer::MultiEqualizer()
+        {
+            construct();
+        }
+
+        MultiEqualizer::~MultiEqualizer()
+        {
+            destroy();
+        }
+
+        void MultiEqualizer::construct()
+        {
+            sEq.construct();
+            sBank.construct();
+
+            vChannels           = NULL;
+            nChannels           = 0;
+            nBufSize            = 0;
+            nFlags              = MF_SYNC | MF_CLEAR;
+            bLanes              = false;
+            pData               = NULL;
+        }
+
+        bool MultiEqualizer::init(size_t channels, size_t filters, size_t fir_rank, bool background)
+        {
+            destroy();
+
+            if (channels <= 0)
+                return false;
+
+            // Initialize the equalizer that builds the kernel
+            if (!sEq.init(filters, fir_rank, background))
+                return false;
+
+            // Initialize channels
+            vChannels           = new channel_t[channels];
+            if (vChannels == NULL)
+            {
+                destroy();
+                return false;
+            }
+            nChannels           = channels;
+            bLanes              = channels >= MULTI_FILTERBANK_MIN_CHANNELS;
+
+            for (size_t i=0; i<channels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                c->vInBuffer        = NULL;
+                c->vOutBuffer       = NULL;
+                if ((!bLanes) && (!c->sBank.init(filters * FILTER_CHAINS_MAX)))
+                {
+                    destroy();
+                    return false;
+                }
+            }
+
+            // Initialize the multi-channel filter bank for IIR mode
+            if ((bLanes) && (!sBank.init(channels, filters * FILTER_CHAINS_MAX)))
+            {
+                destroy();
+                return false;
+            }
+
+            // Allocate buffers for convolution
+            if (fir_rank > 0)
+            {
+                size_t fft_size     = size_t(1) << (fir_rank + 1);
+                size_t allocate     = fft_size * 2 * channels;
+                float *ptr          = alloc_aligned<float>(pData, allocate);
+                if (ptr == NULL)
+                {
+                    destroy();
+                    return false;
+                }
+                dsp::fill_zero(ptr, allocate);
+
+                for (size_t i=0; i<channels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+                    c->vInBuffer        = advance_ptr<float>(ptr, fft_size);
+                    c->vOutBuffer       = advance_ptr<float>(ptr, fft_size);
+                }
+            }
+
+            nBufSize            = 0;
+            nFlags              = MF_SYNC | MF_CLEAR;
+
+            return true;
+        }
+
+        void MultiEqualizer::destroy()
+        {
+            if (vChannels != NULL)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                    vChannels[i].sBank.destroy();
+                delete [] vChannels;
+                vChannels       = NULL;
+            }
+            nChannels       = 0;
+
+            free_aligned(pData);
+            sBank.destroy();
+            sEq.destroy();
+        }
+
+        bool MultiEqualizer::set_params(size_t id, const filter_params_t *params)
+        {
+            if (!sEq.set_params(id, params))
+                return false;
+            nFlags     |= MF_SYNC;
+            return true;
+        }
+
+        void MultiEqualizer::set_mode(equalizer_mode_t mode)
+        {
+            if (mode == sEq.get_mode())
+                return;
+            sEq.set_mode(mode);
+            nFlags     |= MF_SYNC | MF_CLEAR;
+        }
+
+        void MultiEqualizer::set_actual_sample_rate(size_t sample_rate)
+        {
+            sEq.set_actual_sample_rate(sample_rate);
+            nFlags     |= MF_SYNC;
+        }
+
+        void MultiEqualizer::set_sample_rate(size_t sr)
+        {
+            if (sEq.nSampleRate == sr)
+                return;
+            sEq.set_sample_rate(sr);
+            nFlags     |= MF_SYNC | MF_CLEAR;
+        }
+
+        void MultiEqualizer::sync_channels()
+        {
+            const bool clear    = nFlags & MF_CLEAR;
+
+            // Clear the state of the convolution
+            if ((clear) && (pData != NULL))
+            {
+                const size_t fft_size = sEq.nFirSize << 1;
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+                    dsp::fill_zero(c->vInBuffer, fft_size);
+                    dsp::fill_zero(c->vOutBuffer, fft_size);
+                }
+                nBufSize            = 0;
+            }
+
+            // Copy the filter chains computed by the equalizer to the filter bank of all channels
+            if (sEq.nMode == EQM_IIR)
+            {
+                FilterBank *src     = &sEq.sBank;
+                const size_t items  = src->size();
+
+                if (bLanes)
+                {
+                    sBank.begin();
+                    for (size_t j=0; j<items; ++j)
+                        *(sBank.add_chain()) = *(src->chain(j));
+                    sBank.end(clear);
+                }
+                else
+                {
+                    for (size_t i=0; i<nChannels; ++i)
+                    {
+                        FilterBank *dst     = &vChannels[i].sBank;
+                        dst->begin();
+                        for (size_t j=0; j<items; ++j)
+                            *(dst->add_chain()) = *(src->chain(j));
+                        dst->end(clear);
+                    }
+                }
+            }
+            else if (!clear)
+                return; // Keep the flag until the mode is switched to IIR
+
+            nFlags      = 0;
+        }
+
+        void MultiEqualizer::process(float * const *out, const float * const *in, size_t samples)
+        {
+            sEq.reconfigure();
+            sEq.collect_kernel();
+            if (nFlags)
+                sync_channels();
+
+            switch (sEq.nMode)
+            {
+                case EQM_IIR:
+                {
+                    if (bLanes)
+                        sBank.process(out, in, samples);
+                    else
+                    {
+                        for (size_t i=0; i<nChannels; ++i)
+                            vChannels[i].sBank.process(out[i], in[i], samples);
+                    }
+                    break;
+                }
+
+                case EQM_FIR:
+                case EQM_FFT:
+                    process_fir(out, in, samples);
+                    break;
+
+                case EQM_SPM:
+                    process_spm(out, in, samples);
+                    break;
+
+                case EQM_BYPASS:
+                default:
+                {
+                    for (size_t i=0; i<nChannels; ++i)
+                        dsp::copy(out[i], in[i], samples);
+                    break;
+                }
+            }
+        }
+
+        void MultiEqualizer::process_fir(float * const *out, const float * const *in, size_t samples)
+        {
+            const size_t fir_size   = sEq.nFirSize;
+            const size_t conv_rank  = sEq.nFirRank + 1;
+            const size_t half       = fir_size >> 1;
+
+            for (size_t offset=0; offset < samples; )
+            {
+                if (nBufSize >= fir_size)
+                {
+                    // Apply FIR processing to all channels with the same kernel
+                    for (size_t i=0; i<nChannels; ++i)
+                    {
+                        channel_t *c        = &vChannels[i];
+                        dsp::move(c->vOutBuffer, &c->vOutBuffer[fir_size], fir_size);   // Shift output buffer
+                        dsp::fill_zero(&c->vOutBuffer[fir_size], fir_size);            // Empty tail of output buffer
+                        dsp::fastconv_parse_apply(c->vOutBuffer, sEq.vTemp, sEq.vConv, c->vInBuffer, conv_rank); // Apply convolution
+                    }
+
+                    if (sEq.nFlags & Equalizer::EF_XFADE)
+                    {
+                        // Replace old convolution with new one once for all channels
+                        dsp::copy(sEq.vConv, sEq.vNewConv, fir_size * 4);
+
+                        for (size_t i=0; i<nChannels; ++i)
+                        {
+                            channel_t *c        = &vChannels[i];
+
+                            // Apply new convolution
+                            dsp::fill_zero(sEq.vFft, fir_size*2);
+                            dsp::fastconv_parse_apply(sEq.vFft, sEq.vTemp, sEq.vConv, c->vInBuffer, conv_rank);
+
+                            // Mix the result of previous convolution with new one
+                            dsp::lramp1(&c->vOutBuffer[half], 1.0f, 0.0f, fir_size);
+                            dsp::lramp_add2(&c->vOutBuffer[half], &sEq.vFft[half], 0.0f, 1.0f, fir_size);
+                            dsp::copy(&c->vOutBuffer[fir_size + half], &sEq.vFft[fir_size + half], half);
+                        }
+
+                        sEq.nFlags     &= ~Equalizer::EF_XFADE;
+                    }
+
+                    nBufSize    = 0; // Reset buffer size
+                }
+
+                // Determine number of samples to process
+                size_t to_process = lsp_min(samples - offset, fir_size - nBufSize);
+
+                // Push new data for processing and emit processed data
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+                    dsp::copy(&c->vInBuffer[nBufSize], &in[i][offset], to_process);
+                    dsp::copy(&out[i][offset], &c->vOutBuffer[nBufSize], to_process);
+                }
+
+                // Update pointers and counters
+                nBufSize       += to_process;
+                offset         += to_process;
+            }
+        }
+
+        void MultiEqualizer::process_spm(float * const *out, const float * const *in, size_t samples)
+        {
+            const size_t fir_size   = sEq.nFirSize;
+            const size_t fir_rank   = sEq.nFirRank;
+            const size_t half_len   = fir_size >> 1;
+            float *temp             = sEq.vTemp;
+
+            for (size_t offset=0; offset < samples; )
+            {
+                if (nBufSize >= half_len)
+                {
+                    // Apply spectral processing to all channels with the same kernel
+                    for (size_t i=0; i<nChannels; ++i)
+                    {
+                        channel_t *c        = &vChannels[i];
+
+                        dsp::move(c->vOutBuffer, &c->vOutBuffer[half_len], half_len);   // Shift output buffer
+                        dsp::fill_zero(&c->vOutBuffer[half_len], half_len);            // Empty tail of destination buffer
+
+                        dsp::pcomplex_r2c(temp, c->vInBuffer, fir_size);               // Convert source buffer to complex numbers
+                        dsp::packed_direct_fft(temp, temp, fir_rank);                  // Perform FFT
+                        dsp::pcomplex_mul2(temp, sEq.vConv, fir_size);                 // Apply magnitude
+                        dsp::packed_reverse_fft(temp, temp, fir_rank);                 // Transform back
+                        dsp::pcomplex_c2r(temp, temp, fir_size);                       // Add result of convolution to output
+                        dsp::fmadd3(c->vOutBuffer, temp, sEq.vSpmWindow, fir_size);    // Apply window to the signal and add to buffer
+
+                        dsp::move(c->vInBuffer, &c->vInBuffer[half_len], half_len);    // Shift input buffer
+                    }
+
+                    nBufSize    = 0; // Reset buffer size
+                }
+
+                // Determine number of samples to process
+                size_t to_process = lsp_min(samples - offset, half_len - nBufSize);
+
+                // Push new data for processing and emit processed data
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c        = &vChannels[i];
+                    dsp::copy(&c->vInBuffer[half_len + nBufSize], &in[i][offset], to_process);
+                    dsp::copy(&out[i][offset], &c->vOutBuffer[nBufSize], to_process);
+                }
+
+                // Update pointers and counters
+                nBufSize       += to_process;
+                offset         += to_process;
+            }
+        }
+
+        void MultiEqualizer::reset()
+        {
+            sEq.reset();
+            sBank.reset();
+
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                c->sBank.reset();
+                if (c->vInBuffer != NULL)
+                {
+                    const size_t fft_size = sEq.nFirSize << 1;
+                    dsp::fill_zero(c->vInBuffer, fft_size);
+                    dsp::fill_zero(c->vOutBuffer, fft_size);
+                }
+            }
+            nBufSize        = 0;
+        }
+
+        void MultiEqualizer::dump(IStateDumper *v) const
+        {
+            v->write_object("sEq", &sEq);
+            v->write_object("sBank", &sBank);
+
+            v->begin_array("vChannels", vChannels, nChannels);
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                const channel_t *c = &vChannels[i];
+                v->begin_object(c, sizeof(channel_t));
+                {
+                    v->write_object("sBank", &c->sBank);
+                    v->write("vInBuffer", c->vInBuffer);
+                    v->write("vOutBuffer", c->vOutBuffer);
+                }
+                v->end_object();
+            }
+            v->end_array();
+
+            v->write("nChannels", nChannels);
+            v->write("nBufSize", nBufSize);
+            v->write("nFlags", nFlags);
+            v->write("bLanes", bLanes);
+            v->write("pData", pData);
+        }
+
+    } /* namespace dspu */
+} /* namespace lsp */
@@ -0,0 +1,333 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp-units/filters/MultiFilterBank.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        namespace
+        {
+            constexpr size_t MULTI_FILTERBANK_BUF_SIZE      = 0x100;
+            constexpr size_t MULTI_FILTERBANK_DELAYS        = MULTI_FILTERBANK_LANES * 2;
+
+            /**
+             * Apply the chain of filters to the buffer which contains N lanes per sample.
+             * The same transposed direct form II as in dsp::biquad_process_x1() is used,
+             * the inner loop over lanes has constant size and is subject for vectorization.
+             *
+             * @param buf buffer of samples * N floats
+             * @param c chain of filters
+             * @param d delays of the chain, MULTI_FILTERBANK_DELAYS floats per filter
+             * @param items number of filters in chain
+             * @param samples number of samples to process
+             */
+            template <size_t N>
+            void process_lanes(float *buf, const dsp::biquad_x1_t *c, float *d, size_t items, size_t samples)
+            {
+                float d0[N], d1[N];
+
+                for (size_t j=0; j<items; ++j, ++c, d += MULTI_FILTERBANK_DELAYS)
+                {
+                    const float b0  = c->b0;
+                    const float b1  = c->b1;
+                    const float b2  = c->b2;
+                    const float a1  = c->a1;
+                    const float a2  = c->a2;
+
+                    for (size_t k=0; k<N; ++k)
+                    {
+                        d0[k]           = d[k];
+                        d1[k]           = d[k + MULTI_FILTERBANK_LANES];
+                    }
+
+                    float *p        = buf;
+                    for (size_t i=0; i<samples; ++i, p += N)
+                    {
+                        for (size_t k=0; k<N; ++k)
+                        {
+                            const float s   = p[k];
+                            const float s2  = b0*s + d0[k];
+                            d0[k]           = d1[k] + (b1*s + a1*s2);
+                            d1[k]           = b2*s + a2*s2;
+                            p[k]            = s2;
+                        }
+                    }
+
+                    for (size_t k=0; k<N; ++k)
+                    {
+                        d[k]                            = d0[k];
+                        d[k + MULTI_FILTERBANK_LANES]   = d1[k];
+                    }
+                }
+            }
+        } /* namespace */
+
+        MultiFilterBank::MultiFilterBank()
+        {
+            construct();
+        }
+
+        MultiFilterBank::~MultiFilterBank()
+        {
+            destroy();
+        }
+
+        void MultiFilterBank::construct()
+        {
+            vChains     = NULL;
+            vDelays     = NULL;
+            vBuffer     = NULL;
+            nChannels   = 0;
+            nItems      = 0;
+            nMaxItems   = 0;
+            nLastItems  = -1;
+            vData       = NULL;
+        }
+
+        void MultiFilterBank::destroy()
+        {
+            if (vData != NULL)
+            {
+                free_aligned(vData);
+                vData       = NULL;
+            }
+
+            construct();
+        }
+
+        bool MultiFilterBank::init(size_t channels, size_t filters)
+        {
+            destroy();
+
+            if (channels <= 0)
+                return false;
+
+            // Calculate data size
+            size_t groups       = (channels + MULTI_FILTERBANK_LANES - 1) / MULTI_FILTERBANK_LANES;
+            size_t chain_alloc  = align_size(sizeof(dsp::biquad_x1_t) * filters, DEFAULT_ALIGN);
+            size_t delay_alloc  = sizeof(float) * MULTI_FILTERBANK_DELAYS * filters * groups;
+            size_t buf_alloc    = sizeof(float) * MULTI_FILTERBANK_LANES * MULTI_FILTERBANK_BUF_SIZE;
+
+            // Allocate data
+            size_t allocate     = chain_alloc + delay_alloc + buf_alloc;
+            uint8_t *ptr        = alloc_aligned<uint8_t>(vData, allocate, DEFAULT_ALIGN);
+            if (ptr == NULL)
+                return false;
+
+            // Initialize pointers
+            vChains             = advance_ptr_bytes<dsp::biquad_x1_t>(ptr, chain_alloc);
+            vDelays             = advance_ptr_bytes<float>(ptr, delay_alloc);
+            vBuffer             = advance_ptr_bytes<float>(ptr, buf_alloc);
+
+            dsp::fill_zero(vDelays, MULTI_FILTERBANK_DELAYS * filters * groups);
+            dsp::fill_zero(vBuffer, MULTI_FILTERBANK_LANES * MULTI_FILTERBANK_BUF_SIZE);
+
+            // Update parameters
+            nChannels           = channels;
+            nItems              = 0;
+            nMaxItems           = filters;
+            nLastItems          = -1;
+
+            return true;
+        }
+
+        dsp::biquad_x1_t *MultiFilterBank::add_chain()
+        {
+            if (nItems >= nMaxItems)
+                return (nItems <= 0) ? NULL : &vChains[nItems-1];
+            return &vChains[nItems++];
+        }
+
+        dsp::biquad_x1_t *MultiFilterBank::chain(size_t id)
+        {
+            return (id < nItems) ? &vChains[id] : NULL;
+        }
+
+        void MultiFilterBank::end(bool clear)
+        {
+            // Clear delays if structure has changed
+            if ((clear) || (nItems != nLastItems))
+                reset();
+            nLastItems      = nItems;
+        }
+
+        void MultiFilterBank::reset()
+        {
+            const size_t stride = MULTI_FILTERBANK_DELAYS * nMaxItems;
+            float *d            = vDelays;
+
+            for (size_t i=0; i<nChannels; i += MULTI_FILTERBANK_LANES, d += stride)
+                dsp::fill_zero(d, MULTI_FILTERBANK_DELAYS * nItems);
+        }
+
+        void MultiFilterBank::process_group(
+            float * const *dst, const float * const *src, size_t stride,
+            size_t channels, float *d, size_t samples)
+        {
+            // Select the number of lanes
+            const size_t lanes  =
+                (channels > 4) ? 8 :
+                (channels > 2) ? 4 :
+                channels;
+
+            for (size_t offset=0; offset < samples; )
+            {
+                const size_t to_do  = lsp_min(samples - offset, MULTI_FILTERBANK_BUF_SIZE);
+
+                // Put the samples of each channel to its lane
+                for (size_t k=0; k<channels; ++k)
+                {
+                    const float *s      = &src[k][offset * stride];
+                    float *p            = &vBuffer[k];
+                    for (size_t i=0; i<to_do; ++i, s += stride, p += lanes)
+                        *p                  = *s;
+                }
+                for (size_t k=channels; k<lanes; ++k)
+                {
+                    float *p            = &vBuffer[k];
+                    for (size_t i=0; i<to_do; ++i, p += lanes)
+                        *p                  = 0.0f;
+                }
+
+                // Apply filters to all lanes at once
+                switch (lanes)
+                {
+                    case 1: process_lanes<1>(vBuffer, vChains, d, nItems, to_do); break;
+                    case 2: process_lanes<2>(vBuffer, vChains, d, nItems, to_do); break;
+                    case 4: process_lanes<4>(vBuffer, vChains, d, nItems, to_do); break;
+                    default: process_lanes<8>(vBuffer, vChains, d, nItems, to_do); break;
+                }
+
+                // Get the samples of each channel back from its lane
+                for (size_t k=0; k<channels; ++k)
+                {
+                    float *s            = &dst[k][offset * stride];
+                    const float *p      = &vBuffer[k];
+                    for (size_t i=0; i<to_do; ++i, s += stride, p += lanes)
+                        *s                  = *p;
+                }
+
+                offset             += to_do;
+            }
+        }
+
+        void MultiFilterBank::process(float * const *out, const float * const *in, size_t samples)
+        {
+            if (nItems == 0)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                    dsp::copy(out[i], in[i], samples);
+                return;
+            }
+
+            const size_t stride = MULTI_FILTERBANK_DELAYS * nMaxItems;
+            float *d            = vDelays;
+
+            for (size_t i=0; i<nChannels; i += MULTI_FILTERBANK_LANES, d += stride)
+            {
+                const size_t channels   = lsp_min(nChannels - i, MULTI_FILTERBANK_LANES);
+                process_group(&out[i], &in[i], 1, channels, d, samples);
+            }
+        }
+
+        void MultiFilterBank::process_interleaved(float *out, const float *in, size_t samples)
+        {
+            if (nItems == 0)
+            {
+                dsp::copy(out, in, samples * nChannels);
+                return;
+            }
+
+            const size_t stride = MULTI_FILTERBANK_DELAYS * nMaxItems;
+            float *d            = vDelays;
+            float *vout[MULTI_FILTERBANK_LANES];
+            const float *vin[MULTI_FILTERBANK_LANES];
+
+            for (size_t i=0; i<nChannels; i += MULTI_FILTERBANK_LANES, d += stride)
+            {
+                const size_t channels   = lsp_min(nChannels - i, MULTI_FILTERBANK_LANES);
+                for (size_t k=0; k<channels; ++k)
+                {
+                    vout[k]                 = &out[i + k];
+                    vin[k]                  = &in[i + k];
+                }
+                process_group(vout, vin, nChannels, channels, d, samples);
+            }
+        }
+
+        void MultiFilterBank::impulse_response(float *out, size_t samples)
+        {
+            dsp::fill_zero(out, samples);
+            if (samples <= 0)
+                return;
+            out[0]              = 1.0f;
+
+            // Apply each filter with clean delays, the state of channels is not affected
+            for (size_t j=0; j<nItems; ++j)
+            {
+                const dsp::biquad_x1_t *c = &vChains[j];
+                float d0            = 0.0f;
+                float d1            = 0.0f;
+
+                for (size_t i=0; i<samples; ++i)
+                {
+                    const float s       = out[i];
+                    const float s2      = c->b0*s + d0;
+                    d0                  = d1 + (c->b1*s + c->a1*s2);
+                    d1                  = c->b2*s + c->a2*s2;
+                    out[i]              = s2;
+                }
+            }
+        }
+
+        void MultiFilterBank::dump(IStateDumper *v) const
+        {
+            v->begin_array("vChains", vChains, nItems);
+            for (size_t i=0; i<nItems; ++i)
+            {
+                const dsp::biquad_x1_t *c = &vChains[i];
+                v->begin_object(c, sizeof(dsp::biquad_x1_t));
+                {
+                    v->write("b0", c->b0);
+                    v->write("b1", c->b1);
+                    v->write("b2", c->b2);
+                    v->write("a1", c->a1);
+                    v->write("a2", c->a2);
+                }
+                v->end_object();
+            }
+            v->end_array();
+
+            v->write("vDelays", vDelays);
+            v->write("vBuffer", vBuffer);
+            v->write("nChannels", nChannels);
+            v->write("nItems", nItems);
+            v->write("nMaxItems", nMaxItems);
+            v->write("nLastItems", nLastItems);
+            v->write("vData", vData);
+        }
+
+    } /* namespace dspu */
+} /* namespace lsp */
@@ -54,6 +54,32 @@ namespace lsp
 
         static constexpr size_t MIN_GATING_BLOCKS   = 64;
 
+        /**
+         * The histogram covers the range of 100 LU above the absolute gating threshold
+         * (-70 LKFS .. +30 LKFS) with the resolution of 0.1 LU. Values above the range
+         * are accumulated in the last bin.
+         */
+        static constexpr float HIST_RESOLUTION      = 0.1f;
+        static constexpr size_t HIST_BINS           = 1000;
+
+        /**
+         * EBU Tech 3342: the short-term loudness is measured over 3 second window,
+         * relative gating threshold is -20 LU, the loudness range is a difference
+         * between 95% and 10% percentiles of the short-term loudness distribution.
+         */
+        static constexpr float LRA_WINDOW_MS        = 3000.0f;
+        static constexpr float LRA_REL_THRESH       = 0.01f;
+        static constexpr float LRA_LOW_PERCENTILE   = 0.10f;
+        static constexpr float LRA_HIGH_PERCENTILE  = 0.95f;
+
+        static inline size_t histogram_bin(float value)
+        {
+            const float index   = (10.0f / HIST_RESOLUTION) * log10f(value / GATING_ABS_THRESH);
+            if (index <= 0.0f)
+                return 0;
+            return (index < float(HIST_BINS)) ? size_t(index) : HIST_BINS - 1;
+        }
+
         ILUFSMeter::ILUFSMeter()
         {
             construct();
@@ -69,12 +95,20 @@ namespace lsp
             vChannels           = NULL;
             vBuffer             = NULL;
             vLoudness           = NULL;
+            vSTParts            = NULL;
+            histogram_clear(&sIntHist);
+            histogram_clear(&sLraHist);
+            sIntHist.vCount     = NULL;
+            sIntHist.vSum       = NULL;
+            sLraHist.vCount     = NULL;
+            sLraHist.vSum       = NULL;
 
             fBlockPeriod        = 0.0f;
             fIntTime            = 0.0f;
             fMaxIntTime         = 0.0f;
             fAvgCoeff           = 0.0f;
             fLoudness           = 0.0f;
+            fRange              = 0.0f;
 
             nBlockSize          = 0;
             nBlockOffset        = 0;
@@ -83,11 +117,15 @@ namespace lsp
             nMSHead             = 0;
             nMSInt              = 0;
             nMSCount            = 0;
+            nSTParts            = 0;
+            nSTHead             = 0;
+            nSTCount            = 0;
 
             nSampleRate         = 0;
             nChannels           = 0;
             nFlags              = 0;
             enWeight            = bs::WEIGHT_K;
+            bHistogram          = false;
 
             pData               = NULL;
             pVarData            = NULL;
@@ -108,6 +146,11 @@ namespace lsp
                 pData               = NULL;
                 vChannels           = NULL;
                 vBuffer             = NULL;
+                vSTParts            = NULL;
+                sIntHist.vCount     = NULL;
+                sIntHist.vSum       = NULL;
+                sLraHist.vCount     = NULL;
+                sLraHist.vSum       = NULL;
             }
 
             if (pVarData != NULL)
@@ -123,11 +166,17 @@ namespace lsp
             destroy();
 
             // Allocate data
+            const size_t st_parts       = lsp_max(size_t(LRA_WINDOW_MS / (block_period * 0.25f) + 0.5f), size_t(1));
             const size_t szof_channels  = align_size(channels * sizeof(channel_t), DEFAULT_ALIGN);
             const size_t szof_buffer    = align_size(sizeof(float) * BUFFER_SIZE, DEFAULT_ALIGN);
+            const size_t szof_st_parts  = align_size(sizeof(float) * st_parts, DEFAULT_ALIGN);
+            const size_t szof_hsum      = align_size(sizeof(double) * HIST_BINS, DEFAULT_ALIGN);
+            const size_t szof_hcount    = align_size(sizeof(uint32_t) * HIST_BINS, DEFAULT_ALIGN);
             const size_t to_alloc       =
                 szof_channels +
-                szof_buffer;
+                szof_buffer +
+                szof_st_parts +
+                (szof_hsum + szof_hcount) * 2;
 
             uint8_t *ptr            = alloc_aligned<uint8_t>(pData, to_alloc, DEFAULT_ALIGN);
             if (ptr == NULL)
@@ -136,9 +185,17 @@ namespace lsp
             // Allocate buffers
             vChannels               = advance_ptr_bytes<channel_t>(ptr, szof_channels);
             vBuffer                 = advance_ptr_bytes<float>(ptr, szof_buffer);
+            vSTParts                = advance_ptr_bytes<float>(ptr, szof_st_parts);
+            sIntHist.vSum           = advance_ptr_bytes<double>(ptr, szof_hsum);
+            sLraHist.vSum           = advance_ptr_bytes<double>(ptr, szof_hsum);
+            sIntHist.vCount         = advance_ptr_bytes<uint32_t>(ptr, szof_hcount);
+            sLraHist.vCount         = advance_ptr_bytes<uint32_t>(ptr, szof_hcount);
 
             // Cleanup and init state for each channel
             dsp::fill_zero(vBuffer, BUFFER_SIZE);
+            dsp::fill_zero(vSTParts, st_parts);
+            histogram_clear(&sIntHist);
+            histogram_clear(&sLraHist);
             for (size_t i=0; i<channels; ++i)
             {
                 channel_t *c            = &vChannels[i];
@@ -194,6 +251,7 @@ namespace lsp
             fMaxIntTime             = max_int_time;
             fAvgCoeff               = 1.0f;
             fLoudness               = 0.0f;
+            fRange                  = 0.0f;
 
             nBlockSize              = 0;
             nBlockOffset            = 0;
@@ -203,11 +261,15 @@ namespace lsp
             nMSHead                 = 0;
             nMSInt                  = 0;
             nMSCount                = 0;
+            nSTParts                = uint32_t(st_parts);
+            nSTHead                 = 0;
+            nSTCount                = 0;
 
             nSampleRate             = 0;
             nChannels               = uint32_t(channels);
             nFlags                  = F_UPD_ALL;
             enWeight                = bs::WEIGHT_K;
+            bHistogram              = false;
 
             return STATUS_OK;
         }
@@ -287,6 +349,19 @@ namespace lsp
             nFlags         |= F_UPD_TIME;
         }
 
+        void ILUFSMeter::set_histogram(bool enable)
+        {
+            if (bHistogram == enable)
+                return;
+
+            bHistogram      = enable;
+            nMSHead         = 0;
+            nMSCount        = 0;
+            fLoudness       = 0.0f;
+            clear_block_buffers();
+            clear_histograms();
+        }
+
         status_t ILUFSMeter::set_sample_rate(size_t sample_rate)
         {
             if (nSampleRate == sample_rate)
@@ -330,7 +405,7 @@ namespace lsp
             {
                 const float lj      = vLoudness[tail];
                 tail                = (tail + 1) % nMSSize;
-                if (lj <= GATING_ABS_THRESH)
+                if (lj <= threshold)
                     continue;
 
                 ++blocks;
@@ -353,6 +428,116 @@ namespace lsp
             return loudness;
         }
 
+        void ILUFSMeter::histogram_clear(histogram_t *h)
+        {
+            if (h->vCount != NULL)
+            {
+                for (size_t i=0; i<HIST_BINS; ++i)
+                {
+                    h->vCount[i]        = 0;
+                    h->vSum[i]          = 0.0;
+                }
+            }
+            h->fSum             = 0.0;
+            h->nCount           = 0;
+        }
+
+        void ILUFSMeter::histogram_add(histogram_t *h, float value)
+        {
+            const size_t bin    = histogram_bin(value);
+
+            ++h->vCount[bin];
+            h->vSum[bin]       += value;
+            ++h->nCount;
+            h->fSum            += value;
+        }
+
+        float ILUFSMeter::compute_histogram_loudness() const
+        {
+            const histogram_t *h    = &sIntHist;
+            if (h->nCount <= 0)
+                return 0.0f;
+
+            // 1. The histogram contains only blocks above the absolute threshold
+            const float loudness    = h->fSum / double(h->nCount);
+            const float thresh      = loudness * GATING_REL_THRESH;
+            if (thresh <= GATING_ABS_THRESH)
+                return loudness;
+
+            // 2. Apply relative gating with the precision of one histogram bin
+            double sum              = 0.0;
+            size_t count            = 0;
+            for (size_t i=histogram_bin(thresh); i<HIST_BINS; ++i)
+            {
+                sum                    += h->vSum[i];
+                count                  += h->vCount[i];
+            }
+
+            return (count > 0) ? sum / double(count) : 0.0f;
+        }
+
+        float ILUFSMeter::compute_loudness_range() const
+        {
+            const histogram_t *h    = &sLraHist;
+            if (h->nCount <= 0)
+                return 0.0f;
+
+            // Apply relative gating
+            const float thresh      = (h->fSum / double(h->nCount)) * LRA_REL_THRESH;
+            const size_t first      = (thresh > GATING_ABS_THRESH) ? histogram_bin(thresh) : 0;
+            size_t count            = 0;
+            for (size_t i=first; i<HIST_BINS; ++i)
+                count                  += h->vCount[i];
+            if (count <= 0)
+                return 0.0f;
+
+            // Find bins that contain the low and the high percentiles
+            const size_t lo_index   = size_t(float(count - 1) * LRA_LOW_PERCENTILE + 0.5f);
+            const size_t hi_index   = size_t(float(count - 1) * LRA_HIGH_PERCENTILE + 0.5f);
+            size_t lo               = first;
+            size_t hi               = first;
+
+            for (size_t i=first, index=0; i<HIST_BINS; ++i)
+            {
+                const size_t next       = index + h->vCount[i];
+                if ((lo_index >= index) && (lo_index < next))
+                    lo                      = i;
+                if ((hi_index >= index) && (hi_index < next))
+                {
+                    hi                      = i;
+                    break;
+                }
+                index                   = next;
+            }
+
+            return float(hi - lo) * HIST_RESOLUTION;
+        }
+
+        void ILUFSMeter::process_short_term(size_t part)
+        {
+            // Store the loudness of the block part
+            float loudness      = 0.0f;
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                const channel_t *c  = &vChannels[i];
+                loudness           += c->fWeight * c->vBlock[part];
+            }
+
+            vSTParts[nSTHead]   = loudness;
+            nSTHead             = (nSTHead + 1) % nSTParts;
+            if (nSTCount < nSTParts)
+            {
+                if ((++nSTCount) < nSTParts)
+                    return;
+            }
+
+            // Compute the short-term loudness over the whole window, the sum is
+            // re-computed each time to avoid accumulation of floating-point errors
+            loudness            = dsp::h_sum(vSTParts, nSTParts) * (4.0f * fAvgCoeff / float(nSTParts));
+            if (loudness > GATING_ABS_THRESH)
+                histogram_add(&sLraHist, loudness);
+        }
+
         void ILUFSMeter::process(float *out, size_t count, float gain)
         {
             update_settings();
@@ -388,6 +573,8 @@ namespace lsp
                 {
                     // Reset block size and advance positions
                     nBlockOffset            = 0;
+                    if (bHistogram)
+                        process_short_term(nBlockPart);
                     if ((++nBlockPart) >= 4)
                     {
                         nBlockPart              = 0;
@@ -411,7 +598,16 @@ namespace lsp
                         // Compute integrated loudness, two-stage
                         // There is no necessity to apply the second stage if the loudness threshold
                         // is less than absolute threshold
-                        if (nMSInt > 0)
+                        if (bHistogram)
+                        {
+                            // Histogram stores only blocks above the absolute threshold
+                            if (loudness > GATING_ABS_THRESH)
+                                histogram_add(&sIntHist, loudness);
+
+                            loudness                = compute_histogram_loudness();
+                            fRange                  = compute_loudness_range();
+                        }
+                        else if (nMSInt > 0)
                         {
                             // Increment number of blocks for processing
                             nMSCount                = lsp_min(nMSCount + 1, nMSInt);
@@ -531,6 +727,18 @@ namespace lsp
             nFlags                 &= ~F_BLK_FULL;
         }
 
+        void ILUFSMeter::clear_histograms()
+        {
+            histogram_clear(&sIntHist);
+            histogram_clear(&sLraHist);
+            if (vSTParts != NULL)
+                dsp::fill_zero(vSTParts, nSTParts);
+
+            fRange                  = 0.0f;
+            nSTHead                 = 0;
+            nSTCount                = 0;
+        }
+
         void ILUFSMeter::clear()
         {
             for (size_t i=0; i<nChannels; ++i)
@@ -539,6 +747,7 @@ namespace lsp
                 c->sBank.reset();
             }
             clear_block_buffers();
+            clear_histograms();
 
             fLoudness               = 0.0f;
 
@@ -577,12 +786,30 @@ namespace lsp
 
             v->write("vBuffer", vBuffer);
             v->write("vLoudness", vLoudness);
+            v->write("vSTParts", vSTParts);
+            v->begin_object("sIntHist", &sIntHist, sizeof(histogram_t));
+            {
+                v->writev("vCount", sIntHist.vCount, HIST_BINS);
+                v->writev("vSum", sIntHist.vSum, HIST_BINS);
+                v->write("fSum", sIntHist.fSum);
+                v->write("nCount", sIntHist.nCount);
+            }
+            v->end_object();
+            v->begin_object("sLraHist", &sLraHist, sizeof(histogram_t));
+            {
+                v->writev("vCount", sLraHist.vCount, HIST_BINS);
+                v->writev("vSum", sLraHist.vSum, HIST_BINS);
+                v->write("fSum", sLraHist.fSum);
+                v->write("nCount", sLraHist.nCount);
+            }
+            v->end_object();
 
             v->write("fBlockPeriod", fBlockPeriod);
             v->write("fIntTime", fIntTime);
             v->write("fMaxIntTime", fMaxIntTime);
             v->write("fAvgCoeff", fAvgCoeff);
             v->write("fLoudness", fLoudness);
+            v->write("fRange", fRange);
 
             v->write("nBlockSize", nBlockSize);
             v->write("nBlockOffset", nBlockOffset);
@@ -591,11 +818,15 @@ namespace lsp
             v->write("nMSHead", nMSHead);
             v->write("nMSInt", nMSInt);
             v->write("nMSCount", nMSCount);
+            v->write("nSTParts", nSTParts);
+            v->write("nSTHead", nSTHead);
+            v->write("nSTCount", nSTCount);
 
             v->write("nSampleRate", nSampleRate);
             v->write("nChannels", nChannels);
             v->write("nFlags", nFlags);
             v->write("enWeight", enWeight);
+            v->write("bHistogram", bHistogram);
 
             v->write("pData", pData);
             v->write("pVarData", pVarData);
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp-units/misc/follower.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+#define FOLLOWER_TILE_SIZE      64
+
+namespace lsp
+{
+    namespace dspu
+    {
+        namespace follower
+        {
+            LSP_DSP_UNITS_PUBLIC
+            void init(lanes_t *l)
+            {
+                for (size_t k=0; k<MAX_LANES; ++k)
+                {
+                    l->vEnvelope[k]     = 0.0f;
+                    l->vPeak[k]         = 0.0f;
+                    l->vHold[k]         = 0;
+                    l->vHoldMax[k]      = 0;
+                }
+
+                for (size_t r=0; r<MAX_REACTIONS; ++r)
+                {
+                    for (size_t k=0; k<MAX_LANES; ++k)
+                    {
+                        l->vAttackLvl[r][k]     = (r > 0) ? INFINITY : 0.0f;
+                        l->vAttackTau[r][k]     = 0.0f;
+                        l->vReleaseLvl[r][k]    = (r > 0) ? INFINITY : 0.0f;
+                        l->vReleaseTau[r][k]    = 0.0f;
+                    }
+                }
+
+                l->nAttack          = 1;
+                l->nRelease         = 1;
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            void set_reaction(lanes_t *l, size_t lane, bool release, size_t index, float level, float tau)
+            {
+                if ((lane >= MAX_LANES) || (index >= MAX_REACTIONS))
+                    return;
+
+                if (release)
+                {
+                    l->vReleaseLvl[index][lane] = (index > 0) ? level : 0.0f;
+                    l->vReleaseTau[index][lane] = tau;
+                    l->nRelease                 = lsp_max(l->nRelease, uint32_t(index + 1));
+                }
+                else
+                {
+                    l->vAttackLvl[index][lane]  = (index > 0) ? level : 0.0f;
+                    l->vAttackTau[index][lane]  = tau;
+                    l->nAttack                  = lsp_max(l->nAttack, uint32_t(index + 1));
+                }
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            void process(float * const *out, const float * const *in, lanes_t *l, size_t lanes, size_t samples)
+            {
+                float tile[FOLLOWER_TILE_SIZE][MAX_LANES] __lsp_aligned32;
+                float env[MAX_LANES] __lsp_aligned32;
+                float peak[MAX_LANES] __lsp_aligned32;
+                int32_t hold[MAX_LANES] __lsp_aligned32;
+                float ta[MAX_LANES] __lsp_aligned32;
+                float tr[MAX_LANES] __lsp_aligned32;
+
+                lanes               = lsp_min(lanes, MAX_LANES);
+                const size_t na     = l->nAttack;
+                const size_t nr     = l->nRelease;
+
+                // Load state, unused lanes are kept zero
+                for (size_t k=0; k<MAX_LANES; ++k)
+                {
+                    env[k]              = l->vEnvelope[k];
+                    peak[k]             = l->vPeak[k];
+                    hold[k]             = l->vHold[k];
+                }
+
+                for (size_t offset=0; offset < samples; )
+                {
+                    const size_t to_do  = lsp_min(samples - offset, size_t(FOLLOWER_TILE_SIZE));
+
+                    // Interleave input data
+                    for (size_t k=0; k<lanes; ++k)
+                    {
+                        const float *src    = &in[k][offset];
+                        for (size_t i=0; i<to_do; ++i)
+                            tile[i][k]          = src[i];
+                    }
+                    for (size_t k=lanes; k<MAX_LANES; ++k)
+                        for (size_t i=0; i<to_do; ++i)
+                            tile[i][k]          = 0.0f;
+
+                    // Process all lanes at once, all conditions are computed as selects
+                    for (size_t i=0; i<to_do; ++i)
+                    {
+                        float *t            = tile[i];
+
+                        // Select the reaction depending on the current envelope value
+                        for (size_t k=0; k<MAX_LANES; ++k)
+                        {
+                            ta[k]               = l->vAttackTau[0][k];
+                            tr[k]               = l->vReleaseTau[0][k];
+                        }
+                        for (size_t r=1; r<na; ++r)
+                            for (size_t k=0; k<MAX_LANES; ++k)
+                                ta[k]               = (env[k] >= l->vAttackLvl[r][k]) ? l->vAttackTau[r][k] : ta[k];
+                        for (size_t r=1; r<nr; ++r)
+                            for (size_t k=0; k<MAX_LANES; ++k)
+                                tr[k]               = (env[k] >= l->vReleaseLvl[r][k]) ? l->vReleaseTau[r][k] : tr[k];
+
+                        // Update envelope, peak and hold counter
+                        for (size_t k=0; k<MAX_LANES; ++k)
+                        {
+                            const float e       = env[k];
+                            const float d       = t[k] - e;
+                            const bool fall     = d < 0.0f;
+                            const bool wait     = fall && (hold[k] > 0);
+                            const float en      = (wait) ? e : e + ((fall) ? tr[k] : ta[k]) * d;
+                            const bool rise     = (!fall) && (en >= peak[k]);
+
+                            peak[k]             = (fall) ? ((wait) ? peak[k] : en) : ((rise) ? en : peak[k]);
+                            hold[k]             = (wait) ? hold[k] - 1 : ((rise) ? l->vHoldMax[k] : hold[k]);
+                            env[k]              = en;
+                            t[k]                = en;
+                        }
+                    }
+
+                    // De-interleave output data
+                    for (size_t k=0; k<lanes; ++k)
+                    {
+                        float *dst          = &out[k][offset];
+                        for (size_t i=0; i<to_do; ++i)
+                            dst[i]              = tile[i][k];
+                    }
+
+                    offset             += to_do;
+                }
+
+                // Store state
+                for (size_t k=0; k<lanes; ++k)
+                {
+                    l->vEnvelope[k]     = env[k];
+                    l->vPeak[k]         = peak[k];
+                    l->vHold[k]         = hold[k];
+                }
+            }
+
+        } /* namespace follower */
+    } /* namespace dspu */
+} /* namespace lsp */
@@ -199,7 +199,7 @@ namespace lsp
         {
             if (!valid())
                 return -1;
-            return (pPlayback->pSample != NULL) ? pPlayback->pSample->length() : -1;
+            return (pPlayback->pSample != NULL) ? pPlayback->pSample->full_length() : -1;
         }
 
         sample_loop_t Playback::loop_mode() const
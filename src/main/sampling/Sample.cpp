@@ -20,6 +20,7 @@
  */
 
 #include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/atomic.h>
 #include <lsp-plug.in/common/debug.h>
 #include <lsp-plug.in/common/finally.h>
 #include <lsp-plug.in/dsp/dsp.h>
@@ -31,6 +32,8 @@
 #include <lsp-plug.in/fmt/sfz/DocumentProcessor.h>
 #include <lsp-plug.in/fmt/sfz/IDocumentHandler.h>
 #include <lsp-plug.in/io/OutFileStream.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/lltl/parray.h>
 #include <lsp-plug.in/mm/InAudioFileStream.h>
 #include <lsp-plug.in/mm/OutAudioFileStream.h>
 #include <lsp-plug.in/runtime/system.h>
@@ -44,6 +47,7 @@ namespace lsp
         static constexpr float  RESAMPLING_KPERIODS = 32.0f;
         static constexpr float  RESAMPLING_RPERIODS = 1.0f / RESAMPLING_KPERIODS;
         static constexpr float  RESAMPLING_PI       = M_PI;
+        static constexpr size_t PARALLEL_RANGE      = 0x4000;
 
         namespace
         {
@@ -145,6 +149,254 @@ namespace lsp
                 path->remove();
                 delete path;
             }
+
+            typedef void (*sample_task_t)(void *arg, size_t index);
+
+            // Worker thread which fetches tasks from the shared task counter
+            class TaskWorker: public ipc::Thread
+            {
+                private:
+                    sample_task_t       pTask;
+                    void               *pArg;
+                    volatile uatomic_t *pNext;
+                    size_t              nTasks;
+
+                public:
+                    TaskWorker(sample_task_t task, void *arg, volatile uatomic_t *next, size_t tasks)
+                    {
+                        pTask       = task;
+                        pArg        = arg;
+                        pNext       = next;
+                        nTasks      = tasks;
+                    }
+
+                    TaskWorker(const TaskWorker &) = delete;
+                    TaskWorker(TaskWorker &&) = delete;
+                    TaskWorker & operator = (const TaskWorker &) = delete;
+                    TaskWorker & operator = (TaskWorker &&) = delete;
+
+                public:
+                    void process()
+                    {
+                        while (true)
+                        {
+                            const uatomic_t index = atomic_load(pNext);
+                            if (index >= nTasks)
+                                break;
+                            if (atomic_cas(pNext, index, index + 1))
+                                pTask(pArg, index);
+                        }
+                    }
+
+                    virtual status_t run() override
+                    {
+                        dsp::context_t ctx;
+                        dsp::start(&ctx);
+                        process();
+                        dsp::finish(&ctx);
+
+                        return STATUS_OK;
+                    }
+            };
+
+            /**
+             * Execute the set of independent tasks using the specified number of threads.
+             * The caller thread also takes part in processing, so if supplementary threads
+             * can not be launched, all tasks still become processed.
+             *
+             * @param task task routine
+             * @param arg argument passed to the task routine
+             * @param tasks number of tasks
+             * @param threads overall number of threads including the caller thread
+             */
+            static void run_tasks(sample_task_t task, void *arg, size_t tasks, size_t threads)
+            {
+                volatile uatomic_t next = 0;
+                lltl::parray<TaskWorker> workers;
+                lsp_finally {
+                    for (size_t i=0, n=workers.size(); i<n; ++i)
+                    {
+                        TaskWorker *w = workers.uget(i);
+                        w->join();
+                        delete w;
+                    }
+                    workers.flush();
+                };
+
+                // Launch supplementary threads
+                for (size_t i=1, n=lsp_min(threads, tasks); i<n; ++i)
+                {
+                    TaskWorker *w   = new TaskWorker(task, arg, &next, tasks);
+                    if (w == NULL)
+                        break;
+                    if (w->start() != STATUS_OK)
+                    {
+                        delete w;
+                        break;
+                    }
+                    if (!workers.add(w))
+                    {
+                        w->join();
+                        delete w;
+                        break;
+                    }
+                }
+
+                // Take part in processing
+                TaskWorker self(task, arg, &next, tasks);
+                self.process();
+            }
+
+            // Polyphase convolution job: the output of each channel is split into ranges,
+            // each task owns the range and applies all kernels that overlap it in the same
+            // order as the serial loop does, so the result is bit-identical
+            typedef struct convolve_job_t
+            {
+                const Sample       *pSrc;           // Source sample
+                Sample             *pDst;           // Destination sample
+                const float        *vKernels;       // Kernel for each phase
+                const ssize_t      *vOffsets;       // Output offset for each phase
+                size_t              nPhases;        // Number of phases (source step)
+                size_t              nStep;          // Destination step
+                size_t              nKSize;         // Size of each kernel
+                size_t              nRange;         // Size of the output range processed by single task
+                size_t              nRanges;        // Number of ranges per channel
+            } convolve_job_t;
+
+            static void convolve_task(void *arg, size_t index)
+            {
+                const convolve_job_t *job   = static_cast<const convolve_job_t *>(arg);
+                const size_t channel        = index / job->nRanges;
+                const ssize_t x_first       = (index % job->nRanges) * job->nRange;
+                const ssize_t x_last        = lsp_min(x_first + ssize_t(job->nRange), ssize_t(job->pDst->length()));
+                const ssize_t k_size        = job->nKSize;
+                const ssize_t step          = job->nStep;
+                const size_t length         = job->pSrc->length();
+                const float *src            = job->pSrc->channel(channel);
+                float *dst                  = job->pDst->channel(channel);
+
+                for (size_t i=0; i<job->nPhases; ++i)
+                {
+                    const float *k      = &job->vKernels[i * k_size];
+                    ssize_t xp          = job->vOffsets[i];
+
+                    // Skip kernels that end before the owned range
+                    const ssize_t skip  = x_first - xp - k_size;
+                    const size_t n      = (skip >= 0) ? skip / step + 1 : 0;
+                    xp                 += n * step;
+
+                    for (size_t j=i + n * job->nPhases; (j < length) && (xp < x_last); j += job->nPhases, xp += step)
+                    {
+                        const ssize_t first = lsp_max(xp, x_first);
+                        const ssize_t last  = lsp_min(xp + k_size, x_last);
+                        dsp::fmadd_k3(&dst[first], &k[first - xp], src[j], last - first);
+                    }
+                }
+            }
+
+            static void convolve_phases(convolve_job_t *job, size_t threads)
+            {
+                const size_t length = job->pDst->length();
+                job->nRange         = (threads > 1) ? lsp_max(length / threads, PARALLEL_RANGE) : length;
+                job->nRange         = lsp_max(job->nRange, size_t(1));
+                job->nRanges        = (length + job->nRange - 1) / job->nRange;
+
+                run_tasks(convolve_task, job, job->pSrc->channels() * job->nRanges, threads);
+            }
+
+            // Anti-aliasing filter job, one task per channel
+            typedef struct filter_job_t
+            {
+                const Sample       *pSrc;           // Source sample
+                Sample             *pDst;           // Destination sample
+                Filter             *vFilters;       // Filter for each channel
+            } filter_job_t;
+
+            static void filter_task(void *arg, size_t index)
+            {
+                const filter_job_t *job     = static_cast<const filter_job_t *>(arg);
+                job->vFilters[index].process(job->pDst->channel(index), job->pSrc->channel(index), job->pSrc->length());
+            }
+
+            // Stretch job: each chunk is rendered only within the range owned by the task,
+            // chunks are applied in the same order as the serial loop does
+            typedef void (*stretch_func_t)(float *dst, const float *src, size_t len, size_t fade_in, size_t fade_out, size_t first, size_t last);
+
+            typedef struct stretch_chunk_t
+            {
+                size_t              nDstOff;        // Offset in the stretched region
+                size_t              nSrcOff;        // Offset in the source region
+                size_t              nLength;        // Length of the chunk
+                size_t              nFadeIn;        // Length of the fade-in
+                size_t              nFadeOut;       // Length of the fade-out
+            } stretch_chunk_t;
+
+            typedef struct stretch_job_t
+            {
+                const Sample           *pSrc;           // Source sample
+                Sample                 *pDst;           // Destination sample
+                stretch_func_t          pPutChunk;      // Chunk rendering function
+                const stretch_chunk_t  *vChunks;        // List of chunks
+                size_t                  nChunks;        // Number of chunks
+                size_t                  nStart;         // Start of the stretched region
+                size_t                  nEnd;           // End of the stretched region in the source sample
+                size_t                  nNewLength;     // New length of the stretched region
+                size_t                  nRange;         // Size of the output range processed by single task
+                size_t                  nRanges;        // Number of ranges per channel
+            } stretch_job_t;
+
+            static void copy_range(float *dst, const float *src, size_t first, size_t last, size_t from, size_t to)
+            {
+                first   = lsp_max(first, from);
+                last    = lsp_min(last, to);
+                if (first < last)
+                    dsp::copy(&dst[first], &src[first - from], last - first);
+            }
+
+            static void stretch_task(void *arg, size_t index)
+            {
+                const stretch_job_t *job    = static_cast<const stretch_job_t *>(arg);
+                const size_t channel        = index / job->nRanges;
+                const size_t x_first        = (index % job->nRanges) * job->nRange;
+                const size_t x_last         = lsp_min(x_first + job->nRange, job->pDst->length());
+                const size_t s_end          = job->nStart + job->nNewLength;
+                const float *src            = job->pSrc->channel(channel);
+                float *dst                  = job->pDst->channel(channel);
+
+                // Copy data, fill the stretched area with zeros
+                copy_range(dst, src, x_first, x_last, 0, job->nStart);
+                copy_range(dst, &src[job->nEnd], x_first, x_last, s_end, job->pDst->length());
+                const size_t z_first        = lsp_max(x_first, job->nStart);
+                const size_t z_last         = lsp_min(x_last, s_end);
+                if (z_first >= z_last)
+                    return;
+                dsp::fill_zero(&dst[z_first], z_last - z_first);
+
+                // Put chunks onto the stretched area with crossfades applied
+                src    += job->nStart;
+                dst    += job->nStart;
+                for (size_t i=0; i<job->nChunks; ++i)
+                {
+                    const stretch_chunk_t *c    = &job->vChunks[i];
+                    const size_t first          = lsp_max(z_first, job->nStart + c->nDstOff);
+                    const size_t last           = lsp_min(z_last, job->nStart + c->nDstOff + c->nLength);
+                    if (first < last)
+                        job->pPutChunk(
+                            &dst[c->nDstOff], &src[c->nSrcOff], c->nLength,
+                            c->nFadeIn, c->nFadeOut,
+                            first - job->nStart - c->nDstOff, last - job->nStart - c->nDstOff);
+                }
+            }
+
+            static void stretch_chunks(stretch_job_t *job, size_t threads)
+            {
+                const size_t length = job->pDst->length();
+                job->nRange         = (threads > 1) ? lsp_max(length / threads, PARALLEL_RANGE) : length;
+                job->nRange         = lsp_max(job->nRange, size_t(1));
+                job->nRanges        = (length + job->nRange - 1) / job->nRange;
+
+                run_tasks(stretch_task, job, job->pSrc->channels() * job->nRanges, threads);
+            }
         } /* namespace */
 
         static size_t gcd_euclid(size_t a, size_t b)
@@ -178,6 +430,8 @@ namespace lsp
             nGcRefs         = 0;
             pGcNext         = NULL;
             pUserData       = NULL;
+            pStream         = NULL;
+            nStreamLength   = 0;
         }
 
         void Sample::destroy()
@@ -187,6 +441,7 @@ namespace lsp
                 free(vBuffer);
                 vBuffer     = NULL;
             }
+            drop_stream();
             nMaxLength      = 0;
             nLength         = 0;
             nChannels       = 0;
@@ -213,9 +468,10 @@ namespace lsp
                 return false;
             dsp::fill_zero(buf, cap * channels);
 
-            // Destroy previous data
+            // Destroy previous data, the sample is not streamed anymore
             if (vBuffer != NULL)
                 free(vBuffer);
+            drop_stream();
 
             vBuffer         = buf;
             nLength         = length;
@@ -224,6 +480,16 @@ namespace lsp
             return true;
         }
 
+        void Sample::drop_stream()
+        {
+            if (pStream != NULL)
+            {
+                delete pStream;
+                pStream         = NULL;
+            }
+            nStreamLength   = 0;
+        }
+
         status_t Sample::copy(const Sample *s)
         {
             if (s == this)
@@ -234,6 +500,22 @@ namespace lsp
                 (s->vBuffer == NULL))
                 return STATUS_BAD_STATE;
 
+            // Duplicate the location of the streamed sample
+            io::Path *stream = NULL;
+            lsp_finally {
+                if (stream != NULL)
+                    delete stream;
+            };
+            if (s->pStream != NULL)
+            {
+                stream          = new io::Path();
+                if (stream == NULL)
+                    return STATUS_NO_MEM;
+                status_t res    = stream->set(s->pStream);
+                if (res != STATUS_OK)
+                    return res;
+            }
+
             // Allocate new data
             size_t len      = lsp_max(s->nLength, size_t(DEFAULT_ALIGN));
             size_t cap      = align_size(len, DEFAULT_ALIGN);       // Make multiple of 4
@@ -258,6 +540,10 @@ namespace lsp
             nMaxLength      = cap;
             nChannels       = s->nChannels;
 
+            drop_stream();
+            lsp::swap(pStream, stream);
+            nStreamLength   = s->nStreamLength;
+
             return STATUS_OK;
         }
 
@@ -282,6 +568,7 @@ namespace lsp
                 }
 
                 nLength         = length;
+                drop_stream();
                 return true;
             }
 
@@ -320,6 +607,7 @@ namespace lsp
             }
             else
                 dsp::fill_zero(buf, max_length * channels);
+            drop_stream();
 
             vBuffer         = buf;
             nLength         = length;
@@ -396,63 +684,53 @@ namespace lsp
             return insert(0, samples);
         }
 
-        void Sample::put_chunk_linear(float *dst, const float *src, size_t len, size_t fade_in, size_t fade_out)
+        void Sample::put_chunk_linear(float *dst, const float *src, size_t len, size_t fade_in, size_t fade_out, size_t first, size_t last)
         {
             // Apply the fade-in (if present)
             if (fade_in > 0)
             {
                 float k = 1.0f / fade_in;
-                for (size_t i=0; i<fade_in; ++i)
+                for (size_t i=first, n=lsp_min(last, fade_in); i<n; ++i)
                     dst[i] += src[i] * (i * k);
-                dst    += fade_in;
-                src    += fade_in;
             }
 
             // Apply non-modified data
-            size_t unmodified = len - fade_in - fade_out;
-            if (unmodified > 0)
-            {
-                dsp::add2(dst, src, unmodified);
-                dst    += unmodified;
-                src    += unmodified;
-            }
+            size_t u_first  = lsp_max(first, fade_in);
+            size_t u_last   = lsp_min(last, len - fade_out);
+            if (u_last > u_first)
+                dsp::add2(&dst[u_first], &src[u_first], u_last - u_first);
 
             // Apply the fade-out (if present)
             if (fade_out > 0)
             {
                 float k = 1.0f / fade_out;
-                for (size_t i=0; i<fade_out; ++i)
-                    dst[i] += src[i] * ((fade_out - i) * k);
+                for (size_t i=lsp_max(first, len - fade_out); i<last; ++i)
+                    dst[i] += src[i] * ((len - i) * k);
             }
         }
 
-        void Sample::put_chunk_const_power(float *dst, const float *src, size_t len, size_t fade_in, size_t fade_out)
+        void Sample::put_chunk_const_power(float *dst, const float *src, size_t len, size_t fade_in, size_t fade_out, size_t first, size_t last)
         {
             // Apply the fade-in (if present)
             if (fade_in > 0)
             {
                 float k = 1.0f / fade_in;
-                for (size_t i=0; i<fade_in; ++i)
+                for (size_t i=first, n=lsp_min(last, fade_in); i<n; ++i)
                     dst[i] += src[i] * sqrtf(i * k);
-                dst    += fade_in;
-                src    += fade_in;
             }
 
             // Apply non-modified data
-            size_t unmodified = len - fade_in - fade_out;
-            if (unmodified > 0)
-            {
-                dsp::add2(dst, src, unmodified);
-                dst    += unmodified;
-                src    += unmodified;
-            }
+            size_t u_first  = lsp_max(first, fade_in);
+            size_t u_last   = lsp_min(last, len - fade_out);
+            if (u_last > u_first)
+                dsp::add2(&dst[u_first], &src[u_first], u_last - u_first);
 
             // Apply the fade-out (if present)
             if (fade_out > 0)
             {
                 float k = 1.0f / fade_out;
-                for (size_t i=0; i<fade_out; ++i)
-                    dst[i] += src[i] * sqrtf((fade_out - i) * k);
+                for (size_t i=lsp_max(first, len - fade_out); i<last; ++i)
+                    dst[i] += src[i] * sqrtf((len - i) * k);
             }
         }
 
@@ -483,7 +761,7 @@ namespace lsp
             return STATUS_OK;
         }
 
-        status_t Sample::do_single_crossfade_stretch(size_t new_length, size_t fade_len, size_t start, size_t end, put_chunk_t put_chunk)
+        status_t Sample::do_single_crossfade_stretch(size_t new_length, size_t fade_len, size_t start, size_t end, put_chunk_t put_chunk, size_t threads)
         {
             dspu::Sample tmp;
 
@@ -499,21 +777,31 @@ namespace lsp
             size_t c1_size  = (new_length + fade_len) >> 1;
             size_t c2_size  = new_length - c1_size + fade_len;
 
-            // Perform stretching
-            for (size_t i=0; i<nChannels; ++i)
-            {
-                const float *src    = channel(i);
-                float *dst          = tmp.channel(i);
+            // Put two chunks onto the stretched area with crossfades applied
+            stretch_chunk_t chunks[2];
+            chunks[0].nDstOff   = 0;
+            chunks[0].nSrcOff   = 0;
+            chunks[0].nLength   = c1_size;
+            chunks[0].nFadeIn   = 0;
+            chunks[0].nFadeOut  = fade_len;
 
-                // Copy data, fill the stretched area with zeros
-                dsp::copy(dst, src, start);
-                dsp::fill_zero(&dst[start], new_length);
-                dsp::copy(&dst[start + new_length], &src[end], nLength-end);
+            chunks[1].nDstOff   = new_length - c2_size;
+            chunks[1].nSrcOff   = end - start - c2_size;
+            chunks[1].nLength   = c2_size;
+            chunks[1].nFadeIn   = fade_len;
+            chunks[1].nFadeOut  = 0;
 
-                // Put two chunks onto the stretched area with crossfades applied
-                put_chunk(&dst[start], &src[start], c1_size, 0, fade_len);
-                put_chunk(&dst[start + new_length - c2_size], &src[end - c2_size], c2_size, fade_len, 0);
-            }
+            // Perform stretching
+            stretch_job_t job;
+            job.pSrc        = this;
+            job.pDst        = &tmp;
+            job.pPutChunk   = put_chunk;
+            job.vChunks     = chunks;
+            job.nChunks     = 2;
+            job.nStart      = start;
+            job.nEnd        = end;
+            job.nNewLength  = new_length;
+            stretch_chunks(&job, threads);
 
             // Swap the contents and return success
             tmp.swap(this);
@@ -525,8 +813,14 @@ namespace lsp
             sample_crossfade_t fade_type, float fade_size,
             size_t start, size_t end)
         {
-            size_t doff, soff;
+            return stretch(new_length, chunk_size, fade_type, fade_size, start, end, 1);
+        }
 
+        status_t Sample::stretch(
+            size_t new_length, size_t chunk_size,
+            sample_crossfade_t fade_type, float fade_size,
+            size_t start, size_t end, size_t threads)
+        {
             // Verify that the proper values have been submitted
             if ((start > nLength) || (end > nLength) || (start > end))
                 return STATUS_BAD_ARGUMENTS;
@@ -563,7 +857,7 @@ namespace lsp
             // Special case: the new length does not allow to cross-fade at least 2 chunks
             size_t fade_length      = chunk_size * fade_size;
             if ((new_length + fade_length) <= (chunk_size * 2))
-                return do_single_crossfade_stretch(new_length, fade_length, start, end, put_chunk);
+                return do_single_crossfade_stretch(new_length, fade_length, start, end, put_chunk, threads);
 
             // Compute the effective length of the chunk and number of chunks
             // We also need to make the new length multiple of the effective_length of the chunk
@@ -580,32 +874,43 @@ namespace lsp
                 return STATUS_NO_MEM;
             tmp.set_sample_rate(nSampleRate);
 
-            // Perform stretching
-            for (size_t i=0; i<nChannels; ++i)
+            // Build the list of chunks: first chunk, intermediate chunks and last chunk
+            stretch_chunk_t *chunks = static_cast<stretch_chunk_t *>(malloc(sizeof(stretch_chunk_t) * (n_chunks + 1)));
+            if (chunks == NULL)
+                return STATUS_NO_MEM;
+            lsp_finally { free(chunks); };
+
+            chunks[0].nDstOff       = 0;
+            chunks[0].nSrcOff       = 0;
+            chunks[0].nLength       = chunk_size;
+            chunks[0].nFadeIn       = 0;
+            chunks[0].nFadeOut      = fade_length;
+            for (size_t j=1; j<n_chunks; ++j)
             {
-                const float *src    = channel(i);
-                float *dst          = tmp.channel(i);
-
-                // Copy data, fill the stretched area with zeros
-                dsp::copy(dst, src, start);
-                dsp::fill_zero(&dst[start], new_length);
-                dsp::copy(&dst[start + new_length], &src[end], nLength-end);
-                src    += start;
-                dst    += start;
-
-                // Put chunks onto the stretched area with crossfades applied
-//                lsp_trace("put chunk 0 -> 0 x %d", int(chunk_size));
-                put_chunk(dst, src, chunk_size, 0, fade_length); // First chunk
-                for (size_t j=1; j<n_chunks; ++j)
-                {
-                    soff      = (j * (src_length - chunk_size)) / (n_chunks - 1);
-                    doff      = j * eff_chunk_len;
-//                    lsp_trace("put chunk %d -> %d x %d", int(soff), int(doff), int(chunk_size));
-                    put_chunk(&dst[doff], &src[soff], chunk_size, fade_length, fade_length); // Intermediate chunk
-                }
-//                lsp_trace("put chunk %d -> %d x %d", int(src_length - last_chunk_len), int(new_length - last_chunk_len), int(last_chunk_len));
-                put_chunk(&dst[new_length - last_chunk_len], &src[src_length - last_chunk_len], last_chunk_len, fade_length, 0); // Last chunk
+                stretch_chunk_t *c      = &chunks[j];
+                c->nDstOff              = j * eff_chunk_len;
+                c->nSrcOff              = (j * (src_length - chunk_size)) / (n_chunks - 1);
+                c->nLength              = chunk_size;
+                c->nFadeIn              = fade_length;
+                c->nFadeOut             = fade_length;
             }
+            chunks[n_chunks].nDstOff    = new_length - last_chunk_len;
+            chunks[n_chunks].nSrcOff    = src_length - last_chunk_len;
+            chunks[n_chunks].nLength    = last_chunk_len;
+            chunks[n_chunks].nFadeIn    = fade_length;
+            chunks[n_chunks].nFadeOut   = 0;
+
+            // Perform stretching
+            stretch_job_t job;
+            job.pSrc        = this;
+            job.pDst        = &tmp;
+            job.pPutChunk   = put_chunk;
+            job.vChunks     = chunks;
+            job.nChunks     = n_chunks + 1;
+            job.nStart      = start;
+            job.nEnd        = end;
+            job.nNewLength  = new_length;
+            stretch_chunks(&job, threads);
 
             // Swap the contents and return success
             tmp.swap(this);
@@ -632,6 +937,8 @@ namespace lsp
             lsp::swap(nMaxLength, dst->nMaxLength);
             lsp::swap(nLength, dst->nLength);
             lsp::swap(nChannels, dst->nChannels);
+            lsp::swap(pStream, dst->pStream);
+            lsp::swap(nStreamLength, dst->nStreamLength);
         }
 
         ssize_t Sample::save_range(const char *path, size_t offset, ssize_t count) const
@@ -1012,7 +1319,7 @@ namespace lsp
             return STATUS_OK;
         }
 
-        status_t Sample::fast_upsample(Sample *s, size_t new_sample_rate)
+        status_t Sample::fast_upsample(Sample *s, size_t new_sample_rate, size_t threads)
         {
             // Calculate parameters of transformation
             ssize_t kf          = new_sample_rate / nSampleRate;
@@ -1044,16 +1351,22 @@ namespace lsp
                 RESAMPLING_KPERIODS * RESAMPLING_PI, RESAMPLING_RPERIODS,
                 k_size);
 
-            // Iterate each channel
+            // Perform convolutions
+            const ssize_t offset    = 0;
+            convolve_job_t job;
+            job.pSrc            = this;
+            job.pDst            = s;
+            job.vKernels        = k;
+            job.vOffsets        = &offset;
+            job.nPhases         = 1;
+            job.nStep           = kf;
+            job.nKSize          = k_size;
+            convolve_phases(&job, threads);
+
+            // Copy the data to the file content
             for (size_t c=0; c<nChannels; ++c)
             {
-                const float *src    = &vBuffer[c * nMaxLength];
                 float *dst          = &s->vBuffer[c * s->nMaxLength];
-
-                // Perform convolutions
-                for (size_t i=0, p=0; i<nLength; i++, p += kf)
-                    dsp::fmadd_k3(&dst[p], k, src[i], k_size);
-
                 dsp::move(dst, &dst[k_center], s->nLength - k_center);
             }
 
@@ -1063,7 +1376,7 @@ namespace lsp
             return STATUS_OK;
         }
 
-        status_t Sample::complex_upsample(Sample *s, size_t new_sample_rate)
+        status_t Sample::complex_upsample(Sample *s, size_t new_sample_rate, size_t threads)
         {
             // Calculate parameters of transformation
             ssize_t gcd         = gcd_euclid(new_sample_rate, nSampleRate);
@@ -1072,15 +1385,17 @@ namespace lsp
             float kf            = float(dst_step) / float(src_step);
             const float rkf     = (RESAMPLING_PI * float(src_step)) / float(dst_step);
 
-            // Prepare kernel for resampling
+            // Prepare kernels for resampling, one kernel per phase
             ssize_t k_base      = RESAMPLING_KPERIODS * kf;
             ssize_t k_center    = k_base + 1;
             ssize_t k_len       = (k_center << 1) + 1; // Centered impulse response
             ssize_t k_size      = align_size(k_len + 1, 4); // Additional sample for time offset
-            float *k            = static_cast<float *>(malloc(sizeof(float) * k_size));
-            if (k == NULL)
+            uint8_t *data       = static_cast<uint8_t *>(malloc((sizeof(float) * k_size + sizeof(ssize_t)) * src_step));
+            if (data == NULL)
                 return STATUS_NO_MEM;
-            lsp_finally { free(k); };
+            lsp_finally { free(data); };
+            float *k            = advance_ptr_bytes<float>(data, sizeof(float) * k_size * src_step);
+            ssize_t *offsets    = advance_ptr_bytes<ssize_t>(data, sizeof(ssize_t) * src_step);
 
             // Estimate resampled sample size
             size_t new_samples  = kf * nLength;
@@ -1092,35 +1407,33 @@ namespace lsp
 
             s->set_sample_rate(new_sample_rate);
 
-            // Iterate each channel
+            // Generate kernel for each phase
             for (ssize_t i=0; i<src_step; ++i)
             {
                 // calculate the offset between nearest samples
                 const ssize_t p = kf * i;
                 const float dt  = float(i)*kf - float(p);
+                offsets[i]      = p;
 
                 // Generate Lanczos kernel
                 dsp::lanczos1(
-                    k,
+                    &k[i * k_size],
                     rkf, (k_center + dt) * rkf,
                     RESAMPLING_KPERIODS * RESAMPLING_PI, RESAMPLING_RPERIODS,
                     k_size);
-
-                for (size_t c=0; c<nChannels; ++c)
-                {
-                    const float *src    = &vBuffer[c * nMaxLength];
-                    float *dst          = &s->vBuffer[c * s->nMaxLength];
-                    ssize_t xp          = p;
-
-                    // Perform convolutions
-                    for (size_t j=i; j<nLength; j += src_step)
-                    {
-                        dsp::fmadd_k3(&dst[xp], k, src[j], k_size);
-                        xp             += dst_step;
-                    }
-                }
             }
 
+            // Perform convolutions
+            convolve_job_t job;
+            job.pSrc            = this;
+            job.pDst            = s;
+            job.vKernels        = k;
+            job.vOffsets        = offsets;
+            job.nPhases         = src_step;
+            job.nStep           = dst_step;
+            job.nKSize          = k_size;
+            convolve_phases(&job, threads);
+
             // Copy the data to the file content
             for (size_t c=0; c<nChannels; ++c)
             {
@@ -1134,7 +1447,7 @@ namespace lsp
             return STATUS_OK;
         }
 
-        status_t Sample::complex_downsample(Sample *s, size_t new_sample_rate)
+        status_t Sample::complex_downsample(Sample *s, size_t new_sample_rate, size_t threads)
         {
             // Calculate parameters of transformation
             ssize_t gcd         = gcd_euclid(new_sample_rate, nSampleRate);
@@ -1143,15 +1456,17 @@ namespace lsp
             float kf            = float(dst_step) / float(src_step);
             const float rkf     = (RESAMPLING_PI * float(src_step)) / float(dst_step);
 
-            // Prepare kernel for resampling
+            // Prepare kernels for resampling, one kernel per phase
             float k_periods     = RESAMPLING_KPERIODS * RESAMPLING_PI * rkf; // Number of periods
             ssize_t k_center    = RESAMPLING_KPERIODS + 1.0f;
             ssize_t k_len       = (k_center << 1) + rkf + 1; // Centered impulse response
             ssize_t k_size      = align_size(k_len + 1, 4); // Additional sample for time offset
-            float *k            = static_cast<float *>(malloc(sizeof(float) * k_size));
-            if (k == NULL)
+            uint8_t *data       = static_cast<uint8_t *>(malloc((sizeof(float) * k_size + sizeof(ssize_t)) * src_step));
+            if (data == NULL)
                 return STATUS_NO_MEM;
-            lsp_finally { free(k); };
+            lsp_finally { free(data); };
+            float *k            = advance_ptr_bytes<float>(data, sizeof(float) * k_size * src_step);
+            ssize_t *offsets    = advance_ptr_bytes<ssize_t>(data, sizeof(ssize_t) * src_step);
 
             // Estimate resampled sample size
             size_t new_samples  = kf * nLength;
@@ -1162,35 +1477,33 @@ namespace lsp
                 return STATUS_NO_MEM;
             s->set_sample_rate(new_sample_rate);
 
-            // Iterate each channel
+            // Generate kernel for each phase
             for (ssize_t i=0; i<src_step; ++i)
             {
                 // calculate the offset between nearest samples
                 const ssize_t p = kf * i;
                 const float dt  = float(i)*kf - float(p); // Always positive, in range of [0..1]
+                offsets[i]      = p;
 
                 // Generate Lanczos kernel
                 dsp::lanczos1(
-                    k,
+                    &k[i * k_size],
                     rkf, (k_center + dt) * rkf,
                     k_periods, RESAMPLING_RPERIODS,
                     k_size);
-
-                for (size_t c=0; c<nChannels; ++c)
-                {
-                    const float *src    = &vBuffer[c * nMaxLength];
-                    float *dst          = &s->vBuffer[c * s->nMaxLength];
-                    ssize_t xp          = p;
-
-                    // Perform convolutions
-                    for (size_t j=i; j<nLength; j += src_step)
-                    {
-                        dsp::fmadd_k3(&dst[xp], k, src[j], k_size);
-                        xp                 += dst_step;
-                    }
-                }
             }
 
+            // Perform convolutions
+            convolve_job_t job;
+            job.pSrc            = this;
+            job.pDst            = s;
+            job.vKernels        = k;
+            job.vOffsets        = offsets;
+            job.nPhases         = src_step;
+            job.nStep           = dst_step;
+            job.nKSize          = k_size;
+            convolve_phases(&job, threads);
+
             // Copy the data to the file content
             for (size_t c=0; c<nChannels; ++c)
             {
@@ -1205,6 +1518,11 @@ namespace lsp
         }
 
         status_t Sample::resample(size_t new_sample_rate)
+        {
+            return resample(new_sample_rate, 1);
+        }
+
+        status_t Sample::resample(size_t new_sample_rate, size_t threads)
         {
             if (nChannels <= 0)
                 return STATUS_BAD_STATE;
@@ -1217,14 +1535,13 @@ namespace lsp
             {
                 // Need to up-sample data
                 res = ((new_sample_rate % nSampleRate) == 0) ?
-                        fast_upsample(&tmp, new_sample_rate) :
-                        complex_upsample(&tmp, new_sample_rate);
+                        fast_upsample(&tmp, new_sample_rate, threads) :
+                        complex_upsample(&tmp, new_sample_rate, threads);
             }
             else if (new_sample_rate < nSampleRate)
             {
-                // Step 1: prepare temporary sample and filter
+                // Step 1: prepare temporary sample and filters
                 Sample ff;
-                Filter flt;
                 filter_params_t fp;
 
                 fp.nType    = FLT_BT_LRX_LOPASS;
@@ -1234,27 +1551,33 @@ namespace lsp
                 fp.nSlope   = 4;
                 fp.fQuality = 0.75f;
 
-                if (!flt.init(NULL))
+                Filter *flt = new Filter[nChannels];
+                if (flt == NULL)
                     return STATUS_NO_MEM;
+                lsp_finally { delete [] flt; };
+
+                for (size_t c=0; c<nChannels; ++c)
+                {
+                    if (!flt[c].init(NULL))
+                        return STATUS_NO_MEM;
+                    flt[c].update(nSampleRate, &fp);
+                }
                 if (!ff.init(nChannels, nLength, nLength))
                     return STATUS_NO_MEM;
 
                 ff.set_sample_rate(nSampleRate);
-                flt.update(nSampleRate, &fp);
 
                 // Step 2: remove all frequencies above new nyquist frequency
-                for (size_t c=0; c<nChannels; ++c)
-                {
-                    const float *src    = &vBuffer[c * nMaxLength];
-                    float *dst          = &ff.vBuffer[c * ff.nMaxLength];
-                    flt.clear();
-                    flt.process(dst, src, nLength);
-                }
+                filter_job_t job;
+                job.pSrc        = this;
+                job.pDst        = &ff;
+                job.vFilters    = flt;
+                run_tasks(filter_task, &job, nChannels, threads);
 
                 // Need to down-sample data of the pre-filtered sample
                 res = ((nSampleRate % new_sample_rate) == 0) ?
                         ff.fast_downsample(&tmp, new_sample_rate) :
-                        ff.complex_downsample(&tmp, new_sample_rate);
+                        ff.complex_downsample(&tmp, new_sample_rate, threads);
             }
             else
                 return STATUS_OK; // Sample rate matches
@@ -1320,6 +1643,93 @@ namespace lsp
             return (res != STATUS_OK) ? res : res2;
         }
 
+        status_t Sample::load_streamed(const char *path, float head)
+        {
+            io::Path tmp;
+            status_t res = tmp.set(path);
+            return (res == STATUS_OK) ? load_streamed(&tmp, head) : res;
+        }
+
+        status_t Sample::load_streamed(const LSPString *path, float head)
+        {
+            io::Path tmp;
+            status_t res = tmp.set(path);
+            return (res == STATUS_OK) ? load_streamed(&tmp, head) : res;
+        }
+
+        status_t Sample::load_streamed(const io::Path *path, float head)
+        {
+            return do_load_streamed(path, -1, head);
+        }
+
+        status_t Sample::loads_streamed(const char *path, size_t head)
+        {
+            io::Path tmp;
+            status_t res = tmp.set(path);
+            return (res == STATUS_OK) ? loads_streamed(&tmp, head) : res;
+        }
+
+        status_t Sample::loads_streamed(const LSPString *path, size_t head)
+        {
+            io::Path tmp;
+            status_t res = tmp.set(path);
+            return (res == STATUS_OK) ? loads_streamed(&tmp, head) : res;
+        }
+
+        status_t Sample::loads_streamed(const io::Path *path, size_t head)
+        {
+            return do_load_streamed(path, head, 0.0f);
+        }
+
+        status_t Sample::do_load_streamed(const io::Path *path, ssize_t head, float duration)
+        {
+            mm::IInAudioStream *in = NULL;
+            status_t res = open_stream_ext(&in, path);
+            if (res != STATUS_OK)
+                return res;
+            lsp_finally {
+                in->close();
+                delete in;
+            };
+
+            mm::audio_stream_t fmt;
+            if ((res = in->info(&fmt)) != STATUS_OK)
+                return res;
+            if (head < 0)
+                head            = ssize_t(lsp_max(fmt.srate * duration, 0.0f));
+
+            // Load the whole file if the length is unknown or the file is short enough
+            if ((fmt.frames < 0) || (fmt.frames <= wssize_t(head)))
+                return loads(in, -1);
+
+            // Remember the location of the file
+            io::Path *stream = new io::Path();
+            if (stream == NULL)
+                return STATUS_NO_MEM;
+            lsp_finally {
+                if (stream != NULL)
+                    delete stream;
+            };
+            if ((res = stream->set(path)) != STATUS_OK)
+                return res;
+
+            // Load the head part of the file, loads() drops the previous streaming state
+            if ((res = loads(in, head)) != STATUS_OK)
+                return res;
+
+            lsp::swap(pStream, stream);
+            nStreamLength   = fmt.frames;
+
+            return STATUS_OK;
+        }
+
+        status_t Sample::open_stream(mm::IInAudioStream **is)
+        {
+            if (pStream == NULL)
+                return STATUS_BAD_STATE;
+            return open_stream_ext(is, pStream);
+        }
+
         status_t Sample::open_stream_ext(mm::IInAudioStream **is, const io::Path *path)
         {
             // Try to load regular file
@@ -1512,6 +1922,8 @@ namespace lsp
             v->write("nGcRefs", nGcRefs);
             v->write("pGcNext", pGcNext);
             v->write("pUserData", pUserData);
+            v->write("pStream", pStream);
+            v->write("nStreamLength", nStreamLength);
         }
     } /* namespace dspu */
 } /* namespace lsp */
@@ -46,6 +46,7 @@ namespace lsp
         {
             // Stop any pending playbacks
             stop();
+            disable_streaming();
             // Release all held pointers to samples
             unbind_all();
 
@@ -72,6 +73,8 @@ namespace lsp
             vSamples        = NULL;
             vPlayback       = NULL;
             nPlayback       = 0;
+            vActive         = NULL;
+            nActive         = 0;
             sActive.pHead   = NULL;
             sActive.pTail   = NULL;
             sInactive.pHead = NULL;
@@ -94,6 +97,8 @@ namespace lsp
             nSamples        = 0;
             vPlayback       = NULL;
             nPlayback       = 0;
+            vActive         = NULL;
+            nActive         = 0;
             sActive.pHead   = NULL;
             sActive.pTail   = NULL;
             sInactive.pHead = NULL;
@@ -101,6 +106,8 @@ namespace lsp
             fGain           = 1.0f;
             pData           = NULL;
             pGcList         = NULL;
+
+            sStreamer.construct();
         }
 
         bool SamplePlayer::init(size_t max_samples, size_t max_playbacks)
@@ -113,7 +120,8 @@ namespace lsp
             size_t szof_buffer      = BUFFER_SIZE * sizeof(float);
             size_t szof_samples     = align_size(sizeof(Sample *) * max_samples, SAMPLER_ALIGN);
             size_t szof_playback    = align_size(sizeof(play_item_t) * max_playbacks, SAMPLER_ALIGN);
-            size_t to_alloc         = szof_buffer + szof_samples + szof_playback;
+            size_t szof_active      = align_size(sizeof(play_item_t *) * max_playbacks, SAMPLER_ALIGN);
+            size_t to_alloc         = szof_buffer + szof_samples + szof_playback + szof_active;
 
             uint8_t *data           = NULL;
             uint8_t *ptr            = alloc_aligned<uint8_t>(data, to_alloc, SAMPLER_ALIGN);
@@ -131,10 +139,12 @@ namespace lsp
             vBuffer             = advance_ptr_bytes<float>(ptr, szof_buffer);
             vSamples            = advance_ptr_bytes<Sample *>(ptr, szof_samples);
             vPlayback           = advance_ptr_bytes<play_item_t>(ptr, szof_playback);
+            vActive             = advance_ptr_bytes<play_item_t *>(ptr, szof_active);
             lsp_assert( ptr <= end );
 
             nSamples            = max_samples;
             nPlayback           = max_playbacks;
+            nActive             = 0;
             for (size_t i=0; i<max_samples; ++i)
                 vSamples[i]         = NULL;
 
@@ -151,6 +161,7 @@ namespace lsp
 
                 // Initialize playback fields
                 playback::clear_playback(curr);
+                curr->nIndex    = -1;
 
                 // Link
                 curr->pPrev     = last;
@@ -238,6 +249,21 @@ namespace lsp
             prev->pNext         = pb;
         }
 
+        inline void SamplePlayer::active_add(play_item_t *pb)
+        {
+            pb->nIndex              = nActive;
+            vActive[nActive++]      = pb;
+        }
+
+        inline void SamplePlayer::active_remove(play_item_t *pb)
+        {
+            // Move the last playback to the place of removed one
+            play_item_t *last       = vActive[--nActive];
+            vActive[pb->nIndex]     = last;
+            last->nIndex            = pb->nIndex;
+            pb->nIndex              = -1;
+        }
+
         Sample *SamplePlayer::acquire_sample(Sample *s)
         {
             if (s != NULL)
@@ -259,6 +285,98 @@ namespace lsp
             s = NULL;
         }
 
+        bool SamplePlayer::enable_streaming(size_t capacity)
+        {
+            if (vPlayback == NULL)
+                return false;
+
+            disable_streaming();
+            if (!sStreamer.init(nPlayback, capacity))
+                return false;
+
+            // Bind streams to playbacks and start streaming for active playbacks
+            for (size_t i=0; i<nPlayback; ++i)
+                vPlayback[i].pStream    = sStreamer.stream(i);
+            for (play_item_t *pb = sActive.pHead; pb != NULL; pb = pb->pNext)
+                start_stream(pb);
+
+            return true;
+        }
+
+        void SamplePlayer::disable_streaming()
+        {
+            if (!streaming())
+                return;
+
+            // Stop the reader thread first, it does not access samples after that
+            sStreamer.stop();
+
+            // Unbind streams from playbacks and release samples held by streams
+            for (size_t i=0; i<nPlayback; ++i)
+                vPlayback[i].pStream    = NULL;
+            for (size_t i=0, n=sStreamer.streams(); i<n; ++i)
+            {
+                playback::stream_t *s   = sStreamer.stream(i);
+                release_sample(s->pSample);
+                release_sample(s->pNext);
+            }
+
+            sStreamer.destroy();
+        }
+
+        size_t SamplePlayer::stream_position(const play_item_t *pb)
+        {
+            // The streaming starts at the end of the part loaded into memory
+            const playback::batch_t *b  = &pb->sBatch[0];
+            const size_t head           = pb->pSample->length();
+            if (b->nStart < b->nEnd)
+                return lsp_max(b->nStart, head);
+
+            // For the reverse playback the beginning of the batch should be at the end of the buffer
+            const size_t cap            = pb->pStream->nCapacity;
+            return lsp_max((b->nStart > cap) ? b->nStart - cap : 0, head);
+        }
+
+        void SamplePlayer::start_stream(play_item_t *pb)
+        {
+            playback::stream_t *s   = pb->pStream;
+            if (s == NULL)
+                return;
+            if ((pb->pSample == NULL) || (!pb->pSample->streamed()))
+            {
+                stop_stream(pb);
+                return;
+            }
+
+            Sample *old = playback::request_stream(s, acquire_sample(pb->pSample), pb->nChannel, stream_position(pb));
+            release_sample(old);
+            old         = playback::submit_stream(s);
+            release_sample(old);
+        }
+
+        void SamplePlayer::stop_stream(play_item_t *pb)
+        {
+            // Close the stream only if it is in use
+            playback::stream_t *s   = pb->pStream;
+            if ((s == NULL) || ((s->pSample == NULL) && (s->pNext == NULL)))
+                return;
+
+            Sample *old = playback::request_stream(s, NULL, 0, 0);
+            release_sample(old);
+            old         = playback::submit_stream(s);
+            release_sample(old);
+        }
+
+        void SamplePlayer::submit_streams()
+        {
+            // Submit requests that have been queued while the reader was busy
+            for (size_t i=0, n=sStreamer.streams(); i<n; ++i)
+            {
+                Sample *old = playback::submit_stream(sStreamer.stream(i));
+                release_sample(old);
+            }
+        }
+
         bool SamplePlayer::bind(size_t id, Sample *sample)
         {
             if ((id >= nSamples) || (vSamples == NULL))
@@ -325,40 +443,55 @@ namespace lsp
 
         void SamplePlayer::do_process(float *dst, size_t samples, uint32_t flags)
         {
+            submit_streams();
+
             for (size_t offset=0; offset<samples; )
             {
                 const size_t to_do    = lsp_min(samples - offset, BUFFER_SIZE);
 
-                // Process playback in 'play' state
-                for (play_item_t *curr = sActive.pHead; curr != NULL; )
+                // Process active playbacks stored in the contiguous array
+                for (size_t i=0; i<nActive; )
                 {
-                    // The link of the playback can be changed, so we need
-                    // to remember the pointer to the next playback in list first
-                    play_item_t *pb     = curr;
-                    curr                = curr->pNext;
+                    play_item_t *pb     = vActive[i];
 
                     // Skip playback if flag does not match it's mode
                     const uint32_t flag     = (pb->bListen) ? SAMPLER_LISTEN : SAMPLER_PLAYBACK;
                     if (!(flags & flag))
+                    {
+                        ++i;
                         continue;
+                    }
 
                     // Process playback
-                    dsp::fill_zero(vBuffer, to_do);
-                    size_t processed    = playback::process_playback(vBuffer, pb, to_do);
+                    const float gain    = pb->fVolume * fGain;
+                    size_t processed;
+                    if (pb->enState == playback::STATE_CANCEL)
+                    {
+                        // The fade-out is applied to the rendered data in-place,
+                        // so the playback needs to be rendered separately
+                        dsp::fill_zero(vBuffer, to_do);
+                        processed           = playback::process_playback(vBuffer, pb, to_do);
+                        if (processed > 0)
+                            dsp::fmadd_k3(&dst[offset], vBuffer, gain, processed);
+                    }
+                    else
+                        processed           = playback::process_playback(&dst[offset], pb, to_do, gain);
+
                     if (processed <= 0)
                     {
                         // Reset playback
+                        stop_stream(pb);
                         release_sample(pb->pSample);
                         playback::reset_playback(pb);
 
-                        // Move to inactive
+                        // Move to inactive, the last active playback takes the place of current one
                         list_remove(&sActive, pb);
                         list_add_first(&sInactive, pb);
+                        active_remove(pb);
                         continue;
                     }
 
-                    // Deploy playback to the destination buffer
-                    dsp::fmadd_k3(&dst[offset], vBuffer, pb->fVolume * fGain, processed);
+                    ++i;
                 }
 
                 offset     += to_do;
@@ -404,9 +537,12 @@ namespace lsp
 
             // Initialize playback state
             playback::start_playback(pb, acquire_sample(s), settings);
+            start_stream(pb);
 
             // Add the playback to the active list
             list_insert_from_tail(&sActive, pb);
+            if (pb->nIndex < 0)
+                active_add(pb);
 
             return Playback(pb);
         }
@@ -450,9 +586,12 @@ namespace lsp
             // Reset all playbacks
             for (play_item_t *pb = sActive.pHead; pb != NULL; pb = pb->pNext)
             {
+                stop_stream(pb);
                 release_sample(pb->pSample);
                 playback::reset_playback(pb);
+                pb->nIndex          = -1;
             }
+            nActive             = 0;
 
             // Move all data from active list to the beginning of inactive
             if (sInactive.pHead == NULL)
@@ -500,18 +639,22 @@ namespace lsp
                         playback::dump_playback_plain(v, p);
                         v->write("pNext", p->pNext);
                         v->write("pPrev", p->pPrev);
+                        v->write("nIndex", p->nIndex);
                     }
                     v->end_object();
                 }
             }
             v->end_array();
             v->write("nPlayback", nPlayback);
+            v->writev("vActive", vActive, nActive);
+            v->write("nActive", nActive);
 
             dump_list(v, "sActive", &sActive);
             dump_list(v, "sInactive", &sInactive);
 
             v->write("fGain", fGain);
             v->write("pData", pData);
+            v->write_object("sStreamer", &sStreamer);
 
             // Estimate size of the GC list
             size_t gc_size = 0;
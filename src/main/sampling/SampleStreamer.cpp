@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/common/debug.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/sampling/SampleStreamer.h>
+
+#define STREAMER_BUFFER_SIZE        0x4000  /* Size of the temporary buffer of the reader thread in samples */
+#define STREAMER_ALIGN              0x40
+
+namespace lsp
+{
+    namespace dspu
+    {
+        SampleStreamer::Reader::Reader(SampleStreamer *streamer)
+        {
+            pStreamer           = streamer;
+        }
+
+        SampleStreamer::Reader::~Reader()
+        {
+            pStreamer           = NULL;
+        }
+
+        status_t SampleStreamer::Reader::run()
+        {
+            while (!ipc::Thread::is_cancelled())
+            {
+                // Sleep until the request is submitted or the ring buffer can be filled if there was nothing to do
+                if (!pStreamer->serve())
+                    pStreamer->pSignal->wait();
+            }
+
+            return STATUS_OK;
+        }
+
+        SampleStreamer::SampleStreamer()
+        {
+            construct();
+        }
+
+        SampleStreamer::~SampleStreamer()
+        {
+            destroy();
+        }
+
+        void SampleStreamer::construct()
+        {
+            vStreams            = NULL;
+            nStreams            = 0;
+            nCapacity           = 0;
+            vBuffer             = NULL;
+            pReader             = NULL;
+            pSignal             = NULL;
+            pData               = NULL;
+        }
+
+        bool SampleStreamer::init(size_t streams, size_t capacity)
+        {
+            destroy();
+
+            if ((streams <= 0) || (capacity <= 0))
+                return false;
+
+            // Allocate memory
+            capacity                = align_size(capacity, STREAMER_ALIGN / sizeof(float));
+            size_t szof_streams     = align_size(sizeof(playback::stream_t) * streams, STREAMER_ALIGN);
+            size_t szof_buffer      = STREAMER_BUFFER_SIZE * sizeof(float);
+            size_t szof_ring        = capacity * 2 * sizeof(float);
+            size_t to_alloc         = szof_streams + szof_buffer + szof_ring * streams;
+
+            uint8_t *ptr            = alloc_aligned<uint8_t>(pData, to_alloc, STREAMER_ALIGN);
+            if (ptr == NULL)
+                return false;
+
+            // Create the signal of the reader thread
+            pSignal                 = new Semaphore();
+            if ((pSignal == NULL) || (!pSignal->valid()))
+            {
+                destroy();
+                return false;
+            }
+
+            vStreams                = advance_ptr_bytes<playback::stream_t>(ptr, szof_streams);
+            vBuffer                 = advance_ptr_bytes<float>(ptr, szof_buffer);
+            nStreams                = streams;
+            nCapacity               = capacity;
+
+            for (size_t i=0; i<streams; ++i)
+            {
+                float *data             = advance_ptr_bytes<float>(ptr, szof_ring);
+                dsp::fill_zero(data, capacity * 2);
+                playback::init_stream(&vStreams[i], data, capacity, pSignal);
+            }
+
+            // Launch the reader thread
+            pReader                 = new Reader(this);
+            if (pReader == NULL)
+            {
+                destroy();
+                return false;
+            }
+            if (pReader->start() != STATUS_OK)
+            {
+                destroy();
+                return false;
+            }
+
+            return true;
+        }
+
+        void SampleStreamer::stop()
+        {
+            // Stop the reader thread
+            if (pReader != NULL)
+            {
+                pReader->cancel();
+                pSignal->post();
+                pReader->join();
+                delete pReader;
+                pReader             = NULL;
+            }
+
+            // Close all audio streams
+            for (size_t i=0; i<nStreams; ++i)
+                playback::close_stream(&vStreams[i]);
+        }
+
+        void SampleStreamer::destroy()
+        {
+            stop();
+
+            if (pSignal != NULL)
+            {
+                delete pSignal;
+                pSignal             = NULL;
+            }
+
+            free_aligned(pData);
+            construct();
+        }
+
+        bool SampleStreamer::serve()
+        {
+            bool served = false;
+            for (size_t i=0; i<nStreams; ++i)
+            {
+                if (playback::serve_stream(&vStreams[i], vBuffer, STREAMER_BUFFER_SIZE))
+                    served      = true;
+            }
+
+            return served;
+        }
+
+        void SampleStreamer::dump(IStateDumper *v) const
+        {
+            v->begin_array("vStreams", vStreams, nStreams);
+            {
+                for (size_t i=0; i<nStreams; ++i)
+                    playback::dump_stream(v, &vStreams[i]);
+            }
+            v->end_array();
+            v->write("nStreams", nStreams);
+            v->write("nCapacity", nCapacity);
+            v->write("vBuffer", vBuffer);
+            v->write("pReader", pReader);
+            v->write("pSignal", pSignal);
+            v->write("pData", pData);
+        }
+
+    } /* namespace dspu */
+} /* namespace lsp */
@@ -79,7 +79,7 @@ namespace lsp
              *  0    t0   t1            t2         t3
              */
             LSP_DSP_UNITS_PUBLIC
-            size_t put_batch_linear_direct(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples)
+            size_t put_batch_linear_direct(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples, float gain, size_t origin)
             {
                 // Direct playback, compute batch size and position
                 size_t t3   = b->nEnd   - b->nStart;        // Batch size in samples
@@ -88,23 +88,24 @@ namespace lsp
                     return 0;
 
                 size_t t    = t0;                           // Current rendering position inside of the batch
-                src        += b->nStart;                    // Adjust pointer for simplification of pointer arithmetics
+                src        += b->nStart + t0 - origin;      // Pointer to the sample at the current rendering position
 
                 // Render the fade-in
                 size_t t1   = b->nFadeIn;
                 if (t < t1)
                 {
                     // Render contents
-                    float k     = 1.0f / b->nFadeIn;
+                    float k     = gain / b->nFadeIn;
                     size_t n    = lsp_min(samples, t1 - t);
                     for (size_t i=0; i<n; ++i, ++t)
-                        dst[i]     += src[t] * (t * k);
+                        dst[i]     += src[i] * (t * k);
 
                     // Update the position
                     samples    -= n;
                     if (samples <= 0)
                         return t - t0;
                     dst        += n;
+                    src        += n;
                 }
 
                 // Render the body
@@ -113,7 +114,7 @@ namespace lsp
                 {
                     // Render contents
                     size_t n    = lsp_min(samples, t2 - t);
-                    dsp::add2(dst, &src[t], n);
+                    dsp::fmadd_k3(dst, src, gain, n);
 
                     // Update the position
                     t          += n;
@@ -121,23 +122,24 @@ namespace lsp
                     if (samples <= 0)
                         return t - t0;
                     dst        += n;
+                    src        += n;
                 }
 
                 // Render the fade-out
                 if (t < t3)
                 {
                     // Render the contents
-                    float k     = 1.0f / b->nFadeOut;
+                    float k     = gain / b->nFadeOut;
                     size_t n    = lsp_min(samples, t3 - t);
                     for (size_t i=0; i<n; ++i, ++t)
-                        dst[i]     += src[t] * ((t3 - t) * k);
+                        dst[i]     += src[i] * ((t3 - t) * k);
                 }
 
                 return t - t0;
             }
 
             LSP_DSP_UNITS_PUBLIC
-            size_t put_batch_const_power_direct(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples)
+            size_t put_batch_const_power_direct(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples, float gain, size_t origin)
             {
                 // Direct playback, compute batch size and position
                 size_t t3   = b->nEnd   - b->nStart;        // Batch size in samples
@@ -146,7 +148,7 @@ namespace lsp
                     return 0;
 
                 size_t t    = t0;                           // Current rendering position inside of the batch
-                src        += b->nStart;                    // Adjust pointer for simplification of pointer arithmetics
+                src        += b->nStart + t0 - origin;      // Pointer to the sample at the current rendering position
 
                 // Render the fade-in
                 size_t t1   = b->nFadeIn;
@@ -156,13 +158,14 @@ namespace lsp
                     float k     = 1.0f / b->nFadeIn;
                     size_t n    = lsp_min(samples, t1 - t);
                     for (size_t i=0; i<n; ++i, ++t)
-                        dst[i]     += src[t] * sqrtf(t * k);
+                        dst[i]     += src[i] * (sqrtf(t * k) * gain);
 
                     // Update the position
                     samples    -= n;
                     if (samples <= 0)
                         return t - t0;
                     dst        += n;
+                    src        += n;
                 }
 
                 // Render the body
@@ -171,7 +174,7 @@ namespace lsp
                 {
                     // Render contents
                     size_t n    = lsp_min(samples, t2 - t);
-                    dsp::add2(dst, &src[t], n);
+                    dsp::fmadd_k3(dst, src, gain, n);
 
                     // Update the position
                     t          += n;
@@ -179,6 +182,7 @@ namespace lsp
                     if (samples <= 0)
                         return t - t0;
                     dst        += n;
+                    src        += n;
                 }
 
                 // Render the fade-out
@@ -188,14 +192,14 @@ namespace lsp
                     float k     = 1.0f / b->nFadeOut;
                     size_t n    = lsp_min(samples, t3 - t);
                     for (size_t i=0; i<n; ++i, ++t)
-                        dst[i]     += src[t] * sqrtf((t3 - t) * k);
+                        dst[i]     += src[i] * (sqrtf((t3 - t) * k) * gain);
                 }
 
                 return t - t0;
             }
 
             LSP_DSP_UNITS_PUBLIC
-            size_t put_batch_linear_reverse(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples)
+            size_t put_batch_linear_reverse(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples, float gain, size_t origin)
             {
                 // Direct playback, compute batch size and position
                 size_t t3   = b->nStart - b->nEnd;          // Batch size in samples
@@ -203,19 +207,18 @@ namespace lsp
                 if (t0 >= t3)
                     return 0;
 
-                size_t tr   = t3 - 1;                       // Last sample
                 size_t t    = t0;                           // Current rendering position inside of the batch
-                src        += b->nEnd;                      // Adjust pointer for simplification of pointer arithmetics
+                src        += b->nEnd + t3 - t0 - origin;   // Pointer past the sample at the current rendering position
 
                 // Render the fade-in
                 size_t t1   = b->nFadeIn;
                 if (t < t1)
                 {
                     // Render contents
-                    float k     = 1.0f / b->nFadeIn;
+                    float k     = gain / b->nFadeIn;
                     size_t n    = lsp_min(samples, t1 - t);
                     for (size_t i=0; i<n; ++i, ++t)
-                        dst[i]     += src[tr - t] * (t * k);
+                        dst[i]     += *(--src) * (t * k);
 
                     // Update the position
                     samples    -= n;
@@ -231,7 +234,7 @@ namespace lsp
                     // Render contents
                     size_t n    = lsp_min(samples, t2 - t);
                     for (size_t i=0; i<n; ++i, ++t)
-                        dst[i]     += src[tr - t];
+                        dst[i]     += *(--src) * gain;
 
                     // Update the position
                     samples    -= n;
@@ -244,17 +247,17 @@ namespace lsp
                 if (t < t3)
                 {
                     // Render the contents
-                    float k     = 1.0f / b->nFadeOut;
+                    float k     = gain / b->nFadeOut;
                     size_t n    = lsp_min(samples, t3 - t);
                     for (size_t i=0; i<n; ++i, ++t)
-                        dst[i]     += src[tr - t] * ((t3 - t) * k);
+                        dst[i]     += *(--src) * ((t3 - t) * k);
                 }
 
                 return t - t0;
             }
 
             LSP_DSP_UNITS_PUBLIC
-            size_t put_batch_const_power_reverse(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples)
+            size_t put_batch_const_power_reverse(float *dst, const float *src, const batch_t *b, wsize_t timestamp, size_t samples, float gain, size_t origin)
             {
                 // Direct playback, compute batch size and position
                 size_t t3   = b->nStart - b->nEnd;          // Batch size in samples
@@ -262,9 +265,8 @@ namespace lsp
                 if (t0 >= t3)
                     return 0;
 
-                size_t tr   = t3 - 1;                       // Last sample
                 size_t t    = t0;                           // Current rendering position inside of the batch
-                src        += b->nEnd;                      // Adjust pointer for simplification of pointer arithmetics
+                src        += b->nEnd + t3 - t0 - origin;   // Pointer past the sample at the current rendering position
 
                 // Render the fade-in
                 size_t t1   = b->nFadeIn;
@@ -274,7 +276,7 @@ namespace lsp
                     float k     = 1.0f / b->nFadeIn;
                     size_t n    = lsp_min(samples, t1 - t);
                     for (size_t i=0; i<n; ++i, ++t)
-                        dst[i]     += src[tr - t] * sqrtf(t * k);
+                        dst[i]     += *(--src) * (sqrtf(t * k) * gain);
 
                     // Update the position
                     samples    -= n;
@@ -290,7 +292,7 @@ namespace lsp
                     // Render contents
                     size_t n    = lsp_min(samples, t2 - t);
                     for (size_t i=0; i<n; ++i, ++t)
-                        dst[i]     += src[tr - t];
+                        dst[i]     += *(--src) * gain;
 
                     // Update the position
                     samples    -= n;
@@ -306,7 +308,7 @@ namespace lsp
                     float k     = 1.0f / b->nFadeOut;
                     size_t n    = lsp_min(samples, t3 - t);
                     for (size_t i=0; i<n; ++i, ++t)
-                        dst[i]     += src[tr - t] * sqrtf((t3 - t) * k);
+                        dst[i]     += *(--src) * (sqrtf((t3 - t) * k) * gain);
                 }
 
                 return t - t0;
@@ -67,7 +67,7 @@ namespace lsp
             void compute_initial_batch(playback_t *pb, const PlaySettings *settings)
             {
                 // Check the length of the sample
-                size_t sample_len = pb->pSample->length();
+                size_t sample_len = pb->pSample->full_length();
                 if (sample_len <= 0)
                 {
                     pb->enState     = STATE_NONE;
@@ -184,7 +184,7 @@ namespace lsp
             static void compute_next_batch_range_after_head(playback_t *pb)
             {
                 // NOTE: loop mode is always enabled for TYPE_HEAD batch
-                size_t sample_len       = pb->pSample->length();
+                size_t sample_len       = pb->pSample->full_length();
                 play_batch_t *b         = &pb->sBatch[1];
 
                  // Loop not allowed anymore?
@@ -263,7 +263,7 @@ namespace lsp
             static void compute_next_batch_range_inside_loop(playback_t *pb)
             {
                 // NOTE: loop mode is always enabled for TYPE_LOOP batch
-                size_t sample_len       = pb->pSample->length();
+                size_t sample_len       = pb->pSample->full_length();
                 const play_batch_t *s   = &pb->sBatch[0];
                 play_batch_t *b         = &pb->sBatch[1];
 
@@ -491,8 +491,98 @@ namespace lsp
                 compute_next_batch(pb);
             }
 
+            static size_t put_batch(float *dst, const float *src, size_t origin, const batch_t *b, const playback_t *pb, wsize_t timestamp, size_t samples, float gain)
+            {
+                if (b->nStart < b->nEnd)
+                {
+                    // Perform processing depending on the cross-fade type
+                    switch (pb->enXFadeType)
+                    {
+                        case SAMPLE_CROSSFADE_CONST_POWER:
+                            return put_batch_const_power_direct(dst, src, b, timestamp, samples, gain, origin);
+                        case SAMPLE_CROSSFADE_LINEAR:
+                        default:
+                            break;
+                    }
+                    return put_batch_linear_direct(dst, src, b, timestamp, samples, gain, origin);
+                }
+
+                // Perform processing depending on the cross-fade type
+                switch (pb->enXFadeType)
+                {
+                    case SAMPLE_CROSSFADE_CONST_POWER:
+                        return put_batch_const_power_reverse(dst, src, b, timestamp, samples, gain, origin);
+                    case SAMPLE_CROSSFADE_LINEAR:
+                    default:
+                        break;
+                }
+                return put_batch_linear_reverse(dst, src, b, timestamp, samples, gain, origin);
+            }
+
+            static const float *fetch_stream_data(stream_t *stream, size_t first, size_t count, bool reverse)
+            {
+                if (stream == NULL)
+                    return NULL;
+
+                return fetch_stream(stream, first, count, reverse);
+            }
+
+            static size_t put_streamed_batch(float *dst, const batch_t *b, const playback_t *pb, wsize_t timestamp, size_t samples, float gain)
+            {
+                // Compute the amount of data to process
+                const bool reverse  = b->nStart >= b->nEnd;
+                const size_t t0     = timestamp - b->nTimestamp;
+                const size_t length = (reverse) ? b->nStart - b->nEnd : b->nEnd - b->nStart;
+                if (t0 >= length)
+                    return 0;
+                samples             = lsp_min(samples, length - t0);
+
+                // Split the batch into parts which are loaded into memory and parts which are streamed
+                const Sample *s     = pb->pSample;
+                const size_t head   = s->length();
+                const float *mem    = s->channel(pb->nChannel);
+                stream_t *stream    = pb->pStream;
+                const size_t cap    = (stream != NULL) ? stream->nCapacity : samples;
+
+                for (size_t offset=0, to_do; offset < samples; offset += to_do)
+                {
+                    const float *src    = mem;
+                    size_t origin       = 0;            // Position in the sample of the first element of src
+                    to_do               = samples - offset;
+
+                    if (reverse)
+                    {
+                        const size_t last   = b->nStart - t0 - offset;
+                        if (last > head)
+                        {
+                            to_do               = lsp_min(to_do, last - head, cap);
+                            origin              = last - to_do;
+                            src                 = fetch_stream_data(stream, origin, to_do, true);
+                        }
+                    }
+                    else
+                    {
+                        const size_t first  = b->nStart + t0 + offset;
+                        if (first < head)
+                            to_do               = lsp_min(to_do, head - first);
+                        else
+                        {
+                            to_do               = lsp_min(to_do, cap);
+                            origin              = first;
+                            src                 = fetch_stream_data(stream, origin, to_do, false);
+                        }
+                    }
+
+                    // Render the data, the missing streamed data is rendered as silence
+                    if (src != NULL)
+                        put_batch(&dst[offset], src, origin, b, pb, timestamp + offset, to_do, gain);
+                }
+
+                return samples;
+            }
+
             LSP_DSP_UNITS_PUBLIC
-            size_t execute_batch(float *dst, const batch_t *b, playback_t *pb, size_t samples)
+            size_t execute_batch(float *dst, const batch_t *b, playback_t *pb, size_t samples, float gain)
             {
                 // Check type of batch
                 if (b->enType == BATCH_NONE)
@@ -517,43 +607,14 @@ namespace lsp
 
                 // Initialize parameters
                 size_t batch_offset = timestamp - b->nTimestamp;
-                size_t processed    = 0;
-                const float *src    = pb->pSample->channel(pb->nChannel);
+                size_t processed    = (pb->pSample->streamed()) ?
+                    put_streamed_batch(&dst[offset], b, pb, timestamp, samples - offset, gain) :
+                    put_batch(&dst[offset], pb->pSample->channel(pb->nChannel), 0, b, pb, timestamp, samples - offset, gain);
 
-                if (b->nStart < b->nEnd)
-                {
-                    // Perform processing depending on the cross-fade type
-                    switch (pb->enXFadeType)
-                    {
-                        case SAMPLE_CROSSFADE_CONST_POWER:
-                            processed       = put_batch_const_power_direct(&dst[offset], src, b, timestamp, samples - offset);
-                            break;
-                        case SAMPLE_CROSSFADE_LINEAR:
-                        default:
-                            processed       = put_batch_linear_direct(&dst[offset], src, b, timestamp, samples - offset);
-                            break;
-                    }
-
-                    // Update the offset
-                    pb->nPosition       = b->nStart + batch_offset + processed;
-                }
-                else // b->nStart >= b->nEnd
-                {
-                    // Perform processing depending on the cross-fade type
-                    switch (pb->enXFadeType)
-                    {
-                        case SAMPLE_CROSSFADE_CONST_POWER:
-                            processed       = put_batch_const_power_reverse(&dst[offset], src, b, timestamp, samples - offset);
-                            break;
-                        case SAMPLE_CROSSFADE_LINEAR:
-                        default:
-                            processed       = put_batch_linear_reverse(&dst[offset], src, b, timestamp, samples - offset);
-                            break;
-                    }
-
-                    // Update the offset
-                    pb->nPosition       = b->nStart - batch_offset - processed;
-                }
+                // Update the offset
+                pb->nPosition       = (b->nStart < b->nEnd) ?
+                    b->nStart + batch_offset + processed :
+                    b->nStart - batch_offset - processed;
 
                 return offset + processed;
             }
@@ -612,6 +673,7 @@ namespace lsp
                 pb->nLoopEnd        = 0;
                 pb->nXFade          = 0;
                 pb->enXFadeType     = SAMPLE_CROSSFADE_CONST_POWER;
+                pb->pStream         = NULL;
 
                 clear_batch(&pb->sBatch[0]);
                 clear_batch(&pb->sBatch[1]);
@@ -672,7 +734,7 @@ namespace lsp
             }
 
             LSP_DSP_UNITS_PUBLIC
-            size_t process_playback(float *dst, playback_t *pb, size_t samples)
+            size_t process_playback(float *dst, playback_t *pb, size_t samples, float gain)
             {
                 size_t processed, to_do;
                 size_t offset = 0;
@@ -687,8 +749,8 @@ namespace lsp
                         case STATE_PLAY:
                         case STATE_STOP:
                             // Play batches as usual, loop planning depends on the state
-                            processed       = execute_batch(&dst[offset], &pb->sBatch[0], pb, to_do);
-                            execute_batch(&dst[offset], &pb->sBatch[1], pb, processed);
+                            processed       = execute_batch(&dst[offset], &pb->sBatch[0], pb, to_do, gain);
+                            execute_batch(&dst[offset], &pb->sBatch[1], pb, processed, gain);
                             if (processed < to_do)
                                 complete_current_batch(pb);
                             offset         += processed;
@@ -707,8 +769,8 @@ namespace lsp
                             to_do           = lsp_min(to_do, pb->nCancelTime + pb->nFadeout - pb->nTimestamp);
 
                             // Play batches, do not allow loops
-                            processed       = execute_batch(&dst[offset], &pb->sBatch[0], pb, to_do);
-                            execute_batch(&dst[offset], &pb->sBatch[1], pb, processed);
+                            processed       = execute_batch(&dst[offset], &pb->sBatch[0], pb, to_do, gain);
+                            execute_batch(&dst[offset], &pb->sBatch[1], pb, processed, gain);
                             processed       = apply_fade_out(&dst[offset], pb, processed);
                             if (processed < to_do)
                                 complete_current_batch(pb);
@@ -783,6 +845,7 @@ namespace lsp
                 v->write("nLoopEnd", pb->nLoopEnd);
                 v->write("nXFade", pb->nXFade);
                 v->write("enXFadeType", int(pb->enXFadeType));
+                v->write("pStream", pb->pStream);
 
                 v->begin_array("sBatch", pb->sBatch, 2);
                 {
@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp-units/sampling/helpers/stream.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        namespace playback
+        {
+            LSP_DSP_UNITS_PUBLIC
+            void init_stream(stream_t *s, float *data, size_t capacity, Semaphore *signal)
+            {
+                s->pNext            = NULL;
+                s->nNextChannel     = 0;
+                s->nNextSeek        = 0;
+                s->bNextOpen        = false;
+                s->bQueued          = false;
+
+                s->pSample          = NULL;
+                s->nChannel         = 0;
+                s->nSeek            = 0;
+                s->bOpen            = false;
+                s->nRead            = 0;
+                s->nRequest         = 0;
+
+                s->pIn              = NULL;
+                s->nChannels        = 0;
+                s->nLength          = 0;
+                s->nLimit           = 0;
+                s->nServed          = 0;
+                s->nEnd             = 0;
+
+                s->vData            = data;
+                s->nCapacity        = capacity;
+                s->pSignal          = signal;
+            }
+
+            static inline void wake_reader(stream_t *s)
+            {
+                if (s->pSignal != NULL)
+                    s->pSignal->post();
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            Sample *request_stream(stream_t *s, Sample *sample, size_t channel, size_t position)
+            {
+                // Replace the queued request
+                Sample *old         = s->pNext;
+
+                s->pNext            = sample;
+                s->nNextChannel     = channel;
+                s->nNextSeek        = position;
+                s->bNextOpen        = true;
+                s->bQueued          = true;
+
+                return old;
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            Sample *submit_stream(stream_t *s)
+            {
+                // Check that there is a request and the reader is ready to accept it
+                if (!s->bQueued)
+                    return NULL;
+                if (atomic_load(&s->nServed) != s->nRequest)
+                    return NULL;
+
+                // Fill the request
+                Sample *old         = NULL;
+                if (s->bNextOpen)
+                {
+                    old                 = s->pSample;
+                    s->pSample          = s->pNext;
+                    s->nChannel         = s->nNextChannel;
+                }
+                s->nSeek            = s->nNextSeek;
+                s->bOpen            = s->bNextOpen;
+
+                s->pNext            = NULL;
+                s->bNextOpen        = false;
+                s->bQueued          = false;
+
+                // Submit the request
+                atomic_store(&s->nRead, uatomic_t(s->nSeek));
+                atomic_store(&s->nRequest, uatomic_t(s->nRequest + 1));
+                wake_reader(s);
+
+                return old;
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            const float *fetch_stream(stream_t *s, size_t position, size_t count, bool reverse)
+            {
+                // The stream should have no pending requests
+                if ((s->bQueued) || (s->pSample == NULL))
+                    return NULL;
+                if (atomic_load(&s->nServed) != s->nRequest)
+                    return NULL;
+
+                const size_t read   = s->nRead;
+                const size_t end    = atomic_load(&s->nEnd);
+                if (position >= read)
+                {
+                    // Check that data is available
+                    if ((position + count) <= end)
+                    {
+                        // Allow the reader to overwrite the data before the requested position
+                        if ((!reverse) && (position > read))
+                        {
+                            atomic_store(&s->nRead, uatomic_t(position));
+                            wake_reader(s);
+                        }
+                        return &s->vData[position % s->nCapacity];
+                    }
+
+                    // Check that data will become available after the reader fills the buffer
+                    if ((position + count) <= (read + s->nCapacity))
+                    {
+                        if (!reverse)
+                            atomic_store(&s->nRead, uatomic_t(lsp_min(position, end)));
+                        wake_reader(s);
+                        return NULL;
+                    }
+                }
+
+                // Re-position the stream, for the reverse direction the requested data
+                // should be at the end of the buffer
+                size_t seek         = position;
+                if (reverse)
+                {
+                    const size_t last   = position + count;
+                    seek                = (last > s->nCapacity) ? last - s->nCapacity : 0;
+                }
+
+                s->nNextSeek        = seek;
+                s->bNextOpen        = false;
+                s->bQueued          = true;
+                submit_stream(s);
+
+                return NULL;
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            void close_stream(stream_t *s)
+            {
+                if (s->pIn != NULL)
+                {
+                    s->pIn->close();
+                    delete s->pIn;
+                    s->pIn              = NULL;
+                }
+
+                s->nChannels        = 0;
+                s->nLength          = 0;
+                s->nLimit           = 0;
+            }
+
+            static void open_stream(stream_t *s)
+            {
+                mm::IInAudioStream *in  = NULL;
+                if (s->pSample->open_stream(&in) != STATUS_OK)
+                    return;
+
+                mm::audio_stream_t fmt;
+                if ((in->info(&fmt) != STATUS_OK) || (s->nChannel >= fmt.channels))
+                {
+                    in->close();
+                    delete in;
+                    return;
+                }
+
+                s->pIn              = in;
+                s->nChannels        = fmt.channels;
+                s->nLength          = s->pSample->full_length();
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            bool serve_stream(stream_t *s, float *buf, size_t size)
+            {
+                // Serve the submitted request first
+                const uatomic_t request = atomic_load(&s->nRequest);
+                if (request != s->nServed)
+                {
+                    // Re-open the audio stream if needed
+                    if (s->bOpen)
+                    {
+                        close_stream(s);
+                        if (s->pSample != NULL)
+                            open_stream(s);
+                    }
+
+                    // Seek the audio stream to the requested position
+                    if (s->pIn != NULL)
+                        s->nLimit           = (s->pIn->seek(s->nSeek) == wssize_t(s->nSeek)) ? s->nLength : s->nSeek;
+
+                    atomic_store(&s->nEnd, uatomic_t(s->nSeek));
+                    atomic_store(&s->nServed, request);
+                    return true;
+                }
+                if (s->pIn == NULL)
+                    return false;
+
+                // Estimate the amount of data to read, do not overwrite the data that can be read by the real-time thread
+                const size_t end    = s->nEnd;
+                const size_t limit  = lsp_min(size_t(atomic_load(&s->nRead)) + s->nCapacity, s->nLimit);
+                if (end >= limit)
+                    return false;
+
+                const size_t frames = lsp_min(limit - end, size / s->nChannels);
+                const ssize_t read  = s->pIn->read(buf, frames);
+                if (read <= 0)
+                {
+                    // Do not read the audio stream anymore until the next request
+                    s->nLimit           = end;
+                    return false;
+                }
+
+                // Store the data of the streamed channel to the ring buffer
+                const size_t cap    = s->nCapacity;
+                const float *src    = &buf[s->nChannel];
+                float *dst          = s->vData;
+                for (size_t i=0, off = end % cap; i<size_t(read); ++i, src += s->nChannels)
+                {
+                    dst[off]            = *src;
+                    dst[off + cap]      = *src;
+                    if ((++off) >= cap)
+                        off                 = 0;
+                }
+
+                // Commit the data
+                atomic_store(&s->nEnd, uatomic_t(end + read));
+                return true;
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            void dump_stream_plain(IStateDumper *v, const stream_t *s)
+            {
+                v->write("pNext", s->pNext);
+                v->write("nNextChannel", s->nNextChannel);
+                v->write("nNextSeek", s->nNextSeek);
+                v->write("bNextOpen", s->bNextOpen);
+                v->write("bQueued", s->bQueued);
+
+                v->write("pSample", s->pSample);
+                v->write("nChannel", s->nChannel);
+                v->write("nSeek", s->nSeek);
+                v->write("bOpen", s->bOpen);
+                v->write("nRead", s->nRead);
+                v->write("nRequest", s->nRequest);
+
+                v->write("pIn", s->pIn);
+                v->write("nChannels", s->nChannels);
+                v->write("nLength", s->nLength);
+                v->write("nLimit", s->nLimit);
+                v->write("nServed", s->nServed);
+                v->write("nEnd", s->nEnd);
+
+                v->write("vData", s->vData);
+                v->write("nCapacity", s->nCapacity);
+                v->write("pSignal", s->pSignal);
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            void dump_stream(IStateDumper *v, const stream_t *s)
+            {
+                v->begin_object(s, sizeof(*s));
+                dump_stream_plain(v, s);
+                v->end_object();
+            }
+
+            LSP_DSP_UNITS_PUBLIC
+            void dump_stream(IStateDumper *v, const char *name, const stream_t *s)
+            {
+                v->begin_object(name, s, sizeof(*s));
+                dump_stream_plain(v, s);
+                v->end_object();
+            }
+
+        } /* namespace playback */
+    } /* namespace dspu */
+} /* namespace lsp */
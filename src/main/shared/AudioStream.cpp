@@ -510,6 +510,59 @@ namespace lsp
             return read_internal(channel, dst, samples, dsp::sanitize2);
         }
 
+        status_t AudioStream::read_span(size_t channel, read_span_t *span, size_t samples)
+        {
+            if (span == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            span->vData[0]      = NULL;
+            span->vData[1]      = NULL;
+            span->vCount[0]     = 0;
+            span->vCount[1]     = 0;
+
+            if (pHeader == NULL)
+                return STATUS_CLOSED;
+            if (!bIO)
+                return STATUS_BAD_STATE;
+            if (bWriteMode)
+                return STATUS_BAD_STATE;
+
+            // Check that audio stream is in valid state
+            uint32_t flags = pHeader->nFlags;
+            if ((flags & (SS_UPD_MASK | SS_INIT_MASK)) != (SS_UPDATED | SS_INITIALIZED))
+            {
+                bUnderrun       = true;
+                return STATUS_OK;
+            }
+
+            // Check that we went out of channel
+            if (channel >= nChannels)
+                return STATUS_OK;
+
+            // Compute the spans
+            channel_t *c = &vChannels[channel];
+            const uint32_t length = pHeader->nLength;
+            const size_t count  = lsp_min(samples, nAvail - c->nCount, length);
+            const size_t head   = lsp_min(count, length - c->nPosition);
+
+            span->vData[0]      = &c->pData[c->nPosition];
+            span->vCount[0]     = head;
+            if (count > head)
+            {
+                span->vData[1]      = c->pData;
+                span->vCount[1]     = count - head;
+            }
+
+            c->nPosition        = (c->nPosition + count) % length;
+            c->nCount          += count;
+
+            // Detected buffer underrun?
+            if (count < samples)
+                bUnderrun           = true;
+
+            return STATUS_OK;
+        }
+
         status_t AudioStream::write_internal(size_t channel, const float *src, size_t samples, copy_function_t copy_func)
         {
             if (pHeader == NULL)
@@ -551,6 +604,47 @@ namespace lsp
             return write_internal(channel, src, samples, dsp::sanitize2);
         }
 
+        status_t AudioStream::write_span(size_t channel, write_span_t *span, size_t samples)
+        {
+            if (span == NULL)
+                return STATUS_BAD_ARGUMENTS;
+
+            span->vData[0]      = NULL;
+            span->vData[1]      = NULL;
+            span->vCount[0]     = 0;
+            span->vCount[1]     = 0;
+
+            if (pHeader == NULL)
+                return STATUS_CLOSED;
+            if (!bIO)
+                return STATUS_BAD_STATE;
+            if (!bWriteMode)
+                return STATUS_BAD_STATE;
+
+            // Check that we went out of channel
+            if (channel >= nChannels)
+                return STATUS_OK;
+
+            // Compute the spans
+            channel_t *c = &vChannels[channel];
+            const uint32_t length = pHeader->nLength;
+            const size_t count  = lsp_min(samples, length);
+            const size_t head   = lsp_min(count, length - c->nPosition);
+
+            span->vData[0]      = &c->pData[c->nPosition];
+            span->vCount[0]     = head;
+            if (count > head)
+            {
+                span->vData[1]      = c->pData;
+                span->vCount[1]     = count - head;
+            }
+
+            c->nPosition        = (c->nPosition + count) % length;
+            c->nCount          += count;
+
+            return STATUS_OK;
+        }
+
         bool AudioStream::check_channels_synchronized()
         {
             for (size_t i=1; i<nChannels; ++i)
@@ -30,12 +30,14 @@ namespace lsp
     namespace dspu
     {
         static constexpr uint32_t CATALOG_MAGIC         = 0x53434154; // "SCAT"
+        static constexpr uint32_t CATALOG_VERSION       = 2;
         static constexpr uint32_t KEEPALIVE_THRESHOLD   = 0x20000;
 
         Catalog::Catalog()
         {
             pHeader     = NULL;
             vRecords    = NULL;
+            vIndex      = NULL;
             nChanges    = 0;
         }
 
@@ -111,13 +113,24 @@ namespace lsp
             return res;
         }
 
+        size_t Catalog::index_size(size_t entries)
+        {
+            // Keep the load factor of the hash index not greater than 0.5
+            size_t size = 1;
+            while (size < (entries << 1))
+                size      <<= 1;
+            return size;
+        }
+
         status_t Catalog::create_catalog(const LSPString *name, size_t entries)
         {
             // Try to create new shared segment
             const size_t page_size  = system::page_size();
+            const size_t idx_count  = index_size(entries);
             const size_t hdr_size   = align_size(sizeof(sh_header_t), page_size);
             const size_t recs_size  = align_size(entries * sizeof(sh_record_t), page_size);
-            const size_t total_size = hdr_size + recs_size;
+            const size_t idx_size   = align_size(idx_count * sizeof(uint32_t), page_size);
+            const size_t total_size = hdr_size + recs_size + idx_size;
 
             status_t res = hMem.open(name, ipc::SharedMem::SHM_RW | ipc::SharedMem::SHM_CREATE | ipc::SharedMem::SHM_PERSIST, total_size);
             if (res != STATUS_OK)
@@ -134,16 +147,22 @@ namespace lsp
             // Initialize catalog
             pHeader                 = advance_ptr_bytes<sh_header_t>(ptr, hdr_size);
             vRecords                = advance_ptr_bytes<sh_record_t>(ptr, recs_size);
+            vIndex                  = advance_ptr_bytes<uint32_t>(ptr, idx_size);
             nChanges                = 0;
 
             pHeader->nMagic         = BE_TO_CPU(CATALOG_MAGIC);
-            pHeader->nVersion       = 1;
+            pHeader->nVersion       = CATALOG_VERSION;
             pHeader->nSize          = uint32_t(entries);
             pHeader->nAllocated     = 0;
             pHeader->nChanges       = nChanges;
+            pHeader->nIndexSize     = uint32_t(idx_count);
+            pHeader->nFree          = (entries > 0) ? 1 : 0;
 
-            // Initialize records
+            // Initialize records and put all of them to the list of free records
             bzero(vRecords, recs_size);
+            bzero(vIndex, idx_size);
+            for (size_t i=1; i<entries; ++i)
+                vRecords[i-1].nNextFree = uint32_t(i + 1);
 
             return STATUS_OK;
         }
@@ -162,13 +181,16 @@ namespace lsp
             const uint32_t magic    = CPU_TO_BE(hdr->nMagic);
             if (magic != CATALOG_MAGIC)
                 return STATUS_BAD_FORMAT;
-            if (hdr->nVersion != 1)
+            if (hdr->nVersion != CATALOG_VERSION)
                 return STATUS_UNSUPPORTED_FORMAT;
+            if (hdr->nIndexSize != index_size(hdr->nSize))
+                return STATUS_CORRUPTED;
 
             const size_t page_size  = system::page_size();
             const size_t hdr_size   = align_size(sizeof(sh_header_t), page_size);
             const size_t recs_size  = align_size(hdr->nSize * sizeof(sh_record_t), page_size);
-            const size_t total_size = hdr_size + recs_size;
+            const size_t idx_size   = align_size(hdr->nIndexSize * sizeof(uint32_t), page_size);
+            const size_t total_size = hdr_size + recs_size + idx_size;
 
             // Remap header
             if ((res = hMem.map(0, total_size)) != STATUS_OK)
@@ -181,6 +203,7 @@ namespace lsp
             // Initialize catalog
             pHeader                 = advance_ptr_bytes<sh_header_t>(ptr, hdr_size);
             vRecords                = advance_ptr_bytes<sh_record_t>(ptr, recs_size);
+            vIndex                  = advance_ptr_bytes<uint32_t>(ptr, idx_size);
             nChanges                = pHeader->nChanges;
 
             return STATUS_OK;
@@ -192,7 +215,8 @@ namespace lsp
             res             = update_status(res, hMutex.close());
 
             pHeader         = NULL;
-            vRecords        = 0;
+            vRecords        = NULL;
+            vIndex          = NULL;
             nChanges        = 0;
 
             return res;
@@ -235,59 +259,119 @@ namespace lsp
             return pHeader != NULL;
         }
 
-        ssize_t Catalog::find_empty() const
+        ssize_t Catalog::alloc_record()
         {
-            const size_t count = pHeader->nSize;
+            const size_t count  = pHeader->nSize;
 
-            // Find new records first
-            if (pHeader->nAllocated < count)
+            // Take the record from the list of free records first
+            const uint32_t head = pHeader->nFree;
+            if (head > 0)
             {
-                for (size_t i=0; i<count; ++i)
-                {
-                    const sh_record_t *rec = &vRecords[i];
-
-                    if (rec->nMagic == 0)
-                    {
-                        // Validate state of record
-                        if (rec->sName[0] != '\0')
-                            return -STATUS_CORRUPTED;
-                        if (rec->sId[0] != '\0')
-                            return -STATUS_CORRUPTED;
-                        return i;
-                    }
-                }
+                const size_t index  = head - 1;
+                if (index >= count)
+                    return -STATUS_CORRUPTED;
+
+                // Validate state of record
+                sh_record_t *rec    = &vRecords[index];
+                if (rec->nMagic != 0)
+                    return -STATUS_CORRUPTED;
+                if (rec->sName[0] != '\0')
+                    return -STATUS_CORRUPTED;
+                if (rec->sId[0] != '\0')
+                    return -STATUS_CORRUPTED;
+
+                pHeader->nFree      = rec->nNextFree;
+                rec->nNextFree      = 0;
+                return index;
             }
 
-            // Now look across stalled records
+            // Now look across stalled records, the stalled record becomes removed from the index
             for (size_t i=0; i<count; ++i)
             {
                 const sh_record_t *rec = &vRecords[i];
-                if (rec->nKeepAlive >= KEEPALIVE_THRESHOLD)
+                if ((rec->nMagic != 0) && (rec->nKeepAlive >= KEEPALIVE_THRESHOLD))
+                {
+                    index_remove(i);
                     return i;
+                }
             }
 
             return -STATUS_NO_MEM;
         }
 
-        ssize_t Catalog::find_by_name(uint32_t hash, const char *name, size_t len) const
+        void Catalog::free_record(size_t index)
         {
-            size_t count        = pHeader->nSize;
-            size_t allocated    = pHeader->nAllocated;
+            sh_record_t *rec    = &vRecords[index];
+            rec->nNextFree      = pHeader->nFree;
+            pHeader->nFree      = uint32_t(index + 1);
+        }
 
-            if (allocated >= count)
-                return -STATUS_NO_MEM;
+        void Catalog::index_insert(size_t index)
+        {
+            const uint32_t mask = pHeader->nIndexSize - 1;
+            uint32_t slot       = vRecords[index].nHash & mask;
 
-            for (size_t i=0, found=0; (i<count) && (found < allocated); ++i)
+            // The index is at least twice larger than number of records, so there always is an empty slot
+            for (size_t i=0; i<=mask; ++i, slot = (slot + 1) & mask)
             {
-                const sh_record_t *rec = &vRecords[i];
-                if (rec->nMagic == 0)
+                if (vIndex[slot] == 0)
+                {
+                    vIndex[slot]    = uint32_t(index + 1);
+                    return;
+                }
+            }
+        }
+
+        void Catalog::index_remove(size_t index)
+        {
+            const uint32_t mask = pHeader->nIndexSize - 1;
+            const uint32_t key  = uint32_t(index + 1);
+            uint32_t slot       = vRecords[index].nHash & mask;
+
+            // Find the slot associated with the record
+            for (size_t i=0; vIndex[slot] != key; ++i, slot = (slot + 1) & mask)
+            {
+                if ((vIndex[slot] == 0) || (i >= mask))
+                    return;
+            }
+
+            // Release the slot and shift back all records of the probe sequence
+            // that can not be reached after the slot becomes empty
+            vIndex[slot]        = 0;
+            for (uint32_t next = (slot + 1) & mask; vIndex[next] != 0; next = (next + 1) & mask)
+            {
+                const uint32_t home = vRecords[vIndex[next] - 1].nHash & mask;
+                const bool reachable = (slot <= next) ?
+                    ((slot < home) && (home <= next)) :
+                    ((slot < home) || (home <= next));
+                if (reachable)
                     continue;
-                ++found;
 
+                vIndex[slot]        = vIndex[next];
+                vIndex[next]        = 0;
+                slot                = next;
+            }
+        }
+
+        ssize_t Catalog::find_by_name(uint32_t hash, const char *name, size_t len) const
+        {
+            const size_t count  = pHeader->nSize;
+            const uint32_t mask = pHeader->nIndexSize - 1;
+            uint32_t slot       = hash & mask;
+
+            for (size_t i=0; i<=mask; ++i, slot = (slot + 1) & mask)
+            {
+                const uint32_t key = vIndex[slot];
+                if (key == 0)
+                    break;
+                if (key > count)
+                    return -STATUS_CORRUPTED;
+
+                const sh_record_t *rec = &vRecords[key - 1];
                 if (rec->nHash != hash)
                     continue;
                 if (str_equals(name, len, rec->sName, NAME_BYTES))
-                    return i;
+                    return key - 1;
             }
 
             return -STATUS_NOT_FOUND;
@@ -332,24 +416,26 @@ namespace lsp
 
             // Now we are ready to perform lookup
             ssize_t index       = find_by_name(hash, name, name_len);
-            sh_record_t *rec    = &vRecords[index];
             if (index < 0)
             {
                 if (index != -STATUS_NOT_FOUND)
                     return index;
-                if ((index = find_empty()) < 0)
-                    return -index;
+                if ((index = alloc_record()) < 0)
+                    return index;
 
                 // Create new record
-                rec                 = &vRecords[index];
+                sh_record_t *rec    = &vRecords[index];
                 if (rec->nMagic == 0)
                     ++pHeader->nAllocated;
 
                 rec->nHash          = hash;
+                rec->nKeepAlive     = 0;
                 str_copy(rec->sName, NAME_BYTES, name, name_len);
+                index_insert(index);
             }
 
             // Update other fields
+            sh_record_t *rec    = &vRecords[index];
             rec->nMagic         = magic;
             str_copy(rec->sId, ID_BYTES, id, id_len);
             ++rec->nVersion;
@@ -530,8 +616,8 @@ namespace lsp
             if (index < 0)
             {
                 if (index != -STATUS_NOT_FOUND)
-                    return status_t(index);
-                if ((index = find_empty()) < 0)
+                    return -status_t(index);
+                if ((index = alloc_record()) < 0)
                     return -status_t(index);
 
                 // Create new record
@@ -546,6 +632,7 @@ namespace lsp
 
                 str_copy(rec->sName, NAME_BYTES, name, name_len);
                 bzero(rec->sId, ID_BYTES);
+                index_insert(index);
 
                 // Mark catalog as changed
                 mark_changed();
@@ -596,6 +683,8 @@ namespace lsp
             if (rec->nVersion != version)
                 return STATUS_NOT_FOUND;
 
+            index_remove(index);
+
             rec->nMagic         = 0;
             rec->nHash          = 0;
             ++rec->nVersion;
@@ -605,6 +694,7 @@ namespace lsp
             bzero(rec->sId, ID_BYTES);
 
             --pHeader->nAllocated;
+            free_record(index);
 
             mark_changed();
 
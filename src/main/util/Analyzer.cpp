@@ -31,6 +31,42 @@ namespace lsp
 {
     namespace dspu
     {
+        /**
+         * Split the FFT of two real signals packed as real and imaginary parts of the complex signal
+         * and compute the amplitude of each spectrum:
+         *   A[k] = |Z[k] + conj(Z[N-k])| / 2
+         *   B[k] = |Z[k] - conj(Z[N-k])| / 2
+         *
+         * @param a amplitude of the first signal, N/2 + 1 elements
+         * @param b amplitude of the second signal, N/2 + 1 elements
+         * @param re real part of the complex spectrum, N elements
+         * @param im imaginary part of the complex spectrum, N elements
+         * @param rank FFT rank
+         */
+        static void split_amplitude(float *a, float *b, const float *re, const float *im, size_t rank)
+        {
+            const size_t n      = 1 << rank;
+            const size_t half   = n >> 1;
+
+            a[0]                = fabsf(re[0]);
+            b[0]                = fabsf(im[0]);
+
+            for (size_t k=1; k<half; ++k)
+            {
+                const size_t j      = n - k;
+                const float sr      = re[k] + re[j];
+                const float dr      = re[k] - re[j];
+                const float si      = im[k] + im[j];
+                const float di      = im[k] - im[j];
+
+                a[k]                = 0.5f * sqrtf(sr*sr + di*di);
+                b[k]                = 0.5f * sqrtf(si*si + dr*dr);
+            }
+
+            a[half]             = fabsf(re[half]);
+            b[half]             = fabsf(im[half]);
+        }
+
         Analyzer::Analyzer()
         {
             construct();
@@ -69,6 +105,7 @@ namespace lsp
             vChannels       = NULL;
             vData           = NULL;
             vSigRe          = NULL;
+            vSigIm          = NULL;
             vFftReIm        = NULL;
             vWindow         = NULL;
             vEnvelope       = NULL;
@@ -94,7 +131,7 @@ namespace lsp
                                             DEFAULT_ALIGN,
                                         DEFAULT_ALIGN));
             const size_t buf_floats =
-                4 * fft_items +                 // vSigRe, vFftReIm (re + im), vWindow
+                5 * fft_items +                 // vSigRe, vSigIm, vFftReIm (re + im), vWindow
                 fft_citems +                    // c->vEnvelope
                 channels * nBufSize +           // c->vBuffer
                 channels * fft_citems +         // c->vAmp
@@ -121,6 +158,7 @@ namespace lsp
 
             // Initialize buffers
             vSigRe                  = advance_ptr<float>(abuf, fft_items);
+            vSigIm                  = advance_ptr<float>(abuf, fft_items);
             vFftReIm                = advance_ptr<float>(abuf, fft_items * 2);
             vWindow                 = advance_ptr<float>(abuf, fft_items);
             vEnvelope               = advance_ptr<float>(abuf, fft_citems);
@@ -143,6 +181,7 @@ namespace lsp
                 c->nUserDelay       = 0;
                 c->bFreeze          = false;
                 c->bActive          = true;
+                c->bDone            = false;
             }
 
             // Set reconfiguration flags
@@ -289,7 +328,10 @@ namespace lsp
             if (nReconfigure & R_COUNTERS)
             {
                 for (size_t i=0; i<nChannels; ++i)
+                {
                     vChannels[i].nDelay     = uint32_t(i*nStep);
+                    vChannels[i].bDone      = false;
+                }
             }
 
             // Clear reconfiguration flag and update strobe signal
@@ -329,36 +371,22 @@ namespace lsp
                     c   = &vChannels[channel];
 
                     // Perform FFT only for active channels
-                    if (!c->bFreeze)
+                    if (c->bDone)
+                        c->bDone        = false;
+                    else if (!c->bFreeze)
                     {
                         if ((bActive) && (c->bActive))
                         {
-                            // Get the time mark to start from
-                            ssize_t doff    = nHead - (fft_size + c->nDelay + c->nUserDelay);
-
-    //                        lsp_trace("channel=%d, head=%d, delay=%d, offset=%d, buf_size=%d, samples=%d",
-    //                                int(channel), int(nHead), int(c->nDelay), int(doff), int(nBufSize), int(samples));
-
-                            if (doff < 0)
-                                doff           += nBufSize;
-
-                            // Prepare the real buffer
-                            ssize_t count   = nBufSize - doff;
-                            if (count < fft_size)
+                            // All channels analyze the same time frame, so the frame of the next channel
+                            // is already available and both channels can be processed with one complex FFT
+                            channel_t *n    = (channel + 1 < nChannels) ? &vChannels[channel + 1] : NULL;
+                            if ((n != NULL) && (!n->bFreeze) && (n->bActive))
                             {
-                                dsp::mul3(vSigRe, &c->vBuffer[doff], vWindow, count);
-                                dsp::mul3(&vSigRe[count], c->vBuffer, &vWindow[count], fft_size - count);
+                                analyze_pair(c, n, c->nDelay);
+                                n->bDone        = true;
                             }
                             else
-                                dsp::mul3(vSigRe, &c->vBuffer[doff], vWindow, fft_size);
-
-                            // Do Real->complex conversion and FFT
-                            dsp::pcomplex_r2c(vFftReIm, vSigRe, fft_size);
-                            dsp::packed_direct_fft(vFftReIm, vFftReIm, nRank);
-                            // Get complex argument
-                            dsp::pcomplex_mod(vFftReIm, vFftReIm, fft_csize);
-                            // Mix with the previous value
-                            dsp::mix2(c->vAmp, vFftReIm, 1.0f - fTau, fTau, fft_csize);
+                                analyze_single(c, c->nDelay);
                         }
                         else
                             dsp::fill_zero(c->vAmp, fft_csize);
@@ -408,6 +436,60 @@ namespace lsp
             }
         }
 
+        void Analyzer::prepare_frame(float *dst, const channel_t *c, size_t delay)
+        {
+            const ssize_t fft_size  = 1 << nRank;
+
+            // Get the time mark to start from
+            ssize_t doff    = nHead - (fft_size + delay + c->nUserDelay);
+            if (doff < 0)
+                doff           += nBufSize;
+
+            // Prepare the real buffer
+            ssize_t count   = nBufSize - doff;
+            if (count < fft_size)
+            {
+                dsp::mul3(dst, &c->vBuffer[doff], vWindow, count);
+                dsp::mul3(&dst[count], c->vBuffer, &vWindow[count], fft_size - count);
+            }
+            else
+                dsp::mul3(dst, &c->vBuffer[doff], vWindow, fft_size);
+        }
+
+        void Analyzer::analyze_single(channel_t *c, size_t delay)
+        {
+            const size_t fft_size   = 1 << nRank;
+            const size_t fft_csize  = (fft_size >> 1) + 1;
+
+            prepare_frame(vSigRe, c, delay);
+
+            // Do Real->complex conversion and FFT
+            dsp::pcomplex_r2c(vFftReIm, vSigRe, fft_size);
+            dsp::packed_direct_fft(vFftReIm, vFftReIm, nRank);
+            // Get complex argument
+            dsp::pcomplex_mod(vFftReIm, vFftReIm, fft_csize);
+            // Mix with the previous value
+            dsp::mix2(c->vAmp, vFftReIm, 1.0f - fTau, fTau, fft_csize);
+        }
+
+        void Analyzer::analyze_pair(channel_t *a, channel_t *b, size_t delay)
+        {
+            const size_t fft_size   = 1 << nRank;
+            const size_t fft_csize  = (fft_size >> 1) + 1;
+            float *fft_re           = vFftReIm;
+            float *fft_im           = &vFftReIm[fft_size];
+
+            // Pack two real frames into one complex frame and perform FFT
+            prepare_frame(vSigRe, a, delay);
+            prepare_frame(vSigIm, b, delay);
+            dsp::direct_fft(fft_re, fft_im, vSigRe, vSigIm, nRank);
+
+            // Split the spectrum, compute amplitudes and mix with the previous values
+            split_amplitude(vSigRe, vSigIm, fft_re, fft_im, nRank);
+            dsp::mix2(a->vAmp, vSigRe, 1.0f - fTau, fTau, fft_csize);
+            dsp::mix2(b->vAmp, vSigIm, 1.0f - fTau, fTau, fft_csize);
+        }
+
         bool Analyzer::read_frequencies(float *frq, float start, float stop, size_t count, size_t flags)
         {
             if ((vChannels == NULL) || (count == 0))
@@ -531,6 +613,7 @@ namespace lsp
                     v->write("nUserDelay", c->nUserDelay);
                     v->write("bFreeze", c->bFreeze);
                     v->write("bActive", c->bActive);
+                    v->write("bDone", c->bDone);
                 }
                 v->end_object();
             }
@@ -538,6 +621,7 @@ namespace lsp
 
             v->write("vData", vData);
             v->write("vSigRe", vSigRe);
+            v->write("vSigIm", vSigIm);
             v->write("vFftReIm", vFftReIm);
             v->write("vWindow", vWindow);
             v->write("vEnvelope", vEnvelope);
@@ -33,6 +33,39 @@ namespace lsp
 {
     namespace dspu
     {
+        Convolver::TailWorker::TailWorker(Convolver *conv)
+        {
+            pConv               = conv;
+        }
+
+        Convolver::TailWorker::~TailWorker()
+        {
+            pConv               = NULL;
+        }
+
+        status_t Convolver::TailWorker::run()
+        {
+            // Initialize DSP context
+            dsp::context_t ctx;
+            dsp::start(&ctx);
+
+            while (!ipc::Thread::is_cancelled())
+            {
+                // Sleep until the job is submitted or the thread is cancelled
+                pConv->pTailSignal->wait();
+                if (!atomic_cas(&pConv->nTailState, TS_PENDING, TS_BUSY))
+                    continue;
+
+                // Process the job and notify the real-time thread
+                pConv->process_tail();
+                atomic_swap(&pConv->nTailState, TS_DONE);
+            }
+
+            // Finalize DSP context and return result
+            dsp::finish(&ctx);
+            return STATUS_OK;
+        }
+
         Convolver::Convolver()
         {
             construct();
@@ -65,16 +98,43 @@ namespace lsp
             nBlkInit            = 0;
             fBlkCoef            = 0.0f;
 
+            pWorker             = NULL;
+            pTailSignal         = NULL;
+            vTailIn             = NULL;
+            vTailOut            = NULL;
+            vTailTask           = NULL;
+            vTailConv           = NULL;
+            vLateTask           = NULL;
+            nLateDone           = 0;
+            nTailDataSize       = 0;
+            nTailState          = TS_IDLE;
+            bTailPending        = false;
+
             vData               = NULL;
         }
 
         void Convolver::destroy()
         {
+            // Stop the background worker
+            if (pWorker != NULL)
+            {
+                pWorker->cancel();
+                pTailSignal->post();
+                pWorker->join();
+                delete pWorker;
+                pWorker             = NULL;
+            }
+            if (pTailSignal != NULL)
+            {
+                delete pTailSignal;
+                pTailSignal         = NULL;
+            }
+
             free_aligned(vData);
             construct();
         }
 
-        bool Convolver::init(const float *data, size_t count, size_t rank, float phase)
+        bool Convolver::init(const float *data, size_t count, size_t rank, float phase, bool background)
         {
             // Check arguments
             if (count <= 0)
@@ -91,6 +151,9 @@ namespace lsp
             size_t fft_buf_size     = 1 << (rank + 1);
             size_t direct_buf_size  = lsp_max(CONVOLVER_MIN_DATA_BUF_SIZE, int(CONVOLVER_DATA_ALIGN/sizeof(float)));
             size_t bins             = (count + data_buf_size - 1) >> (rank - 1);
+            size_t tail_blocks      = (bins > 1) ? bins - 1 : 0;        // The first bin is covered by direct and raising convolution levels
+            if (tail_blocks <= 1)
+                background              = false;                    // Nothing to do for the background worker
 
             size_t allocate         = (bins + 1) * data_buf_size;       // Size of data buffer (convolutio tail)
             allocate               += data_buf_size * 2;                // Input data frame
@@ -98,6 +161,13 @@ namespace lsp
             allocate               += fft_buf_size;                     // Task data for tail convolution
             allocate               += bins * fft_buf_size;              // FFT convolution data
             allocate               += direct_buf_size;                  // Direct convolution data
+            if (background)
+            {
+                allocate               += data_buf_size;                    // Background worker input frame
+                allocate               += fft_buf_size * 2;                 // Background worker task data and convolution buffer
+                allocate               += fft_buf_size;                     // Task data of the tail dropped by the late worker
+                allocate               += tail_blocks * data_buf_size;      // Background worker output tail
+            }
 
             // Allocate buffer and clear
             uint8_t *pdata          = NULL;
@@ -134,6 +204,22 @@ namespace lsp
             vDirectData             = fptr;
             fptr                   += direct_buf_size;
 
+            // Background worker data
+            if (background)
+            {
+                vTailIn                 = fptr;
+                fptr                   += data_buf_size;
+                vTailTask               = fptr;
+                fptr                   += fft_buf_size;
+                vTailConv               = fptr;
+                fptr                   += fft_buf_size;
+                vLateTask               = fptr;
+                fptr                   += fft_buf_size;
+                vTailOut                = fptr;
+                fptr                   += tail_blocks * data_buf_size;
+                nTailDataSize           = tail_blocks * data_buf_size;
+            }
+
             // Initialize simple values
             nDataBufferSize         = (bins + 1) * data_buf_size;
             nFrameSize              = data_buf_size;
@@ -197,6 +283,7 @@ namespace lsp
             }
 
             nBlocksDone             = nBlocks;
+            nLateDone               = nBlocks;
             ssize_t steps           = data_buf_size >> (CONVOLVER_RANK_MIN - 1);
             if (steps <= 1)
             {
@@ -211,9 +298,84 @@ namespace lsp
 
             nRank                   = rank;
 
+            // Launch the background worker, fall back to the real-time processing of the tail on error
+            if (background)
+            {
+                pTailSignal             = new Semaphore();
+                if ((pTailSignal != NULL) && (pTailSignal->valid()))
+                {
+                    pWorker                 = new TailWorker(this);
+                    if ((pWorker != NULL) && (pWorker->start() != STATUS_OK))
+                    {
+                        delete pWorker;
+                        pWorker                 = NULL;
+                    }
+                }
+            }
+
             return true;
         }
 
+        void Convolver::process_tail()
+        {
+            // Compute the tail blocks starting from the second one, the first block
+            // is always computed by the real-time thread because it should be applied immediately.
+            // The output is aligned to the next frame boundary when the result is collected
+            size_t fft_step     = 1 << (nRank + 1);
+            const float *conv   = &vConvData[2 * fft_step];
+            float *xdst         = vTailOut;
+
+            dsp::fill_zero(vTailOut, nTailDataSize);
+            dsp::fastconv_parse(vTailTask, vTailIn, nRank);
+            for (size_t i=1; i<nBlocks; ++i)
+            {
+                dsp::fastconv_apply(xdst, vTailConv, conv, vTailTask, nRank);
+                xdst               += nFrameSize;
+                conv               += fft_step;
+            }
+        }
+
+        bool Convolver::submit_tail()
+        {
+            // The worker may still process the dropped job, the tail is computed by the real-time thread then
+            if (atomic_load(&nTailState) != TS_IDLE)
+                return false;
+
+            dsp::copy(vTailIn, vFrame - nFrameSize, nFrameSize);
+            atomic_swap(&nTailState, TS_PENDING);
+            pTailSignal->post();
+            bTailPending        = true;
+
+            return true;
+        }
+
+        void Convolver::collect_tail()
+        {
+            // Release the worker after the dropped job
+            if (!bTailPending)
+            {
+                atomic_cas(&nTailState, TS_DONE, TS_IDLE);
+                return;
+            }
+            bTailPending        = false;
+
+            // Apply the tail computed by the worker
+            if (atomic_cas(&nTailState, TS_DONE, TS_IDLE))
+            {
+                dsp::add2(vDataBuffer, vTailOut, nTailDataSize);
+                return;
+            }
+
+            // The worker is late, never wait for it: revoke the job if it has not been started yet,
+            // otherwise drop the result. Only the second block of the dropped tail is due right now,
+            // the rest of blocks is applied by the incremental schedule during the frame
+            atomic_cas(&nTailState, TS_PENDING, TS_IDLE);
+
+            dsp::fastconv_parse(vLateTask, vTailIn, nRank);
+            dsp::fastconv_apply(vDataBuffer, vConvBuffer, &vConvData[2 << (nRank + 1)], vLateTask, nRank);
+            nLateDone           = 2;
+        }
+
         void Convolver::process(float *dst, const float *src, size_t count)
         {
             if (vData == NULL)
@@ -267,8 +429,20 @@ namespace lsp
                         // Need to reset tasks?
                         if (mask & 1)
                         {
+                            // Collect the tail of the previous frame, it may use the task data
+                            if (pWorker != NULL)
+                                collect_tail();
+
                             dsp::fastconv_parse(vTaskData, vFrame - nFrameSize, nRank);
                             nBlocksDone         = 0;
+
+                            // Apply the first block and pass the rest of the tail to the background worker.
+                            // If the worker is busy, the tail is computed by the real-time thread as usual
+                            if ((pWorker != NULL) && (submit_tail()))
+                            {
+                                dsp::fastconv_apply(vDataBuffer, vConvBuffer, &vConvData[1 << (nRank + 1)], vTaskData, nRank);
+                                nBlocksDone         = nBlocks;
+                            }
                         }
 
                         // Need to execute tasks?
@@ -283,6 +457,20 @@ namespace lsp
                             xdst               += (fft_step >> 2);
                             conv               += fft_step;
                         }
+
+                        // Execute tasks of the tail dropped by the late worker, it is shifted by one frame
+                        if (nLateDone < target_blk)
+                        {
+                            conv                = &vConvData[(nLateDone + 1) * fft_step];
+                            xdst                = &vDataBuffer[(nLateDone - 1) << (nRank - 1)];
+
+                            for ( ; nLateDone < target_blk; ++nLateDone)
+                            {
+                                dsp::fastconv_apply(xdst, vConvBuffer, conv, vLateTask, rank);
+                                xdst               += (fft_step >> 2);
+                                conv               += fft_step;
+                            }
+                        }
                     }
                 }
 
@@ -333,6 +521,18 @@ namespace lsp
             v->write("nBlkInit", nBlkInit);
             v->write("fBlkCoef", fBlkCoef);
 
+            v->write("pWorker", pWorker);
+            v->write("pTailSignal", pTailSignal);
+            v->write("vTailIn", vTailIn);
+            v->write("vTailOut", vTailOut);
+            v->write("vTailTask", vTailTask);
+            v->write("vTailConv", vTailConv);
+            v->write("vLateTask", vLateTask);
+            v->write("nLateDone", nLateDone);
+            v->write("nTailDataSize", nTailDataSize);
+            v->write("nTailState", int(nTailState));
+            v->write("bTailPending", bTailPending);
+
             v->write("vData", vData);
         }
 
@@ -27,6 +27,8 @@ namespace lsp
 {
     namespace dspu
     {
+        static constexpr float PRUNE_THRESHOLD      = 1e-6f;    // -120 dB, gains below are zeroed in pruning mode
+
         FFTCrossover::FFTCrossover()
         {
             construct();
@@ -435,6 +437,14 @@ namespace lsp
             sSplitter.set_phase(phase);
         }
 
+        void FFTCrossover::set_pruning(bool enable)
+        {
+            if (sSplitter.pruning() == enable)
+                return;
+            sSplitter.set_pruning(enable);
+            mark_bands_for_update();
+        }
+
         bool FFTCrossover::needs_update() const
         {
             for (size_t i=0, n=sSplitter.handlers(); i<n; ++i)
@@ -455,6 +465,14 @@ namespace lsp
                     update_band(&vBands[i]);
         }
 
+        void FFTCrossover::prune_gain(float *gain, size_t count)
+        {
+            // Make negligible gains exactly zero, so the splitter can detect the band edges
+            for (size_t i=0; i<count; ++i)
+                if (gain[i] < PRUNE_THRESHOLD)
+                    gain[i]     = 0.0f;
+        }
+
         void FFTCrossover::update_band(band_t *b)
         {
             if (!b->bUpdate)
@@ -470,12 +488,16 @@ namespace lsp
                     crossover::lopass_fft_apply(b->vFFT, b->fLpfFreq, b->fLpfSlope, nSampleRate, rank);
 
                 dsp::limit1(b->vFFT, 0.0f, b->fFlatten, bins);
+                if (sSplitter.pruning())
+                    prune_gain(b->vFFT, bins);
                 dsp::mul_k2(b->vFFT, b->fGain, bins);
             }
             else if (b->bLpf)
             {
                 crossover::lopass_fft_set(b->vFFT, b->fLpfFreq, b->fLpfSlope, nSampleRate, rank);
                 dsp::limit1(b->vFFT, 0.0f, b->fFlatten, bins);
+                if (sSplitter.pruning())
+                    prune_gain(b->vFFT, bins);
                 dsp::mul_k2(b->vFFT, b->fGain, bins);
             }
             else
@@ -0,0 +1,500 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp-units/util/MultiConvolver.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#define MCONV_MIN_DATA_BUF_SIZE             (1 << (CONVOLVER_RANK_MIN - 1))
+#define MCONV_DATA_ALIGN                    0x40
+
+namespace lsp
+{
+    namespace dspu
+    {
+        MultiConvolver::MultiConvolver()
+        {
+            construct();
+        }
+
+        MultiConvolver::~MultiConvolver()
+        {
+            destroy();
+        }
+
+        void MultiConvolver::construct()
+        {
+            vIR                 = NULL;
+            vInputs             = NULL;
+            vOutputs            = NULL;
+            vFftAcc             = NULL;
+            vFftTmp             = NULL;
+
+            nInputs             = 0;
+            nOutputs            = 0;
+            nDataBufferSize     = 0;
+            nFrameSize          = 0;
+            nFrameOff           = 0;
+            nConvSize           = 0;
+            nLevels             = 0;
+            nBlocks             = 0;
+            nBlocksDone         = 0;
+            nRank               = 0;
+
+            nBlkInit            = 0;
+            fBlkCoef            = 0.0f;
+
+            vData               = NULL;
+        }
+
+        void MultiConvolver::destroy()
+        {
+            free_aligned(vData);
+            construct();
+        }
+
+        void MultiConvolver::parse(float *dst, const float *src, size_t count, size_t rank)
+        {
+            // Compute the spectrum of the real data padded with zeros to 2^rank samples
+            dsp::pcomplex_r2c(dst, src, count);
+            dsp::fill_zero(&dst[count * 2], (2 << rank) - count * 2);
+            dsp::packed_direct_fft(dst, dst, rank);
+        }
+
+        bool MultiConvolver::init(const float * const *data, const size_t *count, size_t inputs, size_t outputs, size_t rank, float phase)
+        {
+            // Check arguments
+            if ((data == NULL) || (count == NULL) || (inputs <= 0) || (outputs <= 0))
+                return false;
+
+            const size_t routes     = inputs * outputs;
+            size_t max_count        = 0;
+            for (size_t i=0; i<routes; ++i)
+            {
+                if (data[i] != NULL)
+                    max_count               = lsp_max(max_count, count[i]);
+            }
+            if (max_count <= 0)
+            {
+                destroy();
+                return true;
+            }
+
+            // Determine number of buffers
+            rank                    = lsp_limit(ssize_t(rank), CONVOLVER_RANK_MIN, CONVOLVER_RANK_MAX);
+
+            // Determine size of buffers
+            const size_t data_buf_size  = 1 << (rank - 1);
+            const size_t fft_buf_size   = 1 << (rank + 1);
+            const size_t direct_buf_size= lsp_max(MCONV_MIN_DATA_BUF_SIZE, int(MCONV_DATA_ALIGN/sizeof(float)));
+            const size_t bins           = (max_count + data_buf_size - 1) >> (rank - 1);
+
+            const size_t szof_ir        = align_size(sizeof(ir_t) * routes, MCONV_DATA_ALIGN);
+            const size_t szof_inputs    = align_size(sizeof(input_t) * inputs, MCONV_DATA_ALIGN);
+            const size_t szof_outputs   = align_size(sizeof(output_t) * outputs, MCONV_DATA_ALIGN);
+            const size_t szof_fft       = fft_buf_size * sizeof(float);
+            const size_t szof_frame     = data_buf_size * 2 * sizeof(float);
+            const size_t szof_data      = (bins + 1) * data_buf_size * sizeof(float);
+            const size_t szof_direct    = direct_buf_size * sizeof(float);
+
+            size_t to_alloc         = szof_ir + szof_inputs + szof_outputs;
+            to_alloc               += szof_fft * 2;                             // Spectrum accumulator and temporary buffer
+            to_alloc               += (szof_frame + szof_fft * 2) * inputs;     // Input frames and spectrums
+            to_alloc               += szof_data * outputs;                      // Output data buffers
+            for (size_t i=0; i<routes; ++i)
+            {
+                if ((data[i] == NULL) || (count[i] <= 0))
+                    continue;
+                size_t ir_bins          = (count[i] + data_buf_size - 1) >> (rank - 1);
+                to_alloc               += ir_bins * szof_fft + szof_direct;     // FFT convolution and direct convolution data
+            }
+
+            // Allocate buffer
+            uint8_t *pdata          = NULL;
+            uint8_t *ptr            = alloc_aligned<uint8_t>(pdata, to_alloc, MCONV_DATA_ALIGN);
+            if (ptr == NULL)
+                return false;
+
+            destroy();
+            vData                   = pdata;
+
+            // Perform initialization
+            vIR                     = advance_ptr_bytes<ir_t>(ptr, szof_ir);
+            vInputs                 = advance_ptr_bytes<input_t>(ptr, szof_inputs);
+            vOutputs                = advance_ptr_bytes<output_t>(ptr, szof_outputs);
+            vFftAcc                 = advance_ptr_bytes<float>(ptr, szof_fft);
+            vFftTmp                 = advance_ptr_bytes<float>(ptr, szof_fft);
+
+            for (size_t i=0; i<inputs; ++i)
+            {
+                input_t *in             = &vInputs[i];
+
+                in->vFrame              = advance_ptr_bytes<float>(ptr, szof_frame);
+                in->vFft                = advance_ptr_bytes<float>(ptr, szof_fft);
+                in->vTask               = advance_ptr_bytes<float>(ptr, szof_fft);
+
+                dsp::fill_zero(in->vFrame, data_buf_size * 2);
+                dsp::fill_zero(in->vFft, fft_buf_size);
+                dsp::fill_zero(in->vTask, fft_buf_size);
+                in->vFrame             += data_buf_size;
+            }
+
+            for (size_t i=0; i<outputs; ++i)
+            {
+                output_t *out           = &vOutputs[i];
+
+                out->vData              = advance_ptr_bytes<float>(ptr, szof_data);
+                dsp::fill_zero(out->vData, (bins + 1) * data_buf_size);
+            }
+
+            /* Calculate convolutions, each impulse response has the same layout as the Convolver has:
+                +---+---+------+------------+------------------------+
+                |FFT|FFT|FFT x2|   FFT x4   |       FFT x8           |  . . .
+                +---+---+------+------------+------------------------+
+             */
+            nLevels                 = 0;
+            nBlocks                 = 0;
+
+            for (size_t i=0; i<routes; ++i)
+            {
+                ir_t *ir                = &vIR[i];
+                ir->vConv               = NULL;
+                ir->vDirect             = NULL;
+                ir->nDirect             = 0;
+                ir->nLevels             = 0;
+                ir->nBlocks             = 0;
+
+                const float *src        = data[i];
+                size_t n_src            = count[i];
+                if ((src == NULL) || (n_src <= 0))
+                    continue;
+
+                size_t ir_bins          = (n_src + data_buf_size - 1) >> (rank - 1);
+                ir->vConv               = advance_ptr_bytes<float>(ptr, ir_bins * szof_fft);
+                ir->vDirect             = advance_ptr_bytes<float>(ptr, szof_direct);
+                float *conv             = ir->vConv;
+                size_t brank            = CONVOLVER_RANK_MIN;
+
+                // Process direct convolution data
+                ir->nDirect             = lsp_min(n_src, size_t(MCONV_MIN_DATA_BUF_SIZE));
+                dsp::copy(ir->vDirect, src, ir->nDirect);
+                parse(conv, src, ir->nDirect, brank);
+
+                src                    += ir->nDirect;
+                conv                   += (1 << (brank + 1));
+                n_src                  -= ir->nDirect;
+
+                // Prepare raising levels
+                for (; (n_src > 0) && (brank < rank); ++brank)
+                {
+                    size_t n                = lsp_min(n_src, size_t(1) << (brank - 1));
+                    parse(conv, src, n, brank);
+
+                    src                    += n;
+                    conv                   += (1 << (brank + 1));
+                    n_src                  -= n;
+                    ++ir->nLevels;
+                }
+
+                // Prepare constant part
+                while (n_src > 0)
+                {
+                    size_t n                = lsp_min(n_src, data_buf_size);
+                    parse(conv, src, n, rank);
+
+                    src                    += n;
+                    conv                   += fft_buf_size;
+                    n_src                  -= n;
+                    ++ir->nBlocks;
+                }
+
+                nLevels                 = lsp_max(nLevels, ir->nLevels);
+                nBlocks                 = lsp_max(nBlocks, ir->nBlocks);
+            }
+
+            // Initialize simple values
+            nInputs                 = inputs;
+            nOutputs                = outputs;
+            nDataBufferSize         = (bins + 1) * data_buf_size;
+            nFrameSize              = data_buf_size;
+            nFrameOff               = size_t(phase * nFrameSize) % nFrameSize;
+            nConvSize               = max_count;
+            nBlocksDone             = nBlocks;
+            nRank                   = rank;
+
+            ssize_t steps           = data_buf_size >> (CONVOLVER_RANK_MIN - 1);
+            if (steps <= 1)
+            {
+                nBlkInit                = nBlocks;
+                fBlkCoef                = 0.0f;
+            }
+            else
+            {
+                nBlkInit                = 1;
+                fBlkCoef                = (float(nBlocks) + 1e-3f) / (float(steps) - 1.0f);
+            }
+
+            return true;
+        }
+
+        void MultiConvolver::apply(size_t output, size_t offset, size_t part, size_t rank, bool tail)
+        {
+            // Determine the location of the partition in the impulse response
+            const size_t conv_off   = (tail) ? (part + 1) << (rank + 1) :
+                                      (part > 0) ? 1 << (rank + 1) : 0;
+            const size_t csize      = 1 << rank;
+            bool accumulated        = false;
+
+            // Accumulate the spectrum of all inputs routed to the output
+            for (size_t i=0; i<nInputs; ++i)
+            {
+                const ir_t *ir          = &vIR[i * nOutputs + output];
+                if (tail)
+                {
+                    if (part >= ir->nBlocks)
+                        continue;
+                }
+                else if (part > 0)
+                {
+                    if (part > ir->nLevels)
+                        continue;
+                }
+                else if (ir->nDirect <= 0)
+                    continue;
+
+                const input_t *in       = &vInputs[i];
+                const float *spectrum   = (tail) ? in->vTask : in->vFft;
+                if (accumulated)
+                {
+                    dsp::pcomplex_mul3(vFftTmp, spectrum, &ir->vConv[conv_off], csize);
+                    dsp::add2(vFftAcc, vFftTmp, csize * 2);
+                }
+                else
+                {
+                    dsp::pcomplex_mul3(vFftAcc, spectrum, &ir->vConv[conv_off], csize);
+                    accumulated             = true;
+                }
+            }
+
+            // Perform single reverse FFT for all inputs
+            if (!accumulated)
+                return;
+
+            float *dst              = &vOutputs[output].vData[offset];
+            dsp::packed_reverse_fft(vFftAcc, vFftAcc, rank);
+            dsp::pcomplex_c2r(vFftAcc, vFftAcc, csize);
+            dsp::add2(dst, vFftAcc, csize);
+        }
+
+        void MultiConvolver::process(float * const *dst, const float * const *src, size_t count)
+        {
+            if (vData == NULL)
+            {
+                for (size_t i=0; i<nOutputs; ++i)
+                    dsp::fill_zero(dst[i], count);
+                return;
+            }
+
+            for (size_t off = 0; off < count; )
+            {
+                size_t sub_off      = nFrameOff & (MCONV_MIN_DATA_BUF_SIZE - 1);        // Determine sub-offset in the frame
+
+                // We are strictly at the boundary of the frame?
+                if (sub_off == 0)
+                {
+                    // Calculate convolution mask in the same way as the Convolver does
+                    size_t sub_id       = nFrameOff >> (CONVOLVER_RANK_MIN - 1);
+                    size_t mask         = ((sub_id-1) ^ sub_id);
+                    size_t rank         = CONVOLVER_RANK_MIN;
+
+                    // Apply convolution with raising level
+                    for (size_t i=0; i<nLevels; ++i)
+                    {
+                        if (mask & 1)
+                        {
+                            // Compute the spectrum of each input only once
+                            const size_t length     = 1 << (rank - 1);
+                            for (size_t j=0; j<nInputs; ++j)
+                            {
+                                input_t *in             = &vInputs[j];
+                                parse(in->vFft, in->vFrame + nFrameOff - length, length, rank);
+                            }
+
+                            for (size_t j=0; j<nOutputs; ++j)
+                                apply(j, nFrameOff, i + 1, rank, false);
+                        }
+
+                        ++rank;
+                        mask              >>= 1;
+                    }
+
+                    // Need to apply long tail?
+                    if (nBlocks > 0)
+                    {
+                        // Need to reset tasks?
+                        if (mask & 1)
+                        {
+                            for (size_t j=0; j<nInputs; ++j)
+                            {
+                                input_t *in             = &vInputs[j];
+                                parse(in->vTask, in->vFrame - nFrameSize, nFrameSize, nRank);
+                            }
+                            nBlocksDone         = 0;
+                        }
+
+                        // Need to execute tasks?
+                        size_t target_blk   = lsp_min(nBlocks, size_t(nBlkInit + fBlkCoef * sub_id));
+                        for ( ; nBlocksDone < target_blk; ++nBlocksDone)
+                        {
+                            for (size_t j=0; j<nOutputs; ++j)
+                                apply(j, nBlocksDone << (nRank - 1), nBlocksDone, nRank, true);
+                        }
+                    }
+                }
+
+                // Store data to frame
+                size_t to_do        = lsp_min(count - off, size_t(MCONV_MIN_DATA_BUF_SIZE - sub_off));
+                for (size_t i=0; i<nInputs; ++i)
+                    dsp::copy(&vInputs[i].vFrame[nFrameOff], &src[i][off], to_do);
+
+                // Apply direct convolution
+                if (to_do == MCONV_MIN_DATA_BUF_SIZE)
+                {
+                    for (size_t i=0; i<nInputs; ++i)
+                    {
+                        input_t *in             = &vInputs[i];
+                        parse(in->vFft, &in->vFrame[nFrameOff], to_do, CONVOLVER_RANK_MIN);
+                    }
+                    for (size_t i=0; i<nOutputs; ++i)
+                        apply(i, nFrameOff, 0, CONVOLVER_RANK_MIN, false);
+                }
+                else
+                {
+                    for (size_t i=0; i<nInputs; ++i)
+                    {
+                        const input_t *in       = &vInputs[i];
+                        for (size_t j=0; j<nOutputs; ++j)
+                        {
+                            const ir_t *ir          = &vIR[i * nOutputs + j];
+                            if (ir->nDirect > 0)
+                                dsp::convolve(&vOutputs[j].vData[nFrameOff], &in->vFrame[nFrameOff], ir->vDirect, ir->nDirect, to_do);
+                        }
+                    }
+                }
+
+                // Output result
+                for (size_t i=0; i<nOutputs; ++i)
+                    dsp::copy(&dst[i][off], &vOutputs[i].vData[nFrameOff], to_do);
+
+                // Update counters/pointers
+                nFrameOff          += to_do;
+                off                += to_do;
+
+                // Check that we are out of the frame and need to shift the data and convolution tail
+                if (nFrameOff >= nFrameSize)
+                {
+                    nFrameOff          -= nFrameSize;
+                    for (size_t i=0; i<nInputs; ++i)
+                    {
+                        float *frame            = vInputs[i].vFrame;
+                        dsp::move(frame - nFrameSize, frame, nFrameSize);
+                    }
+                    for (size_t i=0; i<nOutputs; ++i)
+                    {
+                        float *buf              = vOutputs[i].vData;
+                        dsp::move(buf, &buf[nFrameSize], nDataBufferSize - nFrameSize);
+                        dsp::fill_zero(&buf[nDataBufferSize - nFrameSize], nFrameSize);
+                    }
+                }
+            }
+        }
+
+        void MultiConvolver::dump(IStateDumper *v) const
+        {
+            v->begin_array("vIR", vIR, nInputs * nOutputs);
+            {
+                for (size_t i=0, n=nInputs * nOutputs; i<n; ++i)
+                {
+                    const ir_t *ir = &vIR[i];
+                    v->begin_object(ir, sizeof(ir_t));
+                    {
+                        v->write("vConv", ir->vConv);
+                        v->write("vDirect", ir->vDirect);
+                        v->write("nDirect", ir->nDirect);
+                        v->write("nLevels", ir->nLevels);
+                        v->write("nBlocks", ir->nBlocks);
+                    }
+                    v->end_object();
+                }
+            }
+            v->end_array();
+
+            v->begin_array("vInputs", vInputs, nInputs);
+            {
+                for (size_t i=0; i<nInputs; ++i)
+                {
+                    const input_t *in = &vInputs[i];
+                    v->begin_object(in, sizeof(input_t));
+                    {
+                        v->write("vFrame", in->vFrame);
+                        v->write("vFft", in->vFft);
+                        v->write("vTask", in->vTask);
+                    }
+                    v->end_object();
+                }
+            }
+            v->end_array();
+
+            v->begin_array("vOutputs", vOutputs, nOutputs);
+            {
+                for (size_t i=0; i<nOutputs; ++i)
+                {
+                    const output_t *out = &vOutputs[i];
+                    v->begin_object(out, sizeof(output_t));
+                    {
+                        v->write("vData", out->vData);
+                    }
+                    v->end_object();
+                }
+            }
+            v->end_array();
+
+            v->write("vFftAcc", vFftAcc);
+            v->write("vFftTmp", vFftTmp);
+
+            v->write("nInputs", nInputs);
+            v->write("nOutputs", nOutputs);
+            v->write("nDataBufferSize", nDataBufferSize);
+            v->write("nFrameSize", nFrameSize);
+            v->write("nFrameOff", nFrameOff);
+            v->write("nConvSize", nConvSize);
+            v->write("nLevels", nLevels);
+            v->write("nBlocks", nBlocks);
+            v->write("nBlocksDone", nBlocksDone);
+            v->write("nRank", nRank);
+            v->write("nBlkInit", nBlkInit);
+            v->write("fBlkCoef", fBlkCoef);
+
+            v->write("vData", vData);
+        }
+
+    } /* namespace dspu */
+} /* namespace lsp */
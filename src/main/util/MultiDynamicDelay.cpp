@@ -0,0 +1,319 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp-units/util/MultiDynamicDelay.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        static constexpr size_t BUF_SIZE        = 0x400;
+        static constexpr size_t INTERP_GAP      = 4;        // Additional samples required by interpolation
+
+        static inline float tap_none(const float *p, float delay, ssize_t max)
+        {
+            const ssize_t n     = lsp_limit(ssize_t(delay), 0, max);
+            return p[-n];
+        }
+
+        static inline float tap_linear(const float *p, float delay, float max)
+        {
+            const float d       = lsp_limit(delay, 0.0f, max);
+            const ssize_t n     = ssize_t(d);
+            const float f       = d - float(n);
+            const float *s      = &p[-n];
+
+            return s[0] + (s[-1] - s[0]) * f;
+        }
+
+        static inline float tap_cubic(const float *p, float delay, float max)
+        {
+            const float d       = lsp_limit(delay, 1.0f, max);
+            const ssize_t n     = ssize_t(d);
+            const float f       = d - float(n);
+            const float *s      = &p[-n];
+
+            // Catmull-Rom spline over s[1], s[0], s[-1], s[-2]
+            const float p0      = s[1];
+            const float p1      = s[0];
+            const float p2      = s[-1];
+            const float p3      = s[-2];
+
+            return p1 + 0.5f * f * (p2 - p0 + f * (2.0f*p0 - 5.0f*p1 + 4.0f*p2 - p3 + f * (3.0f*(p1 - p2) + p3 - p0)));
+        }
+
+        static inline float tap_allpass(const float *p, float delay, float max, float & state)
+        {
+            const float d       = lsp_limit(delay, 0.0f, max);
+            ssize_t n           = ssize_t(d);
+            float f             = d - float(n);
+
+            // Keep the fractional delay within [0.5, 1.5) to move the pole of the filter away from -1
+            if ((f < 0.5f) && (n > 0))
+            {
+                --n;
+                f                  += 1.0f;
+            }
+
+            const float a       = (1.0f - f) / (1.0f + f);
+            const float *s      = &p[-n];
+            const float y       = a * (s[0] - state) + s[-1];
+            state               = y;
+
+            return y;
+        }
+
+        MultiDynamicDelay::MultiDynamicDelay()
+        {
+            construct();
+        }
+
+        MultiDynamicDelay::~MultiDynamicDelay()
+        {
+            destroy();
+        }
+
+        void MultiDynamicDelay::construct()
+        {
+            vBuffer     = NULL;
+            vVoices     = NULL;
+            nVoices     = 0;
+            nHead       = 0;
+            nCapacity   = 0;
+            nMaxDelay   = 0;
+            enInterp    = DI_NONE;
+            pData       = NULL;
+        }
+
+        void MultiDynamicDelay::destroy()
+        {
+            if (pData != NULL)
+            {
+                free_aligned(pData);
+
+                vBuffer     = NULL;
+                vVoices     = NULL;
+                nVoices     = 0;
+                nHead       = 0;
+                nCapacity   = 0;
+                nMaxDelay   = 0;
+                pData       = NULL;
+            }
+        }
+
+        status_t MultiDynamicDelay::init(size_t voices, size_t max_size)
+        {
+            if (voices <= 0)
+                return STATUS_BAD_ARGUMENTS;
+
+            destroy();
+
+            // The capacity should be enough to not to overwrite the delayed data
+            // while writing the whole block of input samples before reading it
+            const size_t capacity       = align_size(max_size + INTERP_GAP + BUF_SIZE, BUF_SIZE);
+            const size_t szof_buffer    = align_size(capacity * 2 * sizeof(float), DEFAULT_ALIGN);
+            const size_t szof_voices    = align_size(voices * sizeof(voice_t), DEFAULT_ALIGN);
+            const size_t to_alloc       = szof_buffer + szof_voices;
+
+            uint8_t *ptr                = alloc_aligned<uint8_t>(pData, to_alloc, DEFAULT_ALIGN);
+            if (ptr == NULL)
+                return STATUS_NO_MEM;
+
+            vBuffer                     = advance_ptr_bytes<float>(ptr, szof_buffer);
+            vVoices                     = advance_ptr_bytes<voice_t>(ptr, szof_voices);
+
+            nVoices                     = uint32_t(voices);
+            nHead                       = 0;
+            nCapacity                   = uint32_t(capacity);
+            nMaxDelay                   = uint32_t(max_size);
+
+            clear();
+
+            return STATUS_OK;
+        }
+
+        void MultiDynamicDelay::set_interpolation(delay_interp_t interp)
+        {
+            if (enInterp == interp)
+                return;
+
+            enInterp                    = interp;
+            for (size_t i=0; i<nVoices; ++i)
+                vVoices[i].fAllpass         = 0.0f;
+        }
+
+        void MultiDynamicDelay::clear()
+        {
+            dsp::fill_zero(vBuffer, nCapacity * 2);
+            for (size_t i=0; i<nVoices; ++i)
+                vVoices[i].fAllpass         = 0.0f;
+            nHead                       = 0;
+        }
+
+        void MultiDynamicDelay::write_input(const float *src, size_t count)
+        {
+            float *dst          = &vBuffer[nHead];
+            dsp::copy(dst, src, count);
+            dsp::copy(&dst[nCapacity], src, count);
+
+            nHead              += count;
+            if (nHead >= nCapacity)
+                nHead               = 0;
+        }
+
+        void MultiDynamicDelay::process_voice(float *dst, const float *delay, voice_t *v, size_t head, size_t count)
+        {
+            // Pointer to the mirrored copy of the first written sample, any tap
+            // with delay in range [0, nMaxDelay] stays within the buffer
+            const float *p      = &vBuffer[head + nCapacity];
+            const float max     = float(nMaxDelay);
+
+            switch (enInterp)
+            {
+                case DI_LINEAR:
+                    for (size_t i=0; i<count; ++i)
+                        dst[i]              = tap_linear(&p[i], delay[i], max);
+                    break;
+
+                case DI_CUBIC:
+                    for (size_t i=0; i<count; ++i)
+                        dst[i]              = tap_cubic(&p[i], delay[i], max);
+                    break;
+
+                case DI_ALLPASS:
+                {
+                    float state         = v->fAllpass;
+                    for (size_t i=0; i<count; ++i)
+                        dst[i]              = tap_allpass(&p[i], delay[i], max, state);
+                    v->fAllpass         = state;
+                    break;
+                }
+
+                case DI_NONE:
+                default:
+                    for (size_t i=0; i<count; ++i)
+                        dst[i]              = tap_none(&p[i], delay[i], nMaxDelay);
+                    break;
+            }
+        }
+
+        void MultiDynamicDelay::process_feedback(
+            float * const *out, const float *in,
+            const float * const *delay, const float *fgain,
+            size_t offset, size_t count)
+        {
+            float *w            = &vBuffer[nHead];
+            float *m            = &w[nCapacity];
+            const float max     = float(nMaxDelay);
+
+            for (size_t i=0; i<count; ++i)
+            {
+                const size_t k      = offset + i;
+                w[i]                = in[k];
+                m[i]                = in[k];
+
+                // Read all taps
+                float sum           = 0.0f;
+                for (size_t j=0; j<nVoices; ++j)
+                {
+                    float s;
+                    switch (enInterp)
+                    {
+                        case DI_LINEAR:     s = tap_linear(&m[i], delay[j][k], max); break;
+                        case DI_CUBIC:      s = tap_cubic(&m[i], delay[j][k], max); break;
+                        case DI_ALLPASS:    s = tap_allpass(&m[i], delay[j][k], max, vVoices[j].fAllpass); break;
+                        case DI_NONE:
+                        default:            s = tap_none(&m[i], delay[j][k], nMaxDelay); break;
+                    }
+                    out[j][k]           = s;
+                    sum                += s;
+                }
+
+                // Add feedback to the written sample and its mirror
+                const float fb      = sum * fgain[k];
+                w[i]               += fb;
+                m[i]               += fb;
+            }
+
+            nHead              += count;
+            if (nHead >= nCapacity)
+                nHead               = 0;
+        }
+
+        void MultiDynamicDelay::process(
+            float * const *out, const float *in,
+            const float * const *delay, const float *fgain,
+            size_t samples)
+        {
+            for (size_t offset=0; offset < samples; )
+            {
+                // Never cross the end of the ring buffer within one block
+                const size_t to_do  = lsp_min(samples - offset, BUF_SIZE, nCapacity - nHead);
+
+                if (fgain != NULL)
+                {
+                    // Feedback makes each sample depend on previous output, process sample by sample
+                    process_feedback(out, in, delay, fgain, offset, to_do);
+                }
+                else
+                {
+                    // Write the whole block and then gather taps for each voice
+                    const size_t head   = nHead;
+                    write_input(&in[offset], to_do);
+                    for (size_t i=0; i<nVoices; ++i)
+                        process_voice(&out[i][offset], &delay[i][offset], &vVoices[i], head, to_do);
+                }
+
+                offset             += to_do;
+            }
+        }
+
+        void MultiDynamicDelay::dump(IStateDumper *v) const
+        {
+            v->write("vBuffer", vBuffer);
+            v->begin_array("vVoices", vVoices, nVoices);
+            {
+                for (size_t i=0; i<nVoices; ++i)
+                {
+                    const voice_t *vc = &vVoices[i];
+
+                    v->begin_object(vc, sizeof(voice_t));
+                    {
+                        v->write("fAllpass", vc->fAllpass);
+                    }
+                    v->end_object();
+                }
+            }
+            v->end_array();
+            v->write("nVoices", nVoices);
+            v->write("nHead", nHead);
+            v->write("nCapacity", nCapacity);
+            v->write("nMaxDelay", nMaxDelay);
+            v->write("enInterp", int(enInterp));
+            v->write("pData", pData);
+        }
+
+    } /* namespace dspu */
+} /* namespace lsp */
+
+
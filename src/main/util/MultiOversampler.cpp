@@ -0,0 +1,414 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp-units/util/MultiOversampler.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#define MOS_UP_BUFFER_SIZE      (12 * 1024)   /* Multiple of 3 and 4 */
+#define MOS_CUTOFF              20000.0f
+
+namespace lsp
+{
+    namespace dspu
+    {
+        IMultiOversamplerCallback::~IMultiOversamplerCallback()
+        {
+        }
+
+        void IMultiOversamplerCallback::process(float * const *out, const float * const *in, size_t channels, size_t samples)
+        {
+            for (size_t i=0; i<channels; ++i)
+                dsp::copy(out[i], in[i], samples);
+        }
+
+        MultiOversampler::MultiOversampler()
+        {
+            construct();
+        }
+
+        MultiOversampler::~MultiOversampler()
+        {
+            destroy();
+        }
+
+        void MultiOversampler::construct()
+        {
+            pCallback       = NULL;
+            pUpFunc         = dsp::copy;
+            pDownFunc       = dsp::copy;
+            nChannels       = 0;
+            nRatio          = 1;
+            nUpHead         = 0;
+            nMode           = OM_NONE;
+            nSampleRate     = 0;
+            nUpdate         = UP_ALL;
+            nFilterType     = OF_IIR;
+            nFirLength      = 0;
+            vFirKernel      = NULL;
+
+            for (size_t i=0; i<MULTI_OVERSAMPLER_MAX_CHANNELS; ++i)
+            {
+                channel_t *c    = &vChannels[i];
+                c->vUpBuffer    = NULL;
+                c->vFirBuffer   = NULL;
+                vUpPtr[i]       = NULL;
+                c->sBank.construct();
+            }
+
+            sFilter.construct();
+            sFilterBank.construct();
+            sBank.construct();
+
+            pData           = NULL;
+            bFilter         = true;
+            bLanes          = false;
+        }
+
+        bool MultiOversampler::init(size_t channels)
+        {
+            if ((channels < 1) || (channels > MULTI_OVERSAMPLER_MAX_CHANNELS))
+                return false;
+
+            destroy();
+
+            // Allocate buffers for all channels as a single memory chunk
+            const size_t szof_buf   = align_size(MOS_UP_BUFFER_SIZE + LSP_DSP_RESAMPLING_RSV_SAMPLES, DEFAULT_ALIGN);
+            const size_t szof_fir   = align_size(Oversampler::fir_buffer_size(), DEFAULT_ALIGN);
+            const size_t szof_kernel= align_size(OVERSAMPLER_FIR_MAX_LENGTH, DEFAULT_ALIGN);
+            const size_t to_alloc   = szof_kernel + (szof_buf + szof_fir) * channels;
+            float *ptr              = alloc_aligned<float>(pData, to_alloc, DEFAULT_ALIGN);
+            if (ptr == NULL)
+                return false;
+
+            // Initialize the anti-aliasing filter which is shared between all channels
+            const bool lanes        = channels >= MULTI_FILTERBANK_MIN_CHANNELS;
+            if ((!sFilterBank.init(FILTER_CHAINS_MAX)) ||
+                (!sFilter.init(&sFilterBank)) ||
+                ((lanes) && (!sBank.init(channels, FILTER_CHAINS_MAX))))
+            {
+                destroy();
+                return false;
+            }
+
+            for (size_t i=0; (!lanes) && (i<channels); ++i)
+            {
+                if (!vChannels[i].sBank.init(FILTER_CHAINS_MAX))
+                {
+                    destroy();
+                    return false;
+                }
+            }
+
+            // Clear buffers
+            dsp::fill_zero(ptr, to_alloc);
+            vFirKernel              = ptr;
+            ptr                    += szof_kernel;
+
+            for (size_t i=0; i<channels; ++i)
+            {
+                channel_t *c        = &vChannels[i];
+                c->vUpBuffer        = ptr;
+                ptr                += szof_buf;
+                c->vFirBuffer       = ptr;
+                ptr                += szof_fir;
+            }
+
+            nChannels           = channels;
+            nUpHead             = 0;
+            nFirLength          = 0;
+            nUpdate             = UP_ALL;
+            bLanes              = lanes;
+
+            return true;
+        }
+
+        void MultiOversampler::destroy()
+        {
+            for (size_t i=0; i<MULTI_OVERSAMPLER_MAX_CHANNELS; ++i)
+            {
+                channel_t *c    = &vChannels[i];
+                c->vUpBuffer    = NULL;
+                c->vFirBuffer   = NULL;
+                vUpPtr[i]       = NULL;
+                c->sBank.destroy();
+            }
+
+            sBank.destroy();
+            sFilter.destroy();
+            sFilterBank.destroy();
+
+            free_aligned(pData);
+            vFirKernel      = NULL;
+            nFirLength      = 0;
+            nChannels       = 0;
+            pCallback       = NULL;
+            bLanes          = false;
+        }
+
+        void MultiOversampler::set_sample_rate(size_t sr)
+        {
+            if (sr == nSampleRate)
+                return;
+            nSampleRate     = sr;
+            nUpdate        |= UP_SAMPLE_RATE;
+
+            // Update filter parameters
+            filter_params_t fp;
+            fp.fFreq        = lsp_min(MOS_CUTOFF, sr * 0.42f);       // Calculate cutoff frequency
+            fp.fFreq2       = fp.fFreq;
+            fp.fGain        = 1.0f;
+            fp.fQuality     = 0.1f;
+            fp.nSlope       = 30;               // 30 poles = 30 * 3db/oct = 90 db/Oct
+            fp.nType        = FLT_BT_BWC_LOPASS;// Chebyshev filter
+
+            sFilter.update(nSampleRate * nRatio, &fp);
+        }
+
+        void MultiOversampler::set_mode(over_mode_t mode)
+        {
+            if (nMode == mode)
+                return;
+
+            nMode       = mode;
+            nRatio      = Oversampler::get_ratio(mode);
+            pUpFunc     = Oversampler::get_function(mode);
+            pDownFunc   = Oversampler::get_down_function(nRatio);
+
+            nUpdate    |= UP_MODE;
+        }
+
+        void MultiOversampler::set_filter_type(over_filter_t type)
+        {
+            if (nFilterType == type)
+                return;
+
+            nFilterType = type;
+            nUpdate    |= UP_MODE;
+        }
+
+        void MultiOversampler::update_settings()
+        {
+            const bool clear    = nUpdate & (UP_MODE | UP_SAMPLE_RATE);
+            if (clear)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    channel_t *c    = &vChannels[i];
+                    dsp::fill_zero(c->vUpBuffer, MOS_UP_BUFFER_SIZE + LSP_DSP_RESAMPLING_RSV_SAMPLES);
+                    dsp::fill_zero(c->vFirBuffer, Oversampler::fir_buffer_size());
+                }
+                nUpHead       = 0;
+
+                // Update the FIR filter
+                nFirLength    = ((bFilter) && (nFilterType == OF_FIR_LINEAR)) ?
+                                Oversampler::build_fir_kernel(vFirKernel, nRatio) : 0;
+            }
+
+            filter_params_t fp;
+            sFilter.get_params(&fp);
+            sFilter.update(nSampleRate * nRatio, &fp);
+
+            // Compute the filter chains once and apply them to all channels
+            sFilterBank.begin();
+            sFilter.rebuild();
+            sFilterBank.end(true);
+
+            const size_t items  = sFilterBank.size();
+            if (bLanes)
+            {
+                sBank.begin();
+                for (size_t j=0; j<items; ++j)
+                    *(sBank.add_chain()) = *(sFilterBank.chain(j));
+                sBank.end(clear);
+            }
+            else
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    FilterBank *dst     = &vChannels[i].sBank;
+                    dst->begin();
+                    for (size_t j=0; j<items; ++j)
+                        *(dst->add_chain()) = *(sFilterBank.chain(j));
+                    dst->end(clear);
+                }
+            }
+
+            nUpdate = 0;
+        }
+
+        size_t MultiOversampler::upsample_block(const float * const *src, size_t offset, size_t samples)
+        {
+            // Check that there is enough space in buffers
+            if (nUpHead >= MOS_UP_BUFFER_SIZE)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    float *buf      = vChannels[i].vUpBuffer;
+                    dsp::move(buf, &buf[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
+                    dsp::fill_zero(&buf[LSP_DSP_RESAMPLING_RSV_SAMPLES], MOS_UP_BUFFER_SIZE);
+                }
+                nUpHead         = 0;
+            }
+
+            const size_t to_do  = lsp_min(samples, (MOS_UP_BUFFER_SIZE - nUpHead) / nRatio);
+
+            // Do oversampling for each channel
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                float *up       = &vChannels[i].vUpBuffer[nUpHead];
+                pUpFunc(up, &src[i][offset], to_do);
+                vUpPtr[i]       = up;
+            }
+
+            return to_do;
+        }
+
+        void MultiOversampler::downsample_block(float * const *dst, size_t offset, size_t samples)
+        {
+            const size_t count  = samples * nRatio;
+
+            if (nFirLength > 0)
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                    Oversampler::fir_downsample(&dst[i][offset], vChannels[i].vFirBuffer, vUpPtr[i], vFirKernel, nFirLength, nRatio, samples);
+            }
+            else
+            {
+                // Filter all channels at once, the lanes of the filter bank hold different channels
+                if ((bFilter) && (bLanes))
+                    sBank.process(vUpPtr, vUpPtr, count);
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    if ((bFilter) && (!bLanes))
+                        vChannels[i].sBank.process(vUpPtr[i], vUpPtr[i], count);
+                    pDownFunc(&dst[i][offset], vUpPtr[i], samples);
+                }
+            }
+
+            nUpHead        += count;
+        }
+
+        void MultiOversampler::process(float * const *dst, const float * const *src, size_t samples, IMultiOversamplerCallback *callback)
+        {
+            if (nRatio <= 1)
+            {
+                if (callback != NULL)
+                    callback->process(dst, src, nChannels, samples);
+                else
+                {
+                    for (size_t i=0; i<nChannels; ++i)
+                        dsp::copy(dst[i], src[i], samples);
+                }
+                return;
+            }
+
+            for (size_t offset=0; offset < samples; )
+            {
+                // Do oversampling
+                size_t to_do    = upsample_block(src, offset, samples - offset);
+
+                // Call handler
+                if (callback != NULL)
+                    callback->process(vUpPtr, vUpPtr, nChannels, to_do * nRatio);
+
+                // Do downsampling
+                downsample_block(dst, offset, to_do);
+                offset         += to_do;
+            }
+        }
+
+        void MultiOversampler::process(float * const *dst, const float * const *src, size_t samples, multi_oversampler_callback_t callback, void *arg)
+        {
+            if (nRatio <= 1)
+            {
+                if (callback != NULL)
+                    callback(dst, src, nChannels, samples, arg);
+                else
+                {
+                    for (size_t i=0; i<nChannels; ++i)
+                        dsp::copy(dst[i], src[i], samples);
+                }
+                return;
+            }
+
+            for (size_t offset=0; offset < samples; )
+            {
+                // Do oversampling
+                size_t to_do    = upsample_block(src, offset, samples - offset);
+
+                // Call handler
+                if (callback != NULL)
+                    callback(vUpPtr, vUpPtr, nChannels, to_do * nRatio, arg);
+
+                // Do downsampling
+                downsample_block(dst, offset, to_do);
+                offset         += to_do;
+            }
+        }
+
+        size_t MultiOversampler::latency() const
+        {
+            return (nFirLength > 0) ?
+                Oversampler::get_latency(nMode) + OVERSAMPLER_FIR_LATENCY :
+                Oversampler::get_latency(nMode);
+        }
+
+        void MultiOversampler::dump(IStateDumper *v) const
+        {
+            v->write("pCallback", pCallback);
+            v->write("pUpFunc", pUpFunc);
+            v->write("pDownFunc", pDownFunc);
+            v->write("nChannels", nChannels);
+            v->write("nRatio", nRatio);
+            v->write("nUpHead", nUpHead);
+            v->write("nMode", nMode);
+            v->write("nSampleRate", nSampleRate);
+            v->write("nUpdate", nUpdate);
+            v->write("nFilterType", nFilterType);
+            v->write("nFirLength", nFirLength);
+            v->write("vFirKernel", vFirKernel);
+            v->write_object("sFilter", &sFilter);
+            v->write_object("sFilterBank", &sFilterBank);
+            v->write_object("sBank", &sBank);
+            v->begin_array("vChannels", vChannels, nChannels);
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                {
+                    const channel_t *c = &vChannels[i];
+                    v->begin_object(c, sizeof(channel_t));
+                    {
+                        v->write_object("sBank", &c->sBank);
+                        v->write("vUpBuffer", c->vUpBuffer);
+                        v->write("vFirBuffer", c->vFirBuffer);
+                    }
+                    v->end_object();
+                }
+            }
+            v->end_array();
+            v->writev("vUpPtr", vUpPtr, nChannels);
+            v->write("pData", pData);
+            v->write("bFilter", bFilter);
+            v->write("bLanes", bLanes);
+        }
+
+    } /* namespace dspu */
+} /* namespace lsp */
@@ -0,0 +1,461 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp-units/util/MultiSidechain.h>
+#include <lsp-plug.in/dsp-units/units.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+namespace lsp
+{
+    namespace dspu
+    {
+        static constexpr size_t BLOCK_SIZE          = 0x200;
+        static constexpr size_t LPF_BLOCK_SIZE      = 0x40;
+
+        MultiSidechain::MultiSidechain()
+        {
+            construct();
+        }
+
+        MultiSidechain::~MultiSidechain()
+        {
+            destroy();
+        }
+
+        void MultiSidechain::construct()
+        {
+            vLanes              = NULL;
+            vTau                = NULL;
+            vValue              = NULL;
+            vTemp               = NULL;
+            nLanes              = 0;
+            nSampleRate         = 0;
+            nCapacity           = 0;
+            nMaxWindow          = 0;
+            nHead               = 0;
+            fMaxReactivity      = 0.0f;
+            nMode               = SCM_RMS;
+            nFlags              = MSF_UPDATE | MSF_CLEAR;
+            pData               = NULL;
+            pVarData            = NULL;
+        }
+
+        void MultiSidechain::destroy()
+        {
+            if (pVarData != NULL)
+            {
+                free_aligned(pVarData);
+                pVarData            = NULL;
+            }
+
+            if (pData != NULL)
+            {
+                free_aligned(pData);
+                pData               = NULL;
+            }
+
+            vLanes              = NULL;
+            vTau                = NULL;
+            vValue              = NULL;
+            vTemp               = NULL;
+            nLanes              = 0;
+        }
+
+        bool MultiSidechain::init(size_t lanes, float max_reactivity)
+        {
+            if (lanes <= 0)
+                return false;
+
+            destroy();
+
+            const size_t szof_lanes     = align_size(lanes * sizeof(lane_t), DEFAULT_ALIGN);
+            const size_t szof_values    = align_size(lanes * sizeof(float), DEFAULT_ALIGN);
+            const size_t szof_temp      = align_size(lanes * LPF_BLOCK_SIZE * sizeof(float), DEFAULT_ALIGN);
+            const size_t to_alloc       = szof_lanes + szof_values * 2 + szof_temp;
+
+            uint8_t *ptr                = alloc_aligned<uint8_t>(pData, to_alloc, DEFAULT_ALIGN);
+            if (ptr == NULL)
+                return false;
+
+            vLanes                      = advance_ptr_bytes<lane_t>(ptr, szof_lanes);
+            vTau                        = advance_ptr_bytes<float>(ptr, szof_values);
+            vValue                      = advance_ptr_bytes<float>(ptr, szof_values);
+            vTemp                       = advance_ptr_bytes<float>(ptr, szof_temp);
+
+            for (size_t i=0; i<lanes; ++i)
+            {
+                lane_t *l                   = &vLanes[i];
+
+                l->vHistory                 = NULL;
+                l->vSuffix                  = NULL;
+                l->fReactivity              = 0.0f;
+                l->fGain                    = 1.0f;
+                l->fSum                     = 0.0f;
+                l->nWindow                  = 1;
+                l->nPhase                   = 0;
+                l->nFlags                   = MSF_UPDATE;
+
+                vTau[i]                     = 0.0f;
+                vValue[i]                   = 0.0f;
+            }
+
+            nLanes                      = lanes;
+            nSampleRate                 = 0;
+            nCapacity                   = 0;
+            nMaxWindow                  = 0;
+            nHead                       = 0;
+            fMaxReactivity              = max_reactivity;
+            nMode                       = SCM_RMS;
+            nFlags                      = MSF_UPDATE | MSF_CLEAR;
+
+            return true;
+        }
+
+        bool MultiSidechain::set_sample_rate(size_t sr)
+        {
+            const size_t max_window     = lsp_max(millis_to_samples(sr, fMaxReactivity), 1);
+            const size_t capacity       = max_window + BLOCK_SIZE;
+            const size_t szof_history   = align_size(capacity * sizeof(float), DEFAULT_ALIGN);
+            const size_t szof_suffix    = align_size((max_window + 1) * sizeof(float), DEFAULT_ALIGN);
+            const size_t to_alloc       = (szof_history + szof_suffix) * nLanes;
+
+            uint8_t *ptr                = realloc_aligned<uint8_t>(pVarData, to_alloc, DEFAULT_ALIGN);
+            if (ptr == NULL)
+                return false;
+
+            for (size_t i=0; i<nLanes; ++i)
+            {
+                lane_t *l                   = &vLanes[i];
+                l->vHistory                 = advance_ptr_bytes<float>(ptr, szof_history);
+                l->vSuffix                  = advance_ptr_bytes<float>(ptr, szof_suffix);
+                l->nFlags                  |= MSF_UPDATE;
+            }
+
+            nSampleRate                 = sr;
+            nCapacity                   = capacity;
+            nMaxWindow                  = max_window;
+            nFlags                      = MSF_UPDATE | MSF_CLEAR;
+
+            return true;
+        }
+
+        void MultiSidechain::set_reactivity(size_t lane, float reactivity)
+        {
+            if (lane >= nLanes)
+                return;
+
+            lane_t *l               = &vLanes[lane];
+            if ((l->fReactivity == reactivity) ||
+                (reactivity < 0.0f) ||
+                (reactivity > fMaxReactivity))
+                return;
+
+            l->fReactivity          = reactivity;
+            l->nFlags              |= MSF_UPDATE;
+            nFlags                 |= MSF_UPDATE;
+        }
+
+        void MultiSidechain::set_reactivity(float reactivity)
+        {
+            for (size_t i=0; i<nLanes; ++i)
+                set_reactivity(i, reactivity);
+        }
+
+        void MultiSidechain::set_mode(sidechain_mode_t mode)
+        {
+            if (nMode == size_t(mode))
+                return;
+
+            // Windows should be re-computed from the history for the new mode
+            nMode                   = mode;
+            for (size_t i=0; i<nLanes; ++i)
+            {
+                vLanes[i].nFlags       |= MSF_UPDATE;
+                vValue[i]               = 0.0f;
+            }
+            nFlags                 |= MSF_UPDATE;
+        }
+
+        void MultiSidechain::set_gain(size_t lane, float gain)
+        {
+            if (lane < nLanes)
+                vLanes[lane].fGain      = gain;
+        }
+
+        float MultiSidechain::get_gain(size_t lane) const
+        {
+            return (lane < nLanes) ? vLanes[lane].fGain : 0.0f;
+        }
+
+        void MultiSidechain::clear()
+        {
+            nFlags                 |= MSF_CLEAR;
+        }
+
+        void MultiSidechain::update_settings()
+        {
+            if (!(nFlags & (MSF_UPDATE | MSF_CLEAR)))
+                return;
+
+            if (nFlags & MSF_CLEAR)
+            {
+                for (size_t i=0; i<nLanes; ++i)
+                {
+                    lane_t *l               = &vLanes[i];
+                    dsp::fill_zero(l->vHistory, nCapacity);
+                    dsp::fill_zero(l->vSuffix, nMaxWindow + 1);
+                    l->fSum                 = 0.0f;
+                    l->nPhase               = 0;
+                }
+                dsp::fill_zero(vValue, nLanes);
+                nHead                   = 0;
+            }
+
+            if (nFlags & MSF_UPDATE)
+            {
+                for (size_t i=0; i<nLanes; ++i)
+                {
+                    lane_t *l               = &vLanes[i];
+                    if (!(l->nFlags & MSF_UPDATE))
+                        continue;
+
+                    const size_t window     = lsp_max(millis_to_samples(nSampleRate, l->fReactivity), 1);
+                    l->nWindow              = uint32_t(lsp_min(window, nMaxWindow));
+                    vTau[i]                 = 1.0f - expf(logf(1.0f - M_SQRT1_2) / l->nWindow);
+                    l->nFlags              &= ~MSF_UPDATE;
+
+                    rebuild_window(l, nHead);
+                }
+            }
+
+            nFlags                 &= ~(MSF_UPDATE | MSF_CLEAR);
+        }
+
+        void MultiSidechain::rebuild_window(lane_t *l, size_t head)
+        {
+            // Compute suffix sums of the last window from the history, each sum is computed
+            // from scratch so the floating-point error does not accumulate between windows
+            const size_t window     = l->nWindow;
+            const float *h          = l->vHistory;
+            float *s                = l->vSuffix;
+            size_t pos              = (head > 0) ? head - 1 : nCapacity - 1;
+            float sum               = 0.0f;
+
+            s[window]               = 0.0f;
+            if (nMode == SCM_RMS)
+            {
+                for (size_t i=window; i > 0; )
+                {
+                    const float v           = h[pos];
+                    sum                    += v * v;
+                    s[--i]                  = sum;
+                    pos                     = (pos > 0) ? pos - 1 : nCapacity - 1;
+                }
+            }
+            else
+            {
+                for (size_t i=window; i > 0; )
+                {
+                    sum                    += h[pos];
+                    s[--i]                  = sum;
+                    pos                     = (pos > 0) ? pos - 1 : nCapacity - 1;
+                }
+            }
+
+            l->fSum                 = 0.0f;
+            l->nPhase               = 0;
+        }
+
+        void MultiSidechain::process_window(lane_t *l, float *dst, size_t count, size_t head)
+        {
+            // The window sum is the sum of the suffix of the previous window and the
+            // prefix of the current window. When the current window becomes full,
+            // it becomes the previous one.
+            const float interval    = 1.0f / float(l->nWindow);
+            const bool rms          = nMode == SCM_RMS;
+
+            for (size_t i=0; i<count; )
+            {
+                const size_t to_do      = lsp_min(count - i, size_t(l->nWindow - l->nPhase));
+                const float *s          = &l->vSuffix[l->nPhase + 1];
+                float *d                = &dst[i];
+                float sum               = l->fSum;
+
+                if (rms)
+                {
+                    for (size_t j=0; j<to_do; ++j)
+                    {
+                        sum                    += d[j] * d[j];
+                        d[j]                    = (s[j] + sum) * interval;
+                    }
+                }
+                else
+                {
+                    for (size_t j=0; j<to_do; ++j)
+                    {
+                        sum                    += d[j];
+                        d[j]                    = (s[j] + sum) * interval;
+                    }
+                }
+
+                i                      += to_do;
+                l->fSum                 = sum;
+                l->nPhase              += to_do;
+                if (l->nPhase >= l->nWindow)
+                    rebuild_window(l, (head + i) % nCapacity);
+            }
+
+            if (rms)
+                dsp::ssqrt1(dst, count);
+        }
+
+        void MultiSidechain::process_lpf(float * const *out, size_t offset, size_t samples)
+        {
+            float * const value     = vValue;
+            const float * const tau = vTau;
+
+            for (size_t off=0; off < samples; )
+            {
+                const size_t to_do      = lsp_min(samples - off, LPF_BLOCK_SIZE);
+
+                // Interleave the data of all lanes
+                for (size_t j=0; j<nLanes; ++j)
+                {
+                    const float *src        = &out[j][offset + off];
+                    float *t                = &vTemp[j];
+                    for (size_t i=0; i<to_do; ++i, t += nLanes)
+                        *t                      = src[i];
+                }
+
+                // Process all lanes in parallel
+                float *t                = vTemp;
+                for (size_t i=0; i<to_do; ++i, t += nLanes)
+                {
+                    for (size_t j=0; j<nLanes; ++j)
+                    {
+                        value[j]               += tau[j] * (t[j] - value[j]);
+                        t[j]                    = lsp_max(value[j], 0.0f);
+                    }
+                }
+
+                // De-interleave the data
+                for (size_t j=0; j<nLanes; ++j)
+                {
+                    float *dst              = &out[j][offset + off];
+                    const float *t          = &vTemp[j];
+                    for (size_t i=0; i<to_do; ++i, t += nLanes)
+                        dst[i]                  = *t;
+                }
+
+                off                    += to_do;
+            }
+        }
+
+        void MultiSidechain::process(float * const *out, const float * const *in, size_t samples)
+        {
+            // Check that sample rate has been set
+            if (pVarData == NULL)
+            {
+                for (size_t i=0; i<nLanes; ++i)
+                    dsp::fill_zero(out[i], samples);
+                return;
+            }
+
+            // Check if need update settings
+            update_settings();
+
+            for (size_t offset=0; offset < samples; )
+            {
+                const size_t to_do  = lsp_min(samples - offset, BLOCK_SIZE, nCapacity - nHead);
+
+                for (size_t i=0; i<nLanes; ++i)
+                {
+                    lane_t *l           = &vLanes[i];
+                    float *dst          = &out[i][offset];
+
+                    // Pre-process the signal and store it to the history
+                    if (in[i] != NULL)
+                    {
+                        dsp::abs2(dst, &in[i][offset], to_do);
+                        if (l->fGain != 1.0f)
+                            dsp::mul_k2(dst, l->fGain, to_do);
+                    }
+                    else
+                        dsp::fill_zero(dst, to_do);
+                    dsp::copy(&l->vHistory[nHead], dst, to_do);
+
+                    // Process the window function
+                    if ((nMode == SCM_RMS) || (nMode == SCM_UNIFORM))
+                        process_window(l, dst, to_do, nHead);
+                }
+
+                if (nMode == SCM_LPF)
+                    process_lpf(out, offset, to_do);
+
+                nHead               = (nHead + to_do) % nCapacity;
+                offset             += to_do;
+            }
+        }
+
+        void MultiSidechain::dump(IStateDumper *v) const
+        {
+            v->begin_array("vLanes", vLanes, nLanes);
+            {
+                for (size_t i=0; i<nLanes; ++i)
+                {
+                    const lane_t *l = &vLanes[i];
+
+                    v->begin_object(l, sizeof(lane_t));
+                    {
+                        v->write("vHistory", l->vHistory);
+                        v->write("vSuffix", l->vSuffix);
+                        v->write("fReactivity", l->fReactivity);
+                        v->write("fGain", l->fGain);
+                        v->write("fSum", l->fSum);
+                        v->write("nWindow", l->nWindow);
+                        v->write("nPhase", l->nPhase);
+                        v->write("nFlags", l->nFlags);
+                    }
+                    v->end_object();
+                }
+            }
+            v->end_array();
+
+            v->writev("vTau", vTau, nLanes);
+            v->writev("vValue", vValue, nLanes);
+            v->write("vTemp", vTemp);
+            v->write("nLanes", nLanes);
+            v->write("nSampleRate", nSampleRate);
+            v->write("nCapacity", nCapacity);
+            v->write("nMaxWindow", nMaxWindow);
+            v->write("nHead", nHead);
+            v->write("fMaxReactivity", fMaxReactivity);
+            v->write("nMode", nMode);
+            v->write("nFlags", nFlags);
+            v->write("pData", pData);
+            v->write("pVarData", pVarData);
+        }
+
+    } /* namespace dspu */
+} /* namespace lsp */
+
+
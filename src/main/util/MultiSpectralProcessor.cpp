@@ -28,6 +28,40 @@ namespace lsp
 {
     namespace dspu
     {
+        static constexpr size_t     JOB_SHIFT       = 24;       // Shift of the job type in the job word
+        static constexpr size_t     RANK_SHIFT      = 26;       // Shift of the FFT rank in the job word
+        static constexpr uatomic_t  JOB_INDEX       = (uatomic_t(1) << JOB_SHIFT) - 1;  // Mask of the channel index in the job word
+        static constexpr uatomic_t  JOB_TYPE        = 0x3;      // Mask of the job type in the job word
+
+        MultiSpectralProcessor::FrameWorker::FrameWorker(MultiSpectralProcessor *proc)
+        {
+            pProc               = proc;
+        }
+
+        MultiSpectralProcessor::FrameWorker::~FrameWorker()
+        {
+            pProc               = NULL;
+        }
+
+        status_t MultiSpectralProcessor::FrameWorker::run()
+        {
+            // Initialize DSP context
+            dsp::context_t ctx;
+            dsp::start(&ctx);
+
+            while (!ipc::Thread::is_cancelled())
+            {
+                // Sleep until the job is submitted or the thread is cancelled, then take part in the job
+                pProc->pSignal->wait();
+                while (pProc->run_job())
+                    /* nothing */ ;
+            }
+
+            // Finalize DSP context and return result
+            dsp::finish(&ctx);
+            return STATUS_OK;
+        }
+
         MultiSpectralProcessor::MultiSpectralProcessor()
         {
             construct();
@@ -46,6 +80,7 @@ namespace lsp
             nOffset         = 0;
             vChannels       = NULL;
             vFftBuf         = NULL;
+            vXfBuf          = NULL;
             pWnd            = NULL;
             fPhase          = 0.0f;
             bUpdate         = true;
@@ -53,13 +88,50 @@ namespace lsp
             pFunc           = NULL;
             pObject         = NULL;
             pSubject        = NULL;
+            pXfFunc         = NULL;
+            pXfObject       = NULL;
+
+            for (size_t i=0; i<MULTI_SPECTRAL_MAX_WORKERS; ++i)
+                vWorkers[i]     = NULL;
+            nWorkers        = 0;
+            pSignal         = NULL;
+            nJob            = JOB_NONE;
 
             pData           = NULL;
         }
 
-        bool MultiSpectralProcessor::init(size_t channels, size_t max_rank)
+        void MultiSpectralProcessor::stop_workers()
         {
-            if (channels <= 0)
+            for (size_t i=0; i<nWorkers; ++i)
+                vWorkers[i]->cancel();
+            if (nWorkers > 0)
+                pSignal->post(nWorkers);
+
+            for (size_t i=0; i<nWorkers; ++i)
+            {
+                FrameWorker *w  = vWorkers[i];
+                w->join();
+                delete w;
+                vWorkers[i]     = NULL;
+            }
+
+            if (pSignal != NULL)
+            {
+                delete pSignal;
+                pSignal         = NULL;
+            }
+
+            // All job buffers are released now
+            for (size_t i=0; i<nChannels; ++i)
+                vChannels[i].nState     = CS_IDLE;
+
+            nWorkers        = 0;
+            nJob            = JOB_NONE;
+        }
+
+        bool MultiSpectralProcessor::init(size_t channels, size_t max_rank, size_t workers)
+        {
+            if ((channels <= 0) || (channels > JOB_INDEX))
                 return false;
 
             const size_t szof_channels  = align_size(sizeof(channel_t) * channels, DEFAULT_ALIGN);
@@ -67,7 +139,8 @@ namespace lsp
             const size_t szof_buf       = sizeof(float) << max_rank;
             const size_t szof_wnd       = szof_buf;
             const size_t szof_fft_buf   = szof_buf * 2;
-            const size_t to_alloc       = szof_channels + szof_vfft + szof_wnd + (szof_buf * 2 + szof_fft_buf) * channels;
+            const size_t szof_job_buf   = (workers > 0) ? szof_fft_buf : 0;
+            const size_t to_alloc       = szof_channels + szof_vfft * 2 + szof_wnd + (szof_buf * 2 + szof_fft_buf + szof_job_buf) * channels;
 
             uint8_t *data               = NULL;
             uint8_t *ptr                = alloc_aligned<uint8_t>(data, to_alloc);
@@ -75,12 +148,14 @@ namespace lsp
                 return false;
 
 
+            stop_workers();
             if (pData != NULL)
             {
                 free_aligned(pData);
 
                 pWnd            = NULL;
                 vFftBuf         = NULL;
+                vXfBuf          = NULL;
                 vChannels       = NULL;
             }
 
@@ -91,6 +166,7 @@ namespace lsp
 
             vChannels       = advance_ptr_bytes<channel_t>(ptr, szof_channels);
             vFftBuf         = advance_ptr_bytes<float *>(ptr, szof_vfft);
+            vXfBuf          = advance_ptr_bytes<float *>(ptr, szof_vfft);
             pWnd            = advance_ptr_bytes<float>(ptr, szof_wnd);
 
             // Initialize channels
@@ -104,11 +180,20 @@ namespace lsp
                 c->pInBuf       = advance_ptr_bytes<float>(ptr, szof_buf);
                 c->pOutBuf      = advance_ptr_bytes<float>(ptr, szof_buf);
                 c->pFftBuf      = advance_ptr_bytes<float>(ptr, szof_fft_buf);
+                c->pResult      = NULL;
+                c->nState       = CS_IDLE;
             }
 
+            // Job buffers follow the channel buffers and do not move when the rank changes
+            for (size_t i=0; i<channels; ++i)
+                vChannels[i].pJobBuf    = (szof_job_buf > 0) ? advance_ptr_bytes<float>(ptr, szof_job_buf) : NULL;
+
             // Initialize FFT pointers
-            for (size_t i=0; i < (szof_vfft/sizeof(float)); ++i)
+            for (size_t i=0; i<channels; ++i)
+            {
                 vFftBuf[i]          = NULL;
+                vXfBuf[i]           = NULL;
+            }
 
             // Initialize window
             fPhase          = 0.0f;
@@ -117,14 +202,41 @@ namespace lsp
             pFunc           = NULL;
             pObject         = NULL;
             pSubject        = NULL;
+            pXfFunc         = NULL;
+            pXfObject       = NULL;
 
             pData           = data;
 
+            // Launch worker threads, the caller thread processes all channels if they can not be launched
+            if (workers > 0)
+            {
+                pSignal         = new Semaphore();
+                if ((pSignal != NULL) && (!pSignal->valid()))
+                {
+                    delete pSignal;
+                    pSignal         = NULL;
+                }
+            }
+
+            for (size_t i=0, n=(pSignal != NULL) ? lsp_min(workers, MULTI_SPECTRAL_MAX_WORKERS) : 0; i<n; ++i)
+            {
+                FrameWorker *w  = new FrameWorker(this);
+                if (w == NULL)
+                    break;
+                if (w->start() != STATUS_OK)
+                {
+                    delete w;
+                    break;
+                }
+                vWorkers[nWorkers++]    = w;
+            }
+
             return true;
         }
 
         void MultiSpectralProcessor::destroy()
         {
+            stop_workers();
             if (pData != NULL)
                 free_aligned(pData);
 
@@ -135,12 +247,15 @@ namespace lsp
             fPhase          = 0.0f;
             vChannels       = NULL;
             vFftBuf         = NULL;
+            vXfBuf          = NULL;
             pWnd            = NULL;
             bUpdate         = true;
 
             pFunc           = NULL;
             pObject         = NULL;
             pSubject        = NULL;
+            pXfFunc         = NULL;
+            pXfObject       = NULL;
         }
 
         void MultiSpectralProcessor::bind_handler(multi_spectral_processor_func_t func, void *object, void *subject)
@@ -157,6 +272,18 @@ namespace lsp
             pSubject        = NULL;
         }
 
+        void MultiSpectralProcessor::bind_transform(multi_spectral_transform_func_t func, void *object)
+        {
+            pXfFunc         = func;
+            pXfObject       = object;
+        }
+
+        void MultiSpectralProcessor::unbind_transform()
+        {
+            pXfFunc         = NULL;
+            pXfObject       = NULL;
+        }
+
         status_t MultiSpectralProcessor::bind(size_t index, float *out, const float *in)
         {
             if (pData == NULL)
@@ -285,6 +412,261 @@ namespace lsp
             bUpdate         = true;
         }
 
+        void MultiSpectralProcessor::apply_frame(channel_t *c, const float *src)
+        {
+            const size_t buf_size       = 1 << nRank;
+            const size_t frame_size     = 1 << (nRank - 1);
+
+            dsp::move(c->pOutBuf, &c->pOutBuf[frame_size], frame_size);             // Shift output buffer
+            dsp::fill_zero(&c->pOutBuf[frame_size], frame_size);                    // Fill tail of input buffer with zeros
+            dsp::fmadd3(c->pOutBuf, src, pWnd, buf_size);                           // Apply cosine window (-> squared cosine) and add to the output buffer
+            dsp::move(c->pInBuf, &c->pInBuf[frame_size], frame_size);               // Shift input buffer
+        }
+
+        void MultiSpectralProcessor::process_channel(job_t job, size_t index)
+        {
+            const size_t buf_size       = 1 << nRank;
+            channel_t *c                = &vChannels[index];
+
+            if (job == JOB_DIRECT)
+            {
+                if (c->pIn != NULL)
+                {
+                    // Perform FFT and processing
+                    dsp::mul3(&c->pFftBuf[buf_size], c->pInBuf, pWnd, buf_size);        // Apply cosine window before transform
+                    dsp::pcomplex_r2c(c->pFftBuf, &c->pFftBuf[buf_size], buf_size);     // Convert from real to packed complex
+                    if (pXfFunc == NULL)
+                        dsp::packed_direct_fft(c->pFftBuf, c->pFftBuf, nRank);          // Perform direct FFT
+                    vFftBuf[index]  = c->pFftBuf;
+                }
+                else
+                {
+                    dsp::mul3(c->pFftBuf, c->pInBuf, pWnd, buf_size);                   // Copy data to FFT buffer
+                    vFftBuf[index]  = NULL;
+                }
+            }
+            else
+            {
+                if ((c->pIn != NULL) && (c->pOut != NULL))
+                {
+                    if (pXfFunc == NULL)
+                        dsp::packed_reverse_fft(c->pFftBuf, c->pFftBuf, nRank);         // Perform reverse FFT
+                    dsp::pcomplex_c2r(c->pFftBuf, c->pFftBuf, buf_size);                // Unpack complex numbers
+                }
+
+                apply_frame(c, c->pFftBuf);
+            }
+        }
+
+        void MultiSpectralProcessor::transform_buffer(job_t job, float *buf, size_t rank)
+        {
+            const size_t buf_size       = 1 << rank;
+
+            if (job == JOB_DIRECT)
+            {
+                dsp::pcomplex_r2c(buf, &buf[buf_size], buf_size);                       // Convert windowed data to packed complex
+                dsp::packed_direct_fft(buf, buf, rank);                                 // Perform direct FFT
+            }
+            else
+            {
+                dsp::packed_reverse_fft(buf, buf, rank);                                // Perform reverse FFT
+                dsp::pcomplex_c2r(buf, buf, buf_size);                                  // Unpack complex numbers
+            }
+        }
+
+        uatomic_t MultiSpectralProcessor::make_job(job_t type, size_t rank, size_t index)
+        {
+            return (uatomic_t(rank) << RANK_SHIFT) | (uatomic_t(type) << JOB_SHIFT) | uatomic_t(index);
+        }
+
+        bool MultiSpectralProcessor::claim_job(uatomic_t *job)
+        {
+            // Fetch the job type and the channel index at once, so the channel
+            // can never be processed with the type of the previous job
+            while (true)
+            {
+                const uatomic_t value   = atomic_load(&nJob);
+                const size_t type       = (value >> JOB_SHIFT) & JOB_TYPE;
+                if ((type == JOB_NONE) || ((value & JOB_INDEX) >= nChannels))
+                    return false;
+                if (atomic_cas(&nJob, value, value + 1))
+                {
+                    *job                    = value;
+                    return true;
+                }
+            }
+        }
+
+        void MultiSpectralProcessor::process_job(uatomic_t job)
+        {
+            // The channel may be already taken by the caller thread
+            channel_t *c            = &vChannels[job & JOB_INDEX];
+            if (!atomic_cas(&c->nState, CS_PENDING, CS_BUSY))
+                return;
+
+            // The worker may have been preempted between claiming the channel and taking it.
+            // Meanwhile the caller thread could complete the pass and submit the channel to
+            // the next one, so return the channel back if the current job differs by type or rank
+            if ((atomic_load(&nJob) ^ job) & ~JOB_INDEX)
+            {
+                if (!atomic_cas(&c->nState, CS_BUSY, CS_PENDING))
+                    atomic_store(&c->nState, CS_IDLE);
+                return;
+            }
+
+            // The worker touches only the job buffer, the rank is taken from the job word
+            transform_buffer(job_t((job >> JOB_SHIFT) & JOB_TYPE), c->pJobBuf, job >> RANK_SHIFT);
+
+            // Release the job buffer if the caller thread has taken over the job
+            if (!atomic_cas(&c->nState, CS_BUSY, CS_DONE))
+                atomic_store(&c->nState, CS_IDLE);
+        }
+
+        bool MultiSpectralProcessor::run_job()
+        {
+            uatomic_t job;
+            if (!claim_job(&job))
+                return false;
+
+            process_job(job);
+            return true;
+        }
+
+        void MultiSpectralProcessor::execute(job_t job)
+        {
+            // The batched transform is performed by the caller thread for all channels at once
+            if ((nWorkers <= 0) || (pXfFunc != NULL))
+            {
+                for (size_t i=0; i<nChannels; ++i)
+                    process_channel(job, i);
+                return;
+            }
+
+            execute_parallel(job);
+        }
+
+        void MultiSpectralProcessor::execute_parallel(job_t job)
+        {
+            const size_t buf_size       = 1 << nRank;
+            const size_t fft_size       = buf_size * 2;
+            size_t pending              = 0;
+
+            // Prepare the data of the job: windowing of the input data and copying of the
+            // spectrum are cheap and are done in the caller thread, so both the job buffer
+            // and the own buffer of the channel hold the source data of the transform
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c                = &vChannels[i];
+                float *src                  = vFftBuf[i];
+                c->pResult                  = c->pFftBuf;
+
+                if (job == JOB_DIRECT)
+                {
+                    if (c->pIn == NULL)
+                    {
+                        dsp::mul3(c->pFftBuf, c->pInBuf, pWnd, buf_size);                   // Copy data to FFT buffer
+                        vFftBuf[i]                  = NULL;
+                        continue;
+                    }
+                    if (atomic_load(&c->nState) != CS_IDLE)
+                    {
+                        // The job buffer is still owned by the worker, process the channel immediately
+                        dsp::mul3(&c->pFftBuf[buf_size], c->pInBuf, pWnd, buf_size);
+                        transform_buffer(job, c->pFftBuf, nRank);
+                        continue;
+                    }
+
+                    dsp::mul3(&c->pJobBuf[buf_size], c->pInBuf, pWnd, buf_size);            // Apply cosine window before transform
+                }
+                else
+                {
+                    if ((c->pIn == NULL) || (c->pOut == NULL))
+                    {
+                        if (src != NULL)
+                            c->pResult                  = src;
+                        continue;
+                    }
+                    if (src != c->pFftBuf)
+                        dsp::copy(c->pFftBuf, src, fft_size);
+                    if (atomic_load(&c->nState) != CS_IDLE)
+                    {
+                        // The job buffer is still owned by the worker, process the channel immediately
+                        transform_buffer(job, c->pFftBuf, nRank);
+                        continue;
+                    }
+
+                    dsp::copy(c->pJobBuf, c->pFftBuf, fft_size);
+                }
+
+                c->pResult                  = c->pJobBuf;
+                atomic_store(&c->nState, CS_PENDING);
+                ++pending;
+            }
+
+            // Wake up the workers, they take the channels starting with the first one
+            if (pending > 0)
+            {
+                atomic_store(&nJob, make_job(job, nRank, 0));
+                pSignal->post(nWorkers);
+            }
+
+            // Process the channels starting with the last one. After meeting with the workers,
+            // take over the channels which are still processed by them, starting with the latest
+            // taken, so the caller thread never waits for the worker threads
+            for (size_t i=nChannels; (pending > 0) && (i > 0); )
+            {
+                channel_t *c                = &vChannels[--i];
+                if (c->pResult != c->pJobBuf)
+                    continue;   // Channel has not been submitted in this pass
+                if (atomic_cas(&c->nState, CS_PENDING, CS_IDLE))
+                    transform_buffer(job, c->pJobBuf, nRank);
+                else if (atomic_cas(&c->nState, CS_BUSY, CS_STOLEN))
+                {
+                    if (job == JOB_DIRECT)
+                        dsp::mul3(&c->pFftBuf[buf_size], c->pInBuf, pWnd, buf_size);
+                    transform_buffer(job, c->pFftBuf, nRank);
+                    c->pResult                  = c->pFftBuf;
+                }
+            }
+            atomic_store(&nJob, JOB_NONE);
+
+            // Collect the results
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c                = &vChannels[i];
+                atomic_cas(&c->nState, CS_DONE, CS_IDLE);
+
+                if (job == JOB_DIRECT)
+                {
+                    if (c->pIn != NULL)
+                        vFftBuf[i]                  = c->pResult;
+                }
+                else
+                    apply_frame(c, c->pResult);
+            }
+        }
+
+        void MultiSpectralProcessor::transform(job_t job)
+        {
+            if (pXfFunc == NULL)
+                return;
+
+            // Collect the list of buffers to transform
+            size_t count = 0;
+            for (size_t i=0; i<nChannels; ++i)
+            {
+                channel_t *c = &vChannels[i];
+                if (c->pIn == NULL)
+                    continue;
+                if ((job == JOB_REVERSE) && (c->pOut == NULL))
+                    continue;
+                vXfBuf[count++] = c->pFftBuf;
+            }
+
+            if (count > 0)
+                pXfFunc(pXfObject, vXfBuf, count, nRank, job == JOB_REVERSE);
+        }
+
         void MultiSpectralProcessor::process(size_t count)
         {
             // Check if we need to commit new settings
@@ -330,62 +712,24 @@ namespace lsp
                 {
                     if (pFunc != NULL)
                     {
-                        // Perform direct FFT
-                        for (size_t i=0; i<nChannels; ++i)
-                        {
-                            channel_t *c = &vChannels[i];
-
-                            if (c->pIn != NULL)
-                            {
-                                // Perform FFT and processing
-                                dsp::mul3(&c->pFftBuf[buf_size], c->pInBuf, pWnd, buf_size);        // Apply cosine window before transform
-                                dsp::pcomplex_r2c(c->pFftBuf, &c->pFftBuf[buf_size], buf_size);     // Convert from real to packed complex
-                                dsp::packed_direct_fft(c->pFftBuf, c->pFftBuf, nRank);              // Perform direct FFT
-                                vFftBuf[i]      = c->pFftBuf;
-                            }
-                            else
-                            {
-                                dsp::mul3(c->pFftBuf, c->pInBuf, pWnd, buf_size);                   // Copy data to FFT buffer
-                                vFftBuf[i]      = NULL;
-                            }
-                        }
-
-                        // Call the function
-                        pFunc(pObject, pSubject, vFftBuf, nRank);                           // Call the function
-
-                        // Perform reverse FFT
-                        for (size_t i=0; i<nChannels; ++i)
-                        {
-                            channel_t *c = &vChannels[i];
-
-                            if ((c->pIn != NULL) && (c->pOut != NULL))
-                            {
-                                dsp::packed_reverse_fft(c->pFftBuf, c->pFftBuf, nRank);             // Perform reverse FFT
-                                dsp::pcomplex_c2r(c->pFftBuf, c->pFftBuf, buf_size);                // Unpack complex numbers
-                            }
-                        }
+                        // Perform direct FFT, call the function and perform reverse FFT
+                        execute(JOB_DIRECT);
+                        transform(JOB_DIRECT);
+                        pFunc(pObject, pSubject, vFftBuf, nRank);
+                        transform(JOB_REVERSE);
+                        execute(JOB_REVERSE);
                     }
                     else
                     {
-                        // Copy data of input buffer to FFT buffer
+                        // Copy data of input buffer to FFT buffer and apply signal to buffers
                         for (size_t i=0; i<nChannels; ++i)
                         {
                             channel_t *c = &vChannels[i];
                             dsp::mul3(c->pFftBuf, c->pInBuf, pWnd, buf_size);
+                            apply_frame(c, c->pFftBuf);
                         }
                     }
 
-                    // Apply signal to buffers
-                    for (size_t i=0; i<nChannels; ++i)
-                    {
-                        channel_t *c = &vChannels[i];
-                        dsp::move(c->pOutBuf, &c->pOutBuf[frame_size], frame_size);             // Shift output buffer
-                        dsp::fill_zero(&c->pOutBuf[frame_size], frame_size);                    // Fill tail of input buffer with zeros
-                        dsp::fmadd3(c->pOutBuf, c->pFftBuf, pWnd, buf_size);                    // Apply cosine window (-> squared cosine) and add to the output buffer
-                        dsp::move(c->pInBuf, &c->pInBuf[frame_size], frame_size);               // Shift input buffer
-                        dsp::move(c->pInBuf, c->pInBuf, frame_size);               // Shift input buffer
-                    }
-
                     // Reset read/write offset
                     nOffset     = 0;
                 }
@@ -426,11 +770,15 @@ namespace lsp
                     v->write("pInBuf", c->pInBuf);
                     v->write("pOutBuf", c->pOutBuf);
                     v->write("pFftBuf", c->pFftBuf);
+                    v->write("pJobBuf", c->pJobBuf);
+                    v->write("pResult", c->pResult);
+                    v->write("nState", int(c->nState));
                 }
             }
             v->end_array();
 
             v->writev("vFftBuf", vFftBuf, nChannels);
+            v->writev("vXfBuf", vXfBuf, nChannels);
             v->write("pWnd", pWnd);
             v->write("fPhase", fPhase);
             v->write("bUpdate", bUpdate);
@@ -438,6 +786,13 @@ namespace lsp
             v->write("pFunc", pFunc);
             v->write("pObject", pObject);
             v->write("pSubject", pSubject);
+            v->write("pXfFunc", pXfFunc);
+            v->write("pXfObject", pXfObject);
+
+            v->writev("vWorkers", vWorkers, MULTI_SPECTRAL_MAX_WORKERS);
+            v->write("nWorkers", nWorkers);
+            v->write("pSignal", pSignal);
+            v->write("nJob", nJob);
 
             v->write("pData", pData);
         }
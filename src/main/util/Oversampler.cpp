@@ -22,10 +22,15 @@
 #include <lsp-plug.in/dsp-units/util/Oversampler.h>
 #include <lsp-plug.in/common/alloc.h>
 #include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
 
 #define OS_UP_BUFFER_SIZE       (12 * 1024)   /* Multiple of 3 and 4 */
 #define OS_DOWN_BUFFER_SIZE     (12 * 1024)   /* Multiple of 3 and 4 */
+#define OS_FIR_BUFFER_SIZE      (12 * 1024)   /* Multiple of 3 and 4 */
 #define OS_CUTOFF               20000.0f
+#define OS_FIR_PASS_BAND        0.42f         /* Upper frequency of the FIR filter pass band relative to the sample rate */
+#define OS_FIR_STOP_BAND        0.58f         /* Lower frequency of the FIR filter stop band relative to the sample rate */
+#define OS_FIR_KAISER_BETA      8.0f          /* Kaiser window parameter, gives 80 dB of stop band attenuation */
 
 namespace lsp
 {
@@ -40,6 +45,27 @@ namespace lsp
             dsp::copy(out, in, samples);
         }
 
+        /**
+         * Compute the modified Bessel function of the first kind of order zero
+         * @param x argument
+         * @return value of the function
+         */
+        static float bessel_i0(float x)
+        {
+            const double hx = 0.5 * x;
+            double sum      = 1.0;
+            double term     = 1.0;
+            for (size_t k=1; k<64; ++k)
+            {
+                const double v  = hx / k;
+                term           *= v * v;
+                sum            += term;
+                if (term < sum * 1e-12)
+                    break;
+            }
+            return sum;
+        }
+
         Oversampler::Oversampler()
         {
             construct();
@@ -55,9 +81,16 @@ namespace lsp
             pCallback       = NULL;
             fUpBuffer       = NULL;
             fDownBuffer     = NULL;
+            vFirKernel      = NULL;
+            vFirBuffer      = NULL;
             pFunc           = dsp::copy;
+            pDownFunc       = dsp::copy;
+            pDecimate       = decimate_iir;
             nUpHead         = 0;
+            nRatio          = 1;
             nMode           = OM_NONE;
+            nFilterType     = OF_IIR;
+            nFirLength      = 0;
             nSampleRate     = 0;
             nUpdate         = UP_ALL;
 
@@ -74,12 +107,19 @@ namespace lsp
 
             if (bData == NULL)
             {
-                size_t samples  = OS_UP_BUFFER_SIZE + OS_DOWN_BUFFER_SIZE + LSP_DSP_RESAMPLING_RSV_SAMPLES;
+                const size_t szof_kernel    = align_size(OVERSAMPLER_FIR_MAX_LENGTH, DEFAULT_ALIGN);
+                const size_t szof_fir       = align_size(fir_buffer_size(), DEFAULT_ALIGN);
+                size_t samples  = OS_UP_BUFFER_SIZE + OS_DOWN_BUFFER_SIZE + LSP_DSP_RESAMPLING_RSV_SAMPLES +
+                                  szof_kernel + szof_fir;
                 float *ptr      = alloc_aligned<float>(bData, samples, DEFAULT_ALIGN);
                 if (ptr == NULL)
                     return false;
                 fDownBuffer     = ptr;
                 ptr            += OS_DOWN_BUFFER_SIZE;
+                vFirKernel      = ptr;
+                ptr            += szof_kernel;
+                vFirBuffer      = ptr;
+                ptr            += szof_fir;
                 fUpBuffer       = reinterpret_cast<float *>(ptr);
                 ptr            += OS_UP_BUFFER_SIZE + LSP_DSP_RESAMPLING_RSV_SAMPLES;
             }
@@ -87,7 +127,10 @@ namespace lsp
             // Clear buffer
             dsp::fill_zero(fUpBuffer, OS_UP_BUFFER_SIZE + LSP_DSP_RESAMPLING_RSV_SAMPLES);
             dsp::fill_zero(fDownBuffer, OS_DOWN_BUFFER_SIZE);
+            dsp::fill_zero(vFirBuffer, fir_buffer_size());
             nUpHead       = 0;
+            nFirLength    = 0;
+            nUpdate      |= UP_MODE;
 
             return true;
         }
@@ -100,6 +143,8 @@ namespace lsp
                 free_aligned(bData);
                 fUpBuffer   = NULL;
                 fDownBuffer = NULL;
+                vFirKernel  = NULL;
+                vFirBuffer  = NULL;
                 bData       = NULL;
             }
             pCallback = NULL;
@@ -132,6 +177,19 @@ namespace lsp
                 dsp::fill_zero(fUpBuffer, OS_UP_BUFFER_SIZE + LSP_DSP_RESAMPLING_RSV_SAMPLES);
                 nUpHead       = 0;
                 sFilter.clear();
+
+                // Update the FIR filter
+                dsp::fill_zero(vFirBuffer, fir_buffer_size());
+                nFirLength    = ((bFilter) && (nFilterType == OF_FIR_LINEAR)) ?
+                                build_fir_kernel(vFirKernel, nRatio) : 0;
+
+                // Select the decimation routine
+                if (nFirLength > 0)
+                    pDecimate     = decimate_fir;
+                else if (bFilter)
+                    pDecimate     = decimate_iir;
+                else
+                    pDecimate     = decimate_plain;
             }
 
             size_t os       = get_oversampling();
@@ -145,7 +203,12 @@ namespace lsp
 
         size_t Oversampler::get_oversampling() const
         {
-            switch (nMode)
+            return nRatio;
+        }
+
+        size_t Oversampler::get_ratio(size_t mode)
+        {
+            switch (mode)
             {
                 case OM_LANCZOS_2X2:
                 case OM_LANCZOS_2X3:
@@ -194,767 +257,160 @@ namespace lsp
             return 1;
         }
 
-        void Oversampler::upsample(float *dst, const float *src, size_t samples)
+        void Oversampler::check_up_buffer()
         {
-            switch (nMode)
-            {
-                case OM_LANCZOS_2X2:
-                case OM_LANCZOS_2X3:
-                case OM_LANCZOS_2X4:
-                case OM_LANCZOS_2X12BIT:
-                case OM_LANCZOS_2X16BIT:
-                case OM_LANCZOS_2X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) >> 1);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-                        dsp::copy(dst, &fUpBuffer[nUpHead], to_do << 1);
-
-                        // Update pointers
-                        nUpHead        += to_do << 1;
-                        dst            += to_do << 1;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
+            // Check that there is enough space in buffer
+            if (nUpHead < OS_UP_BUFFER_SIZE)
+                return;
 
-                case OM_LANCZOS_3X2:
-                case OM_LANCZOS_3X3:
-                case OM_LANCZOS_3X4:
-                case OM_LANCZOS_3X12BIT:
-                case OM_LANCZOS_3X16BIT:
-                case OM_LANCZOS_3X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) / 3);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-                        dsp::copy(dst, &fUpBuffer[nUpHead], to_do * 3);
-
-                        // Update pointers
-                        nUpHead        += to_do * 3;
-                        dst            += to_do * 3;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
+            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
+            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
+            nUpHead         = 0;
+        }
 
-                case OM_LANCZOS_4X2:
-                case OM_LANCZOS_4X3:
-                case OM_LANCZOS_4X4:
-                case OM_LANCZOS_4X12BIT:
-                case OM_LANCZOS_4X16BIT:
-                case OM_LANCZOS_4X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) >> 2);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-                        dsp::copy(dst, &fUpBuffer[nUpHead], to_do << 2);
-
-                        // Update pointers
-                        nUpHead        += to_do << 2;
-                        dst            += to_do << 2;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
+        void Oversampler::upsample(float *dst, const float *src, size_t samples)
+        {
+            if (nRatio <= 1)
+            {
+                dsp::copy(dst, src, samples);
+                return;
+            }
 
-                case OM_LANCZOS_6X2:
-                case OM_LANCZOS_6X3:
-                case OM_LANCZOS_6X4:
-                case OM_LANCZOS_6X12BIT:
-                case OM_LANCZOS_6X16BIT:
-                case OM_LANCZOS_6X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) / 6);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-                        dsp::copy(dst, &fUpBuffer[nUpHead], to_do * 6);
-
-                        // Update pointers
-                        nUpHead        += to_do * 6;
-                        dst            += to_do * 6;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
+            while (samples > 0)
+            {
+                check_up_buffer();
+                const size_t to_do  = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) / nRatio);
+                const size_t count  = to_do * nRatio;
+
+                // Do oversampling
+                pFunc(&fUpBuffer[nUpHead], src, to_do);
+                dsp::copy(dst, &fUpBuffer[nUpHead], count);
+
+                // Update pointers
+                nUpHead        += count;
+                dst            += count;
+                src            += to_do;
+                samples        -= to_do;
+            }
+        }
 
-                case OM_LANCZOS_8X2:
-                case OM_LANCZOS_8X3:
-                case OM_LANCZOS_8X4:
-                case OM_LANCZOS_8X12BIT:
-                case OM_LANCZOS_8X16BIT:
-                case OM_LANCZOS_8X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) >> 3);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-                        dsp::copy(dst, &fUpBuffer[nUpHead], to_do << 3);
-
-                        // Update pointers
-                        nUpHead        += to_do << 3;
-                        dst            += to_do << 3;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
+        void Oversampler::decimate_plain(Oversampler *self, float *dst, const float *src, size_t samples)
+        {
+            self->pDownFunc(dst, src, samples);
+        }
 
+        void Oversampler::decimate_iir(Oversampler *self, float *dst, const float *src, size_t samples)
+        {
+            self->sFilter.process(self->fDownBuffer, src, samples * self->nRatio);
+            self->pDownFunc(dst, self->fDownBuffer, samples);
+        }
 
-                case OM_NONE:
-                default:
-                    dsp::copy(dst, src, samples);
-                    break;
-            }
+        void Oversampler::decimate_fir(Oversampler *self, float *dst, const float *src, size_t samples)
+        {
+            fir_downsample(dst, self->vFirBuffer, src, self->vFirKernel, self->nFirLength, self->nRatio, samples);
         }
 
         void Oversampler::downsample(float *dst, const float *src, size_t samples)
         {
-            switch (nMode)
+            if (nRatio <= 1)
             {
-                case OM_LANCZOS_2X2:
-                case OM_LANCZOS_2X3:
-                case OM_LANCZOS_2X4:
-                case OM_LANCZOS_2X12BIT:
-                case OM_LANCZOS_2X16BIT:
-                case OM_LANCZOS_2X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Perform filtering
-                        size_t can_do   = OS_DOWN_BUFFER_SIZE >> 1;
-                        size_t to_do    = lsp_min(samples, can_do);
-
-                        if (bFilter)
-                        {
-                            sFilter.process(fDownBuffer, src, to_do << 1);
-                            dsp::downsample_2x(dst, fDownBuffer, to_do);
-                        }
-                        else
-                            dsp::downsample_2x(dst, src, to_do);
-
-                        // Update pointers
-                        src            += to_do << 1;
-                        dst            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
-
-                case OM_LANCZOS_3X2:
-                case OM_LANCZOS_3X3:
-                case OM_LANCZOS_3X4:
-                case OM_LANCZOS_3X12BIT:
-                case OM_LANCZOS_3X16BIT:
-                case OM_LANCZOS_3X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Perform filtering
-                        size_t can_do   = OS_DOWN_BUFFER_SIZE / 3;
-                        size_t to_do    = lsp_min(samples, can_do);
-
-                        if (bFilter)
-                        {
-                            sFilter.process(fDownBuffer, src, to_do * 3);
-                            dsp::downsample_3x(dst, fDownBuffer, to_do);
-                        }
-                        else
-                            dsp::downsample_3x(dst, src, to_do);
-
-                        // Update pointers
-                        src            += to_do * 3;
-                        dst            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
-
-                case OM_LANCZOS_4X2:
-                case OM_LANCZOS_4X3:
-                case OM_LANCZOS_4X4:
-                case OM_LANCZOS_4X12BIT:
-                case OM_LANCZOS_4X16BIT:
-                case OM_LANCZOS_4X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Perform filtering
-                        size_t can_do   = OS_DOWN_BUFFER_SIZE >> 2;
-                        size_t to_do    = lsp_min(samples, can_do);
-
-                        if (bFilter)
-                        {
-                            sFilter.process(fDownBuffer, src, to_do << 2);
-                            dsp::downsample_4x(dst, fDownBuffer, to_do);
-                        }
-                        else
-                            dsp::downsample_4x(dst, src, to_do);
-
-                        // Update pointers
-                        src            += to_do << 2;
-                        dst            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
+                dsp::copy(dst, src, samples);
+                return;
+            }
 
-                case OM_LANCZOS_6X2:
-                case OM_LANCZOS_6X3:
-                case OM_LANCZOS_6X4:
-                case OM_LANCZOS_6X12BIT:
-                case OM_LANCZOS_6X16BIT:
-                case OM_LANCZOS_6X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Perform filtering
-                        size_t can_do   = OS_DOWN_BUFFER_SIZE / 6;
-                        size_t to_do    = lsp_min(samples, can_do);
-
-                        // Pack samples to dst
-                        if (bFilter)
-                        {
-                            sFilter.process(fDownBuffer, src, to_do * 6);
-                            dsp::downsample_6x(dst, fDownBuffer, to_do);
-                        }
-                        else
-                            dsp::downsample_6x(dst, src, to_do);
-
-                        // Update pointers
-                        src            += to_do * 6;
-                        dst            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
+            while (samples > 0)
+            {
+                const size_t to_do  = lsp_min(samples, OS_DOWN_BUFFER_SIZE / nRatio);
 
-                case OM_LANCZOS_8X2:
-                case OM_LANCZOS_8X3:
-                case OM_LANCZOS_8X4:
-                case OM_LANCZOS_8X12BIT:
-                case OM_LANCZOS_8X16BIT:
-                case OM_LANCZOS_8X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Perform filtering
-                        size_t can_do   = OS_DOWN_BUFFER_SIZE >> 3;
-                        size_t to_do    = lsp_min(samples, can_do);
-
-                        // Pack samples to dst
-                        if (bFilter)
-                        {
-                            sFilter.process(fDownBuffer, src, to_do << 3);
-                            dsp::downsample_8x(dst, fDownBuffer, to_do);
-                        }
-                        else
-                            dsp::downsample_8x(dst, src, to_do);
-
-                        // Update pointers
-                        src            += to_do << 3;
-                        dst            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
+                pDecimate(this, dst, src, to_do);
 
-                case OM_NONE:
-                default:
-                    dsp::copy(dst, src, samples);
-                    break;
+                // Update pointers
+                src            += to_do * nRatio;
+                dst            += to_do;
+                samples        -= to_do;
             }
         }
 
         void Oversampler::process(float *dst, const float *src, size_t samples, IOversamplerCallback *callback)
         {
-            switch (nMode)
+            if (nRatio <= 1)
             {
-                case OM_LANCZOS_2X2:
-                case OM_LANCZOS_2X3:
-                case OM_LANCZOS_2X4:
-                case OM_LANCZOS_2X12BIT:
-                case OM_LANCZOS_2X16BIT:
-                case OM_LANCZOS_2X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) >> 1);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-
-                        // Call handler
-                        if (callback != NULL)
-                            callback->process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do << 1);
-
-                        // Do downsampling
-                        if (bFilter)
-                            sFilter.process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do << 1);
-                        dsp::downsample_2x(dst, &fUpBuffer[nUpHead], to_do);
-
-                        // Update pointers
-                        nUpHead        += to_do << 1;
-                        dst            += to_do;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
-
-                case OM_LANCZOS_3X2:
-                case OM_LANCZOS_3X3:
-                case OM_LANCZOS_3X4:
-                case OM_LANCZOS_3X12BIT:
-                case OM_LANCZOS_3X16BIT:
-                case OM_LANCZOS_3X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) / 3);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-
-                        // Call handler
-                        if (callback != NULL)
-                            callback->process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do * 3);
-
-                        // Do downsampling
-                        if (bFilter)
-                            sFilter.process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do * 3);
-                        dsp::downsample_3x(dst, &fUpBuffer[nUpHead], to_do);
-
-                        // Update pointers
-                        nUpHead        += to_do * 3;
-                        dst            += to_do;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
-
-                case OM_LANCZOS_4X2:
-                case OM_LANCZOS_4X3:
-                case OM_LANCZOS_4X4:
-                case OM_LANCZOS_4X12BIT:
-                case OM_LANCZOS_4X16BIT:
-                case OM_LANCZOS_4X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) >> 2);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-
-                        // Call handler
-                        if (callback != NULL)
-                            callback->process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do << 2);
-
-                        // Do downsampling
-                        if (bFilter)
-                            sFilter.process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do << 2);
-                        dsp::downsample_4x(dst, &fUpBuffer[nUpHead], to_do);
-
-                        // Update pointers
-                        nUpHead        += to_do << 2;
-                        dst            += to_do;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
-
-                case OM_LANCZOS_6X2:
-                case OM_LANCZOS_6X3:
-                case OM_LANCZOS_6X4:
-                case OM_LANCZOS_6X12BIT:
-                case OM_LANCZOS_6X16BIT:
-                case OM_LANCZOS_6X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) / 6);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-
-                        // Call handler
-                        if (callback != NULL)
-                            callback->process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do * 6);
-
-                        // Do downsampling
-                        if (bFilter)
-                            sFilter.process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do * 6);
-                        dsp::downsample_6x(dst, &fUpBuffer[nUpHead], to_do);
-
-                        // Update pointers
-                        nUpHead        += to_do * 6;
-                        dst            += to_do;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
-
-                case OM_LANCZOS_8X2:
-                case OM_LANCZOS_8X3:
-                case OM_LANCZOS_8X4:
-                case OM_LANCZOS_8X12BIT:
-                case OM_LANCZOS_8X16BIT:
-                case OM_LANCZOS_8X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) >> 3);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-
-                        // Call handler
-                        if (callback != NULL)
-                            callback->process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do << 3);
-
-                        // Do downsampling
-                        if (bFilter)
-                            sFilter.process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do << 3);
-                        dsp::downsample_8x(dst, &fUpBuffer[nUpHead], to_do);
-
-                        // Update pointers
-                        nUpHead        += to_do << 3;
-                        dst            += to_do;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
+                if (callback != NULL)
+                    callback->process(dst, src, samples);
+                else
+                    dsp::copy(dst, src, samples);
+                return;
+            }
 
-                case OM_NONE:
-                default:
-                    if (callback != NULL)
-                        callback->process(dst, src, samples);
-                    else
-                        dsp::copy(dst, src, samples);
-                    break;
+            while (samples > 0)
+            {
+                check_up_buffer();
+                const size_t to_do  = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) / nRatio);
+                const size_t count  = to_do * nRatio;
+                float *up           = &fUpBuffer[nUpHead];
+
+                // Do oversampling
+                pFunc(up, src, to_do);
+
+                // Call handler
+                if (callback != NULL)
+                    callback->process(up, up, count);
+
+                // Do downsampling
+                pDecimate(this, dst, up, to_do);
+
+                // Update pointers
+                nUpHead        += count;
+                dst            += to_do;
+                src            += to_do;
+                samples        -= to_do;
             }
         }
 
         void Oversampler::process(float *dst, const float *src, size_t samples, oversampler_callback_t callback, void *arg)
         {
-            switch (nMode)
+            if (nRatio <= 1)
             {
-                case OM_LANCZOS_2X2:
-                case OM_LANCZOS_2X3:
-                case OM_LANCZOS_2X4:
-                case OM_LANCZOS_2X12BIT:
-                case OM_LANCZOS_2X16BIT:
-                case OM_LANCZOS_2X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) >> 1);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-
-                        // Call handler
-                        if (callback != NULL)
-                            callback(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do << 1, arg);
-
-                        // Do downsampling
-                        if (bFilter)
-                            sFilter.process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do << 1);
-                        dsp::downsample_2x(dst, &fUpBuffer[nUpHead], to_do);
-
-                        // Update pointers
-                        nUpHead        += to_do << 1;
-                        dst            += to_do;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
-
-                case OM_LANCZOS_3X2:
-                case OM_LANCZOS_3X3:
-                case OM_LANCZOS_3X4:
-                case OM_LANCZOS_3X12BIT:
-                case OM_LANCZOS_3X16BIT:
-                case OM_LANCZOS_3X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) / 3);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-
-                        // Call handler
-                        if (callback != NULL)
-                            callback(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do * 3, arg);
-
-                        // Do downsampling
-                        if (bFilter)
-                            sFilter.process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do * 3);
-                        dsp::downsample_3x(dst, &fUpBuffer[nUpHead], to_do);
-
-                        // Update pointers
-                        nUpHead        += to_do * 3;
-                        dst            += to_do;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
-
-                case OM_LANCZOS_4X2:
-                case OM_LANCZOS_4X3:
-                case OM_LANCZOS_4X4:
-                case OM_LANCZOS_4X12BIT:
-                case OM_LANCZOS_4X16BIT:
-                case OM_LANCZOS_4X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) >> 2);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-
-                        // Call handler
-                        if (callback != NULL)
-                            callback(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do << 2, arg);
-
-                        // Do downsampling
-                        if (bFilter)
-                            sFilter.process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do << 2);
-                        dsp::downsample_4x(dst, &fUpBuffer[nUpHead], to_do);
-
-                        // Update pointers
-                        nUpHead        += to_do << 2;
-                        dst            += to_do;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
-
-                case OM_LANCZOS_6X2:
-                case OM_LANCZOS_6X3:
-                case OM_LANCZOS_6X4:
-                case OM_LANCZOS_6X12BIT:
-                case OM_LANCZOS_6X16BIT:
-                case OM_LANCZOS_6X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) / 6);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-
-                        // Call handler
-                        if (callback != NULL)
-                            callback(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do * 6, arg);
-
-                        // Do downsampling
-                        if (bFilter)
-                            sFilter.process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do * 6);
-                        dsp::downsample_6x(dst, &fUpBuffer[nUpHead], to_do);
-
-                        // Update pointers
-                        nUpHead        += to_do * 6;
-                        dst            += to_do;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
-
-                case OM_LANCZOS_8X2:
-                case OM_LANCZOS_8X3:
-                case OM_LANCZOS_8X4:
-                case OM_LANCZOS_8X12BIT:
-                case OM_LANCZOS_8X16BIT:
-                case OM_LANCZOS_8X24BIT:
-                {
-                    while (samples > 0)
-                    {
-                        // Check that there is enough space in buffer
-                        if (nUpHead >= OS_UP_BUFFER_SIZE)
-                        {
-                            dsp::move(fUpBuffer, &fUpBuffer[nUpHead], LSP_DSP_RESAMPLING_RSV_SAMPLES);
-                            dsp::fill_zero(&fUpBuffer[LSP_DSP_RESAMPLING_RSV_SAMPLES], OS_UP_BUFFER_SIZE);
-                            nUpHead         = 0;
-                        }
-
-                        size_t to_do    = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) >> 3);
-
-                        // Do oversampling
-                        pFunc(&fUpBuffer[nUpHead], src, to_do);
-
-                        // Call handler
-                        if (callback != NULL)
-                            callback(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do << 3, arg);
-
-                        // Do downsampling
-                        if (bFilter)
-                            sFilter.process(&fUpBuffer[nUpHead], &fUpBuffer[nUpHead], to_do << 3);
-                        dsp::downsample_8x(dst, &fUpBuffer[nUpHead], to_do);
-
-                        // Update pointers
-                        nUpHead        += to_do << 3;
-                        dst            += to_do;
-                        src            += to_do;
-                        samples        -= to_do;
-                    }
-                    break;
-                }
+                if (callback != NULL)
+                    callback(dst, src, samples, arg);
+                else
+                    dsp::copy(dst, src, samples);
+                return;
+            }
 
-                case OM_NONE:
-                default:
-                    if (callback != NULL)
-                        callback(dst, src, samples, arg);
-                    else
-                        dsp::copy(dst, src, samples);
-                    break;
+            while (samples > 0)
+            {
+                check_up_buffer();
+                const size_t to_do  = lsp_min(samples, (OS_UP_BUFFER_SIZE - nUpHead) / nRatio);
+                const size_t count  = to_do * nRatio;
+                float *up           = &fUpBuffer[nUpHead];
+
+                // Do oversampling
+                pFunc(up, src, to_do);
+
+                // Call handler
+                if (callback != NULL)
+                    callback(up, up, count, arg);
+
+                // Do downsampling
+                pDecimate(this, dst, up, to_do);
+
+                // Update pointers
+                nUpHead        += count;
+                dst            += to_do;
+                src            += to_do;
+                samples        -= to_do;
             }
         }
 
         size_t Oversampler::latency() const
         {
-            switch (nMode)
+            return (nFirLength > 0) ? get_latency(nMode) + OVERSAMPLER_FIR_LATENCY : get_latency(nMode);
+        }
+
+        size_t Oversampler::get_latency(size_t mode)
+        {
+            switch (mode)
             {
                 case OM_LANCZOS_2X2:
                 case OM_LANCZOS_3X2:
@@ -1051,17 +507,108 @@ namespace lsp
             return dsp::copy;
         }
 
+        Oversampler::resample_func_t Oversampler::get_down_function(size_t ratio)
+        {
+            switch (ratio)
+            {
+                case 2:     return dsp::downsample_2x;
+                case 3:     return dsp::downsample_3x;
+                case 4:     return dsp::downsample_4x;
+                case 6:     return dsp::downsample_6x;
+                case 8:     return dsp::downsample_8x;
+                default:
+                    break;
+            }
+
+            return dsp::copy;
+        }
 
         void Oversampler::set_mode(over_mode_t mode)
         {
             if (nMode == mode)
                 return;
             nMode       = mode;
+            nRatio      = get_ratio(mode);
             pFunc       = get_function(mode);
+            pDownFunc   = get_down_function(nRatio);
 
             nUpdate   |= UP_MODE;
         }
 
+        void Oversampler::set_filter_type(over_filter_t type)
+        {
+            if (nFilterType == type)
+                return;
+            nFilterType = type;
+
+            nUpdate   |= UP_MODE;
+        }
+
+        size_t Oversampler::fir_buffer_size()
+        {
+            return OS_FIR_BUFFER_SIZE + OVERSAMPLER_FIR_MAX_LENGTH;
+        }
+
+        size_t Oversampler::build_fir_kernel(float *dst, size_t ratio)
+        {
+            if (ratio <= 1)
+                return 0;
+
+            // Build the Kaiser-windowed sinc low-pass filter. The cutoff frequency is placed
+            // in the middle of the transition band and is relative to the oversampled sample rate.
+            // Signal between the Nyquist frequency and the stop band folds back only into the
+            // transition band above OS_FIR_PASS_BAND, the pass band stays free of aliasing.
+            const size_t length     = ratio * OVERSAMPLER_FIR_PHASE_TAPS + 1;
+            const ssize_t center    = length >> 1;
+            const float fc          = 0.5f * (OS_FIR_PASS_BAND + OS_FIR_STOP_BAND) / ratio;
+            const float kw          = 2.0f * M_PI * fc;
+            const float kx          = 1.0f / center;
+            const float norm        = 1.0f / bessel_i0(OS_FIR_KAISER_BETA);
+
+            float sum               = 0.0f;
+            for (size_t i=0; i<length; ++i)
+            {
+                const ssize_t t         = ssize_t(i) - center;
+                const float x           = t * kx;
+                const float w           = bessel_i0(OS_FIR_KAISER_BETA * sqrtf(lsp_max(1.0f - x*x, 0.0f))) * norm;
+                dst[i]                  = w * ((t != 0) ? sinf(kw * t) / (M_PI * t) : 2.0f * fc);
+                sum                    += dst[i];
+            }
+
+            // Normalize the filter to have unity gain at DC
+            dsp::mul_k2(dst, 1.0f / sum, length);
+
+            return length;
+        }
+
+        void Oversampler::fir_downsample(float *dst, float *buf, const float *src,
+            const float *kernel, size_t length, size_t ratio, size_t samples)
+        {
+            // The buffer contains (length - 1) samples of history followed by the new data,
+            // the kernel is symmetric, so there is no need to reverse it
+            const size_t history    = length - 1;
+
+            while (samples > 0)
+            {
+                const size_t to_do      = lsp_min(samples, OS_FIR_BUFFER_SIZE / ratio);
+                const size_t count      = to_do * ratio;
+
+                dsp::copy(&buf[history], src, count);
+
+                // Compute only the samples which are kept after decimation
+                const float *s          = buf;
+                for (size_t i=0; i<to_do; ++i, s += ratio)
+                    dst[i]      = dsp::h_dotp(kernel, s, length);
+
+                // Save the history
+                dsp::move(buf, &buf[count], history);
+
+                dst        += to_do;
+                src        += count;
+                samples    -= to_do;
+            }
+        }
+
         over_mode_t Oversampler::mode() const
         {
             return over_mode_t(nMode);
@@ -1077,9 +624,16 @@ namespace lsp
             v->write("pCallback", pCallback);
             v->write("fUpBuffer", fUpBuffer);
             v->write("fDownBuffer", fDownBuffer);
+            v->write("vFirKernel", vFirKernel);
+            v->write("vFirBuffer", vFirBuffer);
             v->write("pFunc", pFunc);
+            v->write("pDownFunc", pDownFunc);
+            v->write("pDecimate", pDecimate);
             v->write("nUpHead", nUpHead);
+            v->write("nRatio", nRatio);
             v->write("nMode", nMode);
+            v->write("nFilterType", nFilterType);
+            v->write("nFirLength", nFirLength);
             v->write("nSampleRate", nSampleRate);
             v->write("nUpdate", nUpdate);
             v->write_object("sFilter", &sFilter);
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp-units/util/Semaphore.h>
+
+#if defined(PLATFORM_WINDOWS)
+    #include <windows.h>
+#elif defined(PLATFORM_MACOSX)
+    #include <dispatch/dispatch.h>
+#else
+    #include <errno.h>
+    #include <semaphore.h>
+    #include <time.h>
+#endif /* PLATFORM_WINDOWS */
+
+namespace lsp
+{
+    namespace dspu
+    {
+    #if defined(PLATFORM_WINDOWS)
+        Semaphore::Semaphore()
+        {
+            hHandle         = CreateSemaphoreW(NULL, 0, LONG_MAX, NULL);
+        }
+
+        Semaphore::~Semaphore()
+        {
+            if (hHandle != NULL)
+            {
+                CloseHandle(hHandle);
+                hHandle         = NULL;
+            }
+        }
+
+        void Semaphore::post()
+        {
+            ReleaseSemaphore(hHandle, 1, NULL);
+        }
+
+        void Semaphore::post(size_t count)
+        {
+            if (count > 0)
+                ReleaseSemaphore(hHandle, LONG(count), NULL);
+        }
+
+        bool Semaphore::wait()
+        {
+            return WaitForSingleObject(hHandle, INFINITE) == WAIT_OBJECT_0;
+        }
+
+        bool Semaphore::wait(size_t millis)
+        {
+            return WaitForSingleObject(hHandle, DWORD(millis)) == WAIT_OBJECT_0;
+        }
+
+        bool Semaphore::try_wait()
+        {
+            return WaitForSingleObject(hHandle, 0) == WAIT_OBJECT_0;
+        }
+
+    #elif defined(PLATFORM_MACOSX)
+        Semaphore::Semaphore()
+        {
+            hHandle         = dispatch_semaphore_create(0);
+        }
+
+        Semaphore::~Semaphore()
+        {
+            if (hHandle != NULL)
+            {
+                dispatch_release(static_cast<dispatch_semaphore_t>(hHandle));
+                hHandle         = NULL;
+            }
+        }
+
+        void Semaphore::post()
+        {
+            dispatch_semaphore_signal(static_cast<dispatch_semaphore_t>(hHandle));
+        }
+
+        void Semaphore::post(size_t count)
+        {
+            for (size_t i=0; i<count; ++i)
+                dispatch_semaphore_signal(static_cast<dispatch_semaphore_t>(hHandle));
+        }
+
+        bool Semaphore::wait()
+        {
+            return dispatch_semaphore_wait(static_cast<dispatch_semaphore_t>(hHandle), DISPATCH_TIME_FOREVER) == 0;
+        }
+
+        bool Semaphore::wait(size_t millis)
+        {
+            dispatch_time_t deadline = dispatch_time(DISPATCH_TIME_NOW, int64_t(millis) * NSEC_PER_MSEC);
+            return dispatch_semaphore_wait(static_cast<dispatch_semaphore_t>(hHandle), deadline) == 0;
+        }
+
+        bool Semaphore::try_wait()
+        {
+            return dispatch_semaphore_wait(static_cast<dispatch_semaphore_t>(hHandle), DISPATCH_TIME_NOW) == 0;
+        }
+
+    #else
+        Semaphore::Semaphore()
+        {
+            sem_t *sem      = new sem_t;
+            if ((sem != NULL) && (sem_init(sem, 0, 0) != 0))
+            {
+                delete sem;
+                sem             = NULL;
+            }
+            hHandle         = sem;
+        }
+
+        Semaphore::~Semaphore()
+        {
+            sem_t *sem      = static_cast<sem_t *>(hHandle);
+            if (sem != NULL)
+            {
+                sem_destroy(sem);
+                delete sem;
+                hHandle         = NULL;
+            }
+        }
+
+        void Semaphore::post()
+        {
+            sem_post(static_cast<sem_t *>(hHandle));
+        }
+
+        void Semaphore::post(size_t count)
+        {
+            sem_t *sem      = static_cast<sem_t *>(hHandle);
+            for (size_t i=0; i<count; ++i)
+                sem_post(sem);
+        }
+
+        bool Semaphore::wait()
+        {
+            sem_t *sem      = static_cast<sem_t *>(hHandle);
+            while (sem_wait(sem) != 0)
+            {
+                if (errno != EINTR)
+                    return false;
+            }
+            return true;
+        }
+
+        bool Semaphore::wait(size_t millis)
+        {
+            sem_t *sem      = static_cast<sem_t *>(hHandle);
+
+            // Compute the deadline
+            struct timespec ts;
+            clock_gettime(CLOCK_REALTIME, &ts);
+            ts.tv_sec      += millis / 1000;
+            ts.tv_nsec     += (millis % 1000) * 1000000;
+            if (ts.tv_nsec >= 1000000000)
+            {
+                ts.tv_sec      += 1;
+                ts.tv_nsec     -= 1000000000;
+            }
+
+            while (sem_timedwait(sem, &ts) != 0)
+            {
+                if (errno != EINTR)
+                    return false;
+            }
+            return true;
+        }
+
+        bool Semaphore::try_wait()
+        {
+            return sem_trywait(static_cast<sem_t *>(hHandle)) == 0;
+        }
+
+    #endif /* PLATFORM_WINDOWS */
+    } /* namespace dspu */
+} /* namespace lsp */
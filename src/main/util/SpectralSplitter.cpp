@@ -23,12 +23,15 @@
 #include <lsp-plug.in/dsp-units/misc/windows.h>
 #include <lsp-plug.in/common/alloc.h>
 #include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
 
 namespace lsp
 {
     namespace dspu
     {
         static constexpr size_t BUFFER_MULTIPLIER = 4;
+        static constexpr size_t PRUNE_MIN_RANK    = 4;  // Minimum rank of the short inverse FFT
+        static constexpr size_t PRUNE_MIN_SHIFT   = 4;  // Minimum log2(decimation) to prefer the pruned FFT
 
         SpectralSplitter::SpectralSplitter()
         {
@@ -51,9 +54,13 @@ namespace lsp
             vInBuf          = NULL;
             vFftBuf         = NULL;
             vFftTmp         = NULL;
+            vTwiddle        = NULL;
+            vPruneBuf       = NULL;
             nFrameSize      = 0;
             nInOffset       = 0;
+            nTwiddleRank    = 0;
             bUpdate         = true;
+            bPruning        = false;
             vHandlers       = NULL;
             nHandlers       = 0;
             nBindings       = 0;
@@ -72,7 +79,10 @@ namespace lsp
             vInBuf          = NULL;
             vFftBuf         = NULL;
             vFftTmp         = NULL;
+            vTwiddle        = NULL;
+            vPruneBuf       = NULL;
             nFrameSize      = 0;
+            nTwiddleRank    = 0;
             vHandlers       = NULL;
             nHandlers       = 0;
             nBindings       = 0;
@@ -95,7 +105,9 @@ namespace lsp
                 buf_sz * BUFFER_MULTIPLIER + // vInBuf
                 buf_sz * 2 + // vFftBuf
                 buf_sz * 2 + // vFftTmp
-                handlers * buf_sz * BUFFER_MULTIPLIER; // vHandlers[i].pOutBuf
+                buf_sz * 2 + // vTwiddle
+                handlers * buf_sz * BUFFER_MULTIPLIER + // vHandlers[i].pOutBuf
+                buf_sz / 4; // vPruneBuf
 
             uint8_t *ptr    = alloc_aligned<uint8_t>(pData, to_alloc, DEFAULT_ALIGN);
             if (ptr == NULL)
@@ -111,6 +123,8 @@ namespace lsp
             ptr            += buf_sz * 2;
             vFftTmp         = reinterpret_cast<float *>(ptr);
             ptr            += buf_sz * 2;
+            vTwiddle        = reinterpret_cast<float *>(ptr);
+            ptr            += buf_sz * 2;
 
             // Initialize handlers
             for (size_t i=0; i<handlers; ++i)
@@ -125,6 +139,7 @@ namespace lsp
                 ptr            += buf_sz * BUFFER_MULTIPLIER;
             }
 
+            vPruneBuf       = reinterpret_cast<float *>(ptr);
             nHandlers       = handlers;
 
             return STATUS_OK;
@@ -145,6 +160,9 @@ namespace lsp
             vInBuf          = NULL;
             vFftBuf         = NULL;
             vFftTmp         = NULL;
+            vTwiddle        = NULL;
+            vPruneBuf       = NULL;
+            nTwiddleRank    = 0;
             bUpdate         = false;
             vHandlers       = NULL;
             nHandlers       = 0;
@@ -236,6 +254,8 @@ namespace lsp
 
             // Clear buffers and reset pointers
             windows::sqr_cosine(vWnd, frame_size * 2);
+            if ((bPruning) && (nTwiddleRank != nRank))
+                build_twiddles(nRank);
             clear();
 
             nFrameSize          = frame_size * (fPhase * 0.5f);
@@ -274,6 +294,16 @@ namespace lsp
             bUpdate         = true;
         }
 
+        void SpectralSplitter::set_pruning(bool enable)
+        {
+            if (enable == bPruning)
+                return;
+
+            bPruning        = enable;
+            if ((bPruning) && (nTwiddleRank != nRank))
+                bUpdate         = true;
+        }
+
         void SpectralSplitter::set_chunk_rank(ssize_t rank)
         {
             if (rank == nUserChunkRank)
@@ -294,6 +324,151 @@ namespace lsp
             return 1 << chunk_rank;
         }
 
+        void SpectralSplitter::build_twiddles(size_t rank)
+        {
+            // Compute exp(2*pi*j*k/N) for k = 0..N-1 using the quarter-period symmetry
+            const size_t size       = 1 << rank;
+            const size_t quarter    = size >> 2;
+            const float kw          = 2.0f * M_PI / size;
+            float *t0               = vTwiddle;
+            float *t1               = &vTwiddle[quarter * 2];
+            float *t2               = &vTwiddle[quarter * 4];
+            float *t3               = &vTwiddle[quarter * 6];
+
+            for (size_t k=0; k<quarter; ++k)
+            {
+                const float c   = cosf(k * kw);
+                const float s   = sinf(k * kw);
+
+                t0[0]           = c;
+                t0[1]           = s;
+                t1[0]           = -s;
+                t1[1]           = c;
+                t2[0]           = -c;
+                t2[1]           = -s;
+                t3[0]           = s;
+                t3[1]           = -c;
+
+                t0             += 2;
+                t1             += 2;
+                t2             += 2;
+                t3             += 2;
+            }
+
+            nTwiddleRank    = rank;
+        }
+
+        static inline bool is_zero_bin(const float *c)
+        {
+            return (c[0] == 0.0f) && (c[1] == 0.0f);
+        }
+
+        bool SpectralSplitter::pruned_reverse_fft(float *dst, const float *src, size_t frame_size)
+        {
+            if (nTwiddleRank != nRank)
+                return false;
+
+            const size_t size       = 1 << nRank;
+            const size_t half       = size >> 1;
+            const size_t mask       = size - 1;
+
+            // The real part of the output depends only on Z[k] = X[k] + conj(X[N-k]), k = 0..N/2,
+            // so find the range of non-zero bins of the positive half and the mirrored negative half
+            size_t first            = half + 1;
+            size_t last             = 0;
+            for (size_t k=0; k<=half; ++k)
+                if (!is_zero_bin(&src[k*2]))
+                {
+                    first           = k;
+                    break;
+                }
+            for (size_t k=half; k>=first; --k)
+                if (!is_zero_bin(&src[k*2]))
+                {
+                    last            = k;
+                    break;
+                }
+            for (size_t k=1; (k<half) && (k<first); ++k)
+                if (!is_zero_bin(&src[(size - k)*2]))
+                {
+                    first           = k;
+                    break;
+                }
+            for (size_t k=half-1; (k>0) && (k>last); --k)
+                if (!is_zero_bin(&src[(size - k)*2]))
+                {
+                    last            = k;
+                    break;
+                }
+
+            // Empty spectrum?
+            const size_t out_size   = frame_size * 2;
+            if (first > last)
+            {
+                dsp::fill_zero(dst, out_size);
+                return true;
+            }
+
+            // Estimate the size of the short transform, fall back to full FFT for wide bands
+            const size_t bins       = last - first + 1;
+            size_t rank             = PRUNE_MIN_RANK;
+            while ((size_t(1) << rank) < bins)
+                ++rank;
+            if (rank + PRUNE_MIN_SHIFT > nRank)
+                return false;
+
+            // Fetch band data, after this the source buffer is not used anymore
+            float *band             = vPruneBuf;
+            for (size_t m=0; m<bins; ++m)
+            {
+                const size_t k  = first + m;
+                const float *p  = &src[k*2];
+                float re        = p[0];
+                float im        = p[1];
+                if ((k > 0) && (k < half))
+                {
+                    const float *n  = &src[(size - k)*2];
+                    re             += n[0];
+                    im             -= n[1];
+                }
+                band[m*2]       = re;
+                band[m*2 + 1]   = im;
+            }
+
+            // Output sample n = p*L + r is computed by the inverse FFT of size M = N/L of the band
+            // shifted to the baseband and rotated by exp(2*pi*j*m*r/N), followed by the rotation
+            // by exp(2*pi*j*first*n/N)
+            const size_t shift      = nRank - rank;
+            const size_t step       = size_t(1) << shift;
+            const size_t length     = size_t(1) << rank;
+            const size_t start      = size - out_size;
+            const float norm        = 1.0f / step;
+            float *buf              = &dst[size];
+
+            for (size_t r=0; r<step; ++r)
+            {
+                for (size_t m=0; m<bins; ++m)
+                {
+                    const float *b  = &band[m*2];
+                    const float *w  = &vTwiddle[((m * r) & mask) * 2];
+                    buf[m*2]        = b[0]*w[0] - b[1]*w[1];
+                    buf[m*2 + 1]    = b[0]*w[1] + b[1]*w[0];
+                }
+                dsp::fill_zero(&buf[bins*2], (length - bins) * 2);
+                dsp::packed_reverse_fft(buf, buf, rank);
+
+                size_t p        = (start > r) ? (start - r + step - 1) >> shift : 0;
+                for (size_t n = (p << shift) + r; p<length; ++p, n += step)
+                {
+                    const float *y  = &buf[p*2];
+                    const float *w  = &vTwiddle[((first * n) & mask) * 2];
+                    dst[n - start]  = (y[0]*w[0] - y[1]*w[1]) * norm;
+                }
+            }
+
+            return true;
+        }
+
         void SpectralSplitter::process(const float *src, size_t count)
         {
             // Check if we need to commit new settings
@@ -324,8 +499,11 @@ namespace lsp
                         if (h->pFunc != NULL)
                         {
                             h->pFunc(h->pObject, h->pSubject, vFftTmp, vFftBuf, nRank);
-                            dsp::packed_reverse_fft(vFftTmp, vFftTmp, nRank);                                   // Perform reverse FFT
-                            dsp::pcomplex_c2r(vFftTmp, &vFftTmp[buf_size*2 - frame_size*4], frame_size * 2);    // Unpack complex numbers
+                            if ((!bPruning) || (!pruned_reverse_fft(vFftTmp, vFftTmp, frame_size)))
+                            {
+                                dsp::packed_reverse_fft(vFftTmp, vFftTmp, nRank);                                   // Perform reverse FFT
+                                dsp::pcomplex_c2r(vFftTmp, &vFftTmp[buf_size*2 - frame_size*4], frame_size * 2);    // Unpack complex numbers
+                            }
                         }
                         else
                             dsp::copy(vFftTmp, &vInBuf[nInOffset], frame_size * 2);  // Copy data to FFT buffer
@@ -396,8 +574,12 @@ namespace lsp
             v->write("vInBuf", vInBuf);
             v->write("vFftBuf", vFftBuf);
             v->write("vFftTmp", vFftTmp);
+            v->write("vTwiddle", vTwiddle);
+            v->write("vPruneBuf", vPruneBuf);
             v->write("nFrameSize", nFrameSize);
             v->write("nInOffset", nInOffset);
+            v->write("nTwiddleRank", nTwiddleRank);
+            v->write("bPruning", bPruning);
 
             v->begin_array("vHandlers", vHandlers, nHandlers);
             {
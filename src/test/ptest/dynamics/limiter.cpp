@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/dynamics/Limiter.h>
+
+#define SRATE           48000
+#define MAX_BLOCK       4096
+#define MAX_CHANNELS    8
+#define LOOKAHEAD       5.0f
+
+static const size_t block_sizes[] = { 64, 1024, MAX_BLOCK };
+static const size_t channels[] = { 1, 2, MAX_CHANNELS };
+
+typedef struct lim_mode_t
+{
+    const char                 *name;
+    lsp::dspu::limiter_mode_t   mode;
+} lim_mode_t;
+
+typedef struct lim_engine_t
+{
+    const char                 *name;
+    lsp::dspu::limiter_engine_t engine;
+} lim_engine_t;
+
+#define LIM_MODE(x)     { #x, lsp::dspu::x }
+
+static const lim_mode_t modes[] =
+{
+    LIM_MODE(LM_HERM_THIN),
+    LIM_MODE(LM_HERM_WIDE),
+    LIM_MODE(LM_HERM_TAIL),
+    LIM_MODE(LM_HERM_DUCK),
+    LIM_MODE(LM_EXP_THIN),
+    LIM_MODE(LM_EXP_WIDE),
+    LIM_MODE(LM_EXP_TAIL),
+    LIM_MODE(LM_EXP_DUCK),
+    LIM_MODE(LM_LINE_THIN),
+    LIM_MODE(LM_LINE_WIDE),
+    LIM_MODE(LM_LINE_TAIL),
+    LIM_MODE(LM_LINE_DUCK),
+};
+
+#undef LIM_MODE
+
+static const lim_engine_t engines[] =
+{
+    { "iterative",      lsp::dspu::LE_ITERATIVE     },
+    { "single_pass",    lsp::dspu::LE_SINGLE_PASS   },
+};
+
+PTEST_BEGIN("dspu.dynamics", limiter, 1, 1000)
+
+    void call(const char *mode, const char *engine, dspu::Limiter *l, float * const *gain, const float * const *sc, size_t nch, size_t block)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s %s ch=%d blk=%d", mode, engine, int(nch), int(block));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<nch; ++i)
+                l[i].process(gain[i], sc[i], block);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *ptr          = alloc_aligned<float>(data, MAX_BLOCK * MAX_CHANNELS * 2, 64);
+        float *sc[MAX_CHANNELS], *gain[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            sc[i]               = ptr;
+            gain[i]             = &ptr[MAX_BLOCK];
+            ptr                += MAX_BLOCK * 2;
+
+            // Sidechain signal peaks up to +6 dB over the threshold
+            randomize_sign(sc[i], MAX_BLOCK);
+            dsp::abs1(sc[i], MAX_BLOCK);
+            dsp::mul_k2(sc[i], 2.0f, MAX_BLOCK);
+        }
+
+        dspu::Limiter l[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            l[i].init(SRATE, LOOKAHEAD);
+            l[i].set_sample_rate(SRATE);
+            l[i].set_threshold(1.0f, true);
+            l[i].set_lookahead(LOOKAHEAD);
+        }
+
+        for (size_t i=0; i<sizeof(modes)/sizeof(lim_mode_t); ++i)
+        {
+            const lim_mode_t *m = &modes[i];
+            for (size_t j=0; j<sizeof(engines)/sizeof(lim_engine_t); ++j)
+            {
+                const lim_engine_t *e = &engines[j];
+                for (size_t k=0; k<MAX_CHANNELS; ++k)
+                {
+                    l[k].set_mode(m->mode);
+                    l[k].set_engine(e->engine);
+                    l[k].update_settings();
+                }
+
+                for (size_t k=0; k<sizeof(channels)/sizeof(size_t); ++k)
+                    for (size_t n=0; n<sizeof(block_sizes)/sizeof(size_t); ++n)
+                        call(m->name, e->name, l, gain, sc, channels[k], block_sizes[n]);
+            }
+            PTEST_SEPARATOR;
+        }
+
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+            l[i].destroy();
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/const.h>
+#include <lsp-plug.in/dsp-units/filters/DynamicFilters.h>
+
+#define SRATE           48000
+#define MAX_BLOCK       4096
+#define MAX_CHANNELS    8
+
+static const size_t block_sizes[] = { 64, 256, 1024, MAX_BLOCK };
+static const size_t channels[] = { 1, 2, MAX_CHANNELS };
+
+typedef struct filter_spec_t
+{
+    const char     *name;
+    uint32_t        type;
+    uint32_t        slope;
+} filter_spec_t;
+
+static const filter_spec_t filters[] =
+{
+    { "BT_RLC_BELL",        lsp::dspu::FLT_BT_RLC_BELL,         1 },
+    { "BT_BWC_HISHELF",     lsp::dspu::FLT_BT_BWC_HISHELF,      4 },
+    { "BT_BWC_BELL",        lsp::dspu::FLT_BT_BWC_BELL,         4 },
+    { "BT_LRX_LADDERPASS",  lsp::dspu::FLT_BT_LRX_LADDERPASS,   2 },
+};
+
+PTEST_BEGIN("dspu.filters", dynamic_filters, 5, 1000)
+
+    void call(const char *label, dspu::DynamicFilters *df, float * const *out, const float * const *in, const float *gain, size_t nch, size_t block)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s ch=%d blk=%d", label, int(nch), int(block));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<nch; ++i)
+                df->process(i, out[i], in[i], gain, block);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *ptr          = alloc_aligned<float>(data, MAX_BLOCK * (MAX_CHANNELS * 2 + 1), 64);
+        float *in[MAX_CHANNELS], *out[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            in[i]               = ptr;
+            out[i]              = &ptr[MAX_BLOCK];
+            ptr                += MAX_BLOCK * 2;
+            randomize_sign(in[i], MAX_BLOCK);
+        }
+
+        // Gain sweeps from -6 dB to +6 dB and forces recomputation of coefficients
+        float *gain         = ptr;
+        for (size_t i=0; i<MAX_BLOCK; ++i)
+            gain[i]             = 0.5f + (1.5f * i) / MAX_BLOCK;
+
+        dspu::DynamicFilters df;
+        df.init(MAX_CHANNELS);
+        df.set_sample_rate(SRATE);
+
+        dspu::filter_params_t fp;
+        fp.fFreq            = 1000.0f;
+        fp.fFreq2           = 4000.0f;
+        fp.fGain            = 1.0f;
+        fp.fQuality         = 0.5f;
+
+        for (size_t i=0; i<sizeof(filters)/sizeof(filter_spec_t); ++i)
+        {
+            const filter_spec_t *spec = &filters[i];
+            fp.nType            = spec->type;
+            fp.nSlope           = spec->slope;
+            for (size_t j=0; j<MAX_CHANNELS; ++j)
+            {
+                df.set_params(j, &fp);
+                df.set_filter_active(j, true);
+            }
+
+            for (size_t j=0; j<sizeof(channels)/sizeof(size_t); ++j)
+                for (size_t k=0; k<sizeof(block_sizes)/sizeof(size_t); ++k)
+                    call(spec->name, &df, out, in, gain, channels[j], block_sizes[k]);
+            PTEST_SEPARATOR;
+
+            // Same with gain-indexed coefficient tables
+            char label[80];
+            snprintf(label, sizeof(label), "%s table", spec->name);
+            df.set_gain_table(GAIN_AMP_M_12_DB, GAIN_AMP_P_12_DB, 0.1f);
+            for (size_t j=0; j<MAX_CHANNELS; ++j)
+            {
+                df.set_params(j, &fp);
+                df.set_filter_active(j, true);
+            }
+
+            for (size_t j=0; j<sizeof(channels)/sizeof(size_t); ++j)
+                for (size_t k=0; k<sizeof(block_sizes)/sizeof(size_t); ++k)
+                    call(label, &df, out, in, gain, channels[j], block_sizes[k]);
+            PTEST_SEPARATOR;
+
+            df.set_gain_table(0.0f, 0.0f, 0.0f);
+        }
+
+        df.destroy();
+        free_aligned(data);
+    }
+
+PTEST_END
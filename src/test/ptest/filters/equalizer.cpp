@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/filters/Equalizer.h>
+
+#define SRATE           48000
+#define MAX_BLOCK       4096
+#define MAX_CHANNELS    8
+#define FILTERS         16
+#define FIR_RANK        12
+
+static const size_t block_sizes[] = { 64, 256, 1024, MAX_BLOCK };
+static const size_t channels[] = { 1, 2, MAX_CHANNELS };
+
+typedef struct eq_mode_t
+{
+    const char                 *name;
+    lsp::dspu::equalizer_mode_t mode;
+} eq_mode_t;
+
+static const eq_mode_t modes[] =
+{
+    { "EQM_BYPASS",     lsp::dspu::EQM_BYPASS   },
+    { "EQM_IIR",        lsp::dspu::EQM_IIR      },
+    { "EQM_FIR",        lsp::dspu::EQM_FIR      },
+    { "EQM_FFT",        lsp::dspu::EQM_FFT      },
+    { "EQM_SPM",        lsp::dspu::EQM_SPM      },
+};
+
+PTEST_BEGIN("dspu.filters", equalizer, 5, 1000)
+
+    void call(const char *label, dspu::Equalizer *eq, float * const *out, const float * const *in, size_t nch, size_t block)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s ch=%d blk=%d", label, int(nch), int(block));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<nch; ++i)
+                eq[i].process(out[i], in[i], block);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *ptr          = alloc_aligned<float>(data, MAX_BLOCK * MAX_CHANNELS * 2, 64);
+        float *in[MAX_CHANNELS], *out[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            in[i]               = ptr;
+            out[i]              = &ptr[MAX_BLOCK];
+            ptr                += MAX_BLOCK * 2;
+            randomize_sign(in[i], MAX_BLOCK);
+        }
+
+        dspu::Equalizer eq[MAX_CHANNELS];
+        dspu::filter_params_t fp;
+        fp.nType            = dspu::FLT_BT_BWC_BELL;
+        fp.nSlope           = 2;
+        fp.fFreq2           = 0.0f;
+        fp.fQuality         = 0.5f;
+
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            eq[i].init(FILTERS, FIR_RANK);
+            eq[i].set_sample_rate(SRATE);
+            for (size_t j=0; j<FILTERS; ++j)
+            {
+                fp.fFreq            = 40.0f + 1200.0f * j;
+                fp.fGain            = (j & 1) ? 2.0f : 0.5f;
+                eq[i].set_params(j, &fp);
+            }
+        }
+
+        for (size_t i=0; i<sizeof(modes)/sizeof(eq_mode_t); ++i)
+        {
+            const eq_mode_t *m  = &modes[i];
+            for (size_t j=0; j<MAX_CHANNELS; ++j)
+            {
+                eq[j].set_mode(m->mode);
+                eq[j].process(out[j], in[j], MAX_BLOCK); // Apply settings before measuring
+            }
+
+            for (size_t j=0; j<sizeof(channels)/sizeof(size_t); ++j)
+                for (size_t k=0; k<sizeof(block_sizes)/sizeof(size_t); ++k)
+                    call(m->name, eq, out, in, channels[j], block_sizes[k]);
+            PTEST_SEPARATOR;
+        }
+
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+            eq[i].destroy();
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/filters/Filter.h>
+#include <lsp-plug.in/dsp-units/filters/FilterBank.h>
+
+#define SRATE           48000
+#define MAX_BLOCK       4096
+#define MAX_CHANNELS    8
+#define MAX_CHAINS      32
+
+static const size_t block_sizes[] = { 64, 256, 1024, MAX_BLOCK };
+static const size_t channels[] = { 1, 2, MAX_CHANNELS };
+static const size_t chains[] = { 1, 4, 8, MAX_CHAINS };
+
+typedef struct filter_spec_t
+{
+    const char     *name;
+    uint32_t        type;
+    uint32_t        slope;
+} filter_spec_t;
+
+static const filter_spec_t filters[] =
+{
+    { "BT_RLC_BELL",        lsp::dspu::FLT_BT_RLC_BELL,         1 },
+    { "BT_BWC_LOPASS",      lsp::dspu::FLT_BT_BWC_LOPASS,       4 },
+    { "BT_BWC_BELL",        lsp::dspu::FLT_BT_BWC_BELL,         8 },
+    { "MT_LRX_LOPASS",      lsp::dspu::FLT_MT_LRX_LOPASS,       4 },
+};
+
+PTEST_BEGIN("dspu.filters", filter, 5, 1000)
+
+    void call(const char *label, dspu::Filter *f, float * const *out, const float * const *in, size_t nch, size_t block)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "filter %s ch=%d blk=%d", label, int(nch), int(block));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<nch; ++i)
+                f[i].process(out[i], in[i], block);
+        );
+    }
+
+    void call(dspu::FilterBank *fb, float *out, const float *in, size_t nchains, size_t block)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "bank chains=%d ch=1 blk=%d", int(nchains), int(block));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            fb->process(out, in, block);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *ptr          = alloc_aligned<float>(data, MAX_BLOCK * MAX_CHANNELS * 2, 64);
+        float *in[MAX_CHANNELS], *out[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            in[i]               = ptr;
+            out[i]              = &ptr[MAX_BLOCK];
+            ptr                += MAX_BLOCK * 2;
+            randomize_sign(in[i], MAX_BLOCK);
+        }
+
+        dspu::filter_params_t fp;
+        fp.fFreq            = 1000.0f;
+        fp.fFreq2           = 4000.0f;
+        fp.fGain            = 2.0f;
+        fp.fQuality         = 0.5f;
+
+        // Standalone filters, one per channel
+        dspu::Filter f[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+            f[i].init(NULL);
+
+        for (size_t i=0; i<sizeof(filters)/sizeof(filter_spec_t); ++i)
+        {
+            const filter_spec_t *spec = &filters[i];
+            fp.nType            = spec->type;
+            fp.nSlope           = spec->slope;
+            for (size_t j=0; j<MAX_CHANNELS; ++j)
+                f[j].update(SRATE, &fp);
+
+            for (size_t j=0; j<sizeof(channels)/sizeof(size_t); ++j)
+                for (size_t k=0; k<sizeof(block_sizes)/sizeof(size_t); ++k)
+                    call(spec->name, f, out, in, channels[j], block_sizes[k]);
+            PTEST_SEPARATOR;
+        }
+
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+            f[i].destroy();
+
+        // Bank of bell filters sharing the same set of biquad chains
+        dspu::FilterBank fb;
+        dspu::Filter bf[MAX_CHAINS];
+        fb.init(MAX_CHAINS);
+        for (size_t i=0; i<MAX_CHAINS; ++i)
+            bf[i].init(&fb);
+
+        fp.nType            = dspu::FLT_BT_RLC_BELL;
+        fp.nSlope           = 1;
+        for (size_t i=0; i<sizeof(chains)/sizeof(size_t); ++i)
+        {
+            const size_t n      = chains[i];
+            fb.begin();
+            for (size_t j=0; j<n; ++j)
+            {
+                fp.fFreq            = 20.0f * (j + 1);
+                bf[j].update(SRATE, &fp);
+                bf[j].rebuild();
+            }
+            fb.end(true);
+
+            for (size_t k=0; k<sizeof(block_sizes)/sizeof(size_t); ++k)
+                call(&fb, out[0], in[0], n, block_sizes[k]);
+            PTEST_SEPARATOR;
+        }
+
+        for (size_t i=0; i<MAX_CHAINS; ++i)
+            bf[i].destroy();
+        fb.destroy();
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/sampling/SamplePlayer.h>
+
+#define MAX_BLOCK       4096
+#define MAX_CHANNELS    2
+#define MAX_VOICES      32
+#define SAMPLE_LENGTH   0x10000
+#define LOOP_START      0x1000
+#define LOOP_END        0xf000
+#define XFADE_LENGTH    0x100
+
+static const size_t block_sizes[] = { 64, 256, 1024, MAX_BLOCK };
+static const size_t channels[] = { 1, MAX_CHANNELS };
+static const size_t voices[] = { 1, 8, MAX_VOICES };
+
+typedef struct loop_mode_t
+{
+    const char                 *name;
+    lsp::dspu::sample_loop_t    mode;
+} loop_mode_t;
+
+static const loop_mode_t loop_modes[] =
+{
+    { "LOOP_DIRECT",            lsp::dspu::SAMPLE_LOOP_DIRECT           },
+    { "LOOP_DIRECT_FULL_PP",    lsp::dspu::SAMPLE_LOOP_DIRECT_FULL_PP   },
+};
+
+PTEST_BEGIN("dspu.sampling", player, 2, 1000)
+
+    void call(const char *mode, dspu::SamplePlayer *sp, float * const *out, const float * const *in, size_t nvoices, size_t nch, size_t block)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s voices=%d ch=%d blk=%d", mode, int(nvoices), int(nch), int(block));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<nch; ++i)
+                sp[i].process(out[i], in[i], block);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *ptr          = alloc_aligned<float>(data, MAX_BLOCK * MAX_CHANNELS * 2, 64);
+        float *in[MAX_CHANNELS], *out[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            in[i]               = ptr;
+            out[i]              = &ptr[MAX_BLOCK];
+            ptr                += MAX_BLOCK * 2;
+            dsp::fill_zero(in[i], MAX_BLOCK);
+        }
+
+        dspu::PlaySettings ps;
+        ps.set_channel(0, 0);
+        ps.set_loop_xfade(dspu::SAMPLE_CROSSFADE_LINEAR, XFADE_LENGTH);
+
+        for (size_t i=0; i<sizeof(loop_modes)/sizeof(loop_mode_t); ++i)
+        {
+            const loop_mode_t *m = &loop_modes[i];
+            ps.set_loop_range(m->mode, LOOP_START, LOOP_END);
+
+            for (size_t j=0; j<sizeof(voices)/sizeof(size_t); ++j)
+            {
+                const size_t nvoices = voices[j];
+                dspu::SamplePlayer sp[MAX_CHANNELS];
+
+                // Looped voices never end, so the number of active playbacks stays constant
+                for (size_t k=0; k<MAX_CHANNELS; ++k)
+                {
+                    dspu::Sample *s = new dspu::Sample();
+                    s->init(1, SAMPLE_LENGTH, SAMPLE_LENGTH);
+                    randomize_sign(s->channel(0), SAMPLE_LENGTH);
+
+                    sp[k].init(1, MAX_VOICES);
+                    sp[k].bind(0, s);
+                    for (size_t l=0; l<nvoices; ++l)
+                    {
+                        ps.set_playback(l * 0x100, 0, 1.0f / nvoices);
+                        sp[k].play(&ps);
+                    }
+                }
+
+                for (size_t k=0; k<sizeof(channels)/sizeof(size_t); ++k)
+                    for (size_t l=0; l<sizeof(block_sizes)/sizeof(size_t); ++l)
+                        call(m->name, sp, out, in, nvoices, channels[k], block_sizes[l]);
+                PTEST_SEPARATOR;
+
+                for (size_t k=0; k<MAX_CHANNELS; ++k)
+                {
+                    sp[k].stop();
+                    sp[k].unbind_all();
+                    sp[k].destroy(true);
+                }
+            }
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/Analyzer.h>
+
+#define SRATE           48000
+#define MAX_BLOCK       4096
+#define MAX_CHANNELS    8
+#define MIN_RANK        10
+#define MAX_RANK        14
+
+static const size_t block_sizes[] = { 64, 256, 1024, MAX_BLOCK };
+static const size_t channels[] = { 1, 2, MAX_CHANNELS };
+
+PTEST_BEGIN("dspu.util", analyzer, 2, 1000)
+
+    void call(dspu::Analyzer *an, const float * const *in, size_t rank, size_t block)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "rank=%d ch=%d blk=%d", int(rank), int(an->get_channels()), int(block));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            an->process(in, block);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *ptr          = alloc_aligned<float>(data, MAX_BLOCK * MAX_CHANNELS, 64);
+        float *in[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            in[i]               = ptr;
+            ptr                += MAX_BLOCK;
+            randomize_sign(in[i], MAX_BLOCK);
+        }
+
+        for (size_t i=0; i<sizeof(channels)/sizeof(size_t); ++i)
+        {
+            dspu::Analyzer an;
+            an.init(channels[i], MAX_RANK, SRATE, 20.0f);
+            an.set_sample_rate(SRATE);
+            an.set_rate(20.0f);
+            an.set_reactivity(100.0f);
+            an.set_activity(true);
+
+            for (size_t rank=MIN_RANK; rank<=MAX_RANK; rank += 2)
+            {
+                an.set_rank(rank);
+                for (size_t j=0; j<sizeof(block_sizes)/sizeof(size_t); ++j)
+                    call(&an, in, rank, block_sizes[j]);
+                PTEST_SEPARATOR;
+            }
+
+            an.destroy();
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/Convolver.h>
+
+#define MAX_BLOCK       4096
+#define MAX_CHANNELS    8
+#define IR_LENGTH       0x10000
+
+static const size_t block_sizes[] = { 64, 512, MAX_BLOCK };
+static const size_t channels[] = { 1, 2, MAX_CHANNELS };
+
+PTEST_BEGIN("dspu.util", convolver, 1, 1000)
+
+    void call(dspu::Convolver *c, float * const *out, const float * const *in, size_t rank, size_t nch, size_t block)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "rank=%d ch=%d blk=%d", int(rank), int(nch), int(block));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<nch; ++i)
+                c[i].process(out[i], in[i], block);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *ptr          = alloc_aligned<float>(data, MAX_BLOCK * MAX_CHANNELS * 2 + IR_LENGTH, 64);
+        float *in[MAX_CHANNELS], *out[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            in[i]               = ptr;
+            out[i]              = &ptr[MAX_BLOCK];
+            ptr                += MAX_BLOCK * 2;
+            randomize_sign(in[i], MAX_BLOCK);
+        }
+
+        float *ir           = ptr;
+        randomize_sign(ir, IR_LENGTH);
+
+        dspu::Convolver c[MAX_CHANNELS];
+        for (size_t rank=CONVOLVER_RANK_MIN; rank<=CONVOLVER_RANK_MAX; ++rank)
+        {
+            // Use different phases for channels like multi-channel convolution processors do
+            for (size_t i=0; i<MAX_CHANNELS; ++i)
+                c[i].init(ir, IR_LENGTH, rank, float(i) / MAX_CHANNELS);
+
+            for (size_t j=0; j<sizeof(channels)/sizeof(size_t); ++j)
+                for (size_t k=0; k<sizeof(block_sizes)/sizeof(size_t); ++k)
+                    call(c, out, in, rank, channels[j], block_sizes[k]);
+            PTEST_SEPARATOR;
+        }
+
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+            c[i].destroy();
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/Crossover.h>
+
+#define SRATE           48000
+#define MAX_BLOCK       4096
+#define MAX_CHANNELS    8
+#define SLOPE           2
+
+static const size_t block_sizes[] = { 64, 256, 1024, MAX_BLOCK };
+static const size_t channels[] = { 1, 2, MAX_CHANNELS };
+static const size_t bands[] = { 2, 4, 8 };
+
+typedef struct xover_mode_t
+{
+    const char                     *name;
+    lsp::dspu::crossover_mode_t     mode;
+} xover_mode_t;
+
+static const xover_mode_t modes[] =
+{
+    { "CROSS_MODE_BT",  lsp::dspu::CROSS_MODE_BT    },
+    { "CROSS_MODE_MT",  lsp::dspu::CROSS_MODE_MT    },
+};
+
+PTEST_BEGIN("dspu.util", crossover, 2, 1000)
+
+    static void band_func(void *object, void *subject, size_t band, const float *data, size_t first, size_t count)
+    {
+        float *dst      = static_cast<float *>(subject);
+        dsp::copy(&dst[first], data, count);
+    }
+
+    void call(const char *mode, dspu::Crossover *xc, const float * const *in, size_t nbands, size_t nch, size_t block)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s bands=%d ch=%d blk=%d", mode, int(nbands), int(nch), int(block));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<nch; ++i)
+                xc[i].process(in[i], block);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *ptr          = alloc_aligned<float>(data, MAX_BLOCK * MAX_CHANNELS * 2, 64);
+        float *in[MAX_CHANNELS], *out[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            in[i]               = ptr;
+            out[i]              = &ptr[MAX_BLOCK];
+            ptr                += MAX_BLOCK * 2;
+            randomize_sign(in[i], MAX_BLOCK);
+        }
+
+        for (size_t i=0; i<sizeof(bands)/sizeof(size_t); ++i)
+        {
+            const size_t nbands = bands[i];
+            dspu::Crossover xc[MAX_CHANNELS];
+
+            for (size_t j=0; j<sizeof(modes)/sizeof(xover_mode_t); ++j)
+            {
+                const xover_mode_t *m   = &modes[j];
+
+                // All bands of the channel are written to the same output buffer
+                for (size_t k=0; k<MAX_CHANNELS; ++k)
+                {
+                    xc[k].init(nbands, MAX_BLOCK);
+                    xc[k].set_sample_rate(SRATE);
+                    for (size_t l=0; l<nbands - 1; ++l)
+                    {
+                        xc[k].set_slope(l, SLOPE);
+                        xc[k].set_frequency(l, 100.0f * (l + 1) * (l + 1));
+                        xc[k].set_mode(l, m->mode);
+                    }
+                    for (size_t l=0; l<nbands; ++l)
+                        xc[k].set_handler(l, band_func, NULL, out[k]);
+                }
+
+                for (size_t k=0; k<sizeof(channels)/sizeof(size_t); ++k)
+                    for (size_t l=0; l<sizeof(block_sizes)/sizeof(size_t); ++l)
+                        call(m->name, xc, in, nbands, channels[k], block_sizes[l]);
+                PTEST_SEPARATOR;
+
+                for (size_t k=0; k<MAX_CHANNELS; ++k)
+                    xc[k].destroy();
+            }
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
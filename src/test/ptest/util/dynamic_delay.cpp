@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/DynamicDelay.h>
+#include <lsp-plug.in/dsp-units/util/MultiDynamicDelay.h>
+
+#define MAX_DELAY       4800
+#define BLOCK_SIZE      1024
+#define MAX_VOICES      32
+
+static const size_t voices[] = { 1, 4, 16, MAX_VOICES };
+
+typedef struct interp_mode_t
+{
+    const char                 *name;
+    lsp::dspu::delay_interp_t   interp;
+} interp_mode_t;
+
+static const interp_mode_t modes[] =
+{
+    { "DI_NONE",        lsp::dspu::DI_NONE      },
+    { "DI_LINEAR",      lsp::dspu::DI_LINEAR    },
+    { "DI_CUBIC",       lsp::dspu::DI_CUBIC     },
+    { "DI_ALLPASS",     lsp::dspu::DI_ALLPASS   },
+};
+
+PTEST_BEGIN("dspu.util", dynamic_delay, 2, 1000)
+
+    void call_single(dspu::DynamicDelay *dl, float * const *out, const float *in,
+        const float * const *delay, const float *fgain, const float *fdelay, size_t nvoices)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "DynamicDelay voices=%d", int(nvoices));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<nvoices; ++i)
+                dl[i].process(out[i], in, delay[i], fgain, fdelay, BLOCK_SIZE);
+        );
+    }
+
+    void call_multi(const char *mode, dspu::MultiDynamicDelay *dl, float * const *out, const float *in,
+        const float * const *delay, const float *fgain, size_t nvoices)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "MultiDynamicDelay %s voices=%d fb=%s", mode, int(nvoices), (fgain != NULL) ? "true" : "false");
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            dl->process(out, in, delay, fgain, BLOCK_SIZE);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *ptr          = alloc_aligned<float>(data, BLOCK_SIZE * (MAX_VOICES * 2 + 3), 64);
+        float *in           = ptr;
+        float *fgain        = &ptr[BLOCK_SIZE];
+        float *fdelay       = &ptr[BLOCK_SIZE * 2];
+        float *out[MAX_VOICES], *delay[MAX_VOICES];
+        ptr                += BLOCK_SIZE * 3;
+
+        randomize_sign(in, BLOCK_SIZE);
+        dsp::fill(fgain, 0.01f, BLOCK_SIZE);
+        dsp::fill_zero(fdelay, BLOCK_SIZE);
+        for (size_t i=0; i<MAX_VOICES; ++i)
+        {
+            out[i]              = ptr;
+            delay[i]            = &ptr[BLOCK_SIZE];
+            ptr                += BLOCK_SIZE * 2;
+
+            // Slowly modulated fractional delay
+            for (size_t j=0; j<BLOCK_SIZE; ++j)
+                delay[i][j]         = 100.0f + 40.0f * i + j * 0.37f;
+        }
+
+        // Bank of single-voice delays
+        for (size_t i=0; i<sizeof(voices)/sizeof(size_t); ++i)
+        {
+            const size_t nvoices = voices[i];
+            dspu::DynamicDelay dl[MAX_VOICES];
+            for (size_t j=0; j<nvoices; ++j)
+                dl[j].init(MAX_DELAY);
+
+            call_single(dl, out, in, delay, fgain, fdelay, nvoices);
+
+            for (size_t j=0; j<nvoices; ++j)
+                dl[j].destroy();
+        }
+        PTEST_SEPARATOR;
+
+        // Multi-voice delay
+        for (size_t i=0; i<sizeof(modes)/sizeof(interp_mode_t); ++i)
+        {
+            const interp_mode_t *m  = &modes[i];
+
+            for (size_t j=0; j<sizeof(voices)/sizeof(size_t); ++j)
+            {
+                const size_t nvoices = voices[j];
+                dspu::MultiDynamicDelay dl;
+                dl.init(nvoices, MAX_DELAY);
+                dl.set_interpolation(m->interp);
+
+                call_multi(m->name, &dl, out, in, delay, NULL, nvoices);
+                call_multi(m->name, &dl, out, in, delay, fgain, nvoices);
+
+                dl.destroy();
+            }
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/MultiSpectralProcessor.h>
+
+#define MAX_RANK        13
+#define MAX_CHANNELS    16
+#define BLOCK_SIZE      (1 << (MAX_RANK - 1))
+
+static const size_t channels[] = { 2, 8, MAX_CHANNELS };
+static const size_t workers[] = { 0, 2, 4, lsp::dspu::MULTI_SPECTRAL_MAX_WORKERS };
+
+PTEST_BEGIN("dspu.util", multispectral_proc, 2, 1000)
+
+    static void spectral_func(void *object, void *subject, float * const * spectrum, size_t rank)
+    {
+    }
+
+    void call(float * const *out, const float * const *in, size_t nch, size_t nworkers)
+    {
+        dspu::MultiSpectralProcessor sp;
+        if (!sp.init(nch, MAX_RANK, nworkers))
+            return;
+
+        sp.set_rank(MAX_RANK);
+        sp.bind_handler(spectral_func, NULL, NULL);
+
+        char buf[80];
+        snprintf(buf, sizeof(buf), "rank=%d ch=%d workers=%d", int(MAX_RANK), int(nch), int(sp.workers()));
+        printf("Testing %s...\n", buf);
+
+        // The processor advances the bound pointers, so buffers are bound for each call
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<nch; ++i)
+                sp.bind(i, out[i], in[i]);
+            sp.process(BLOCK_SIZE);
+        );
+
+        sp.destroy();
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *ptr          = alloc_aligned<float>(data, BLOCK_SIZE * MAX_CHANNELS * 2, 64);
+        float *in[MAX_CHANNELS], *out[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            in[i]               = ptr;
+            out[i]              = &ptr[BLOCK_SIZE];
+            ptr                += BLOCK_SIZE * 2;
+            randomize_sign(in[i], BLOCK_SIZE);
+        }
+
+        for (size_t i=0; i<sizeof(channels)/sizeof(size_t); ++i)
+        {
+            for (size_t j=0; j<sizeof(workers)/sizeof(size_t); ++j)
+                call(out, in, channels[i], workers[j]);
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/MultiOversampler.h>
+#include <lsp-plug.in/dsp-units/util/Oversampler.h>
+
+#define SRATE           48000
+#define MAX_BLOCK       4096
+#define MAX_CHANNELS    8
+#define NUM_CHANNELS    (sizeof(channels)/sizeof(size_t))
+
+static const size_t block_sizes[] = { 256, MAX_BLOCK };
+static const size_t channels[] = { 1, 2, MAX_CHANNELS };
+
+typedef struct os_mode_t
+{
+    const char                 *name;
+    lsp::dspu::over_mode_t      mode;
+} os_mode_t;
+
+typedef struct os_filter_t
+{
+    const char                 *name;
+    lsp::dspu::over_filter_t    type;
+} os_filter_t;
+
+#define OS_MODE(x)      { #x, lsp::dspu::x }
+
+static const os_mode_t modes[] =
+{
+    OS_MODE(OM_NONE),
+    OS_MODE(OM_LANCZOS_2X2),
+    OS_MODE(OM_LANCZOS_2X3),
+    OS_MODE(OM_LANCZOS_2X4),
+    OS_MODE(OM_LANCZOS_2X12BIT),
+    OS_MODE(OM_LANCZOS_2X16BIT),
+    OS_MODE(OM_LANCZOS_2X24BIT),
+    OS_MODE(OM_LANCZOS_3X2),
+    OS_MODE(OM_LANCZOS_3X3),
+    OS_MODE(OM_LANCZOS_3X4),
+    OS_MODE(OM_LANCZOS_3X12BIT),
+    OS_MODE(OM_LANCZOS_3X16BIT),
+    OS_MODE(OM_LANCZOS_3X24BIT),
+    OS_MODE(OM_LANCZOS_4X2),
+    OS_MODE(OM_LANCZOS_4X3),
+    OS_MODE(OM_LANCZOS_4X4),
+    OS_MODE(OM_LANCZOS_4X12BIT),
+    OS_MODE(OM_LANCZOS_4X16BIT),
+    OS_MODE(OM_LANCZOS_4X24BIT),
+    OS_MODE(OM_LANCZOS_6X2),
+    OS_MODE(OM_LANCZOS_6X3),
+    OS_MODE(OM_LANCZOS_6X4),
+    OS_MODE(OM_LANCZOS_6X12BIT),
+    OS_MODE(OM_LANCZOS_6X16BIT),
+    OS_MODE(OM_LANCZOS_6X24BIT),
+    OS_MODE(OM_LANCZOS_8X2),
+    OS_MODE(OM_LANCZOS_8X3),
+    OS_MODE(OM_LANCZOS_8X4),
+    OS_MODE(OM_LANCZOS_8X12BIT),
+    OS_MODE(OM_LANCZOS_8X16BIT),
+    OS_MODE(OM_LANCZOS_8X24BIT),
+};
+
+#undef OS_MODE
+
+static const os_filter_t filter_types[] =
+{
+    { "iir",            lsp::dspu::OF_IIR           },
+    { "fir",            lsp::dspu::OF_FIR_LINEAR    },
+};
+
+PTEST_BEGIN("dspu.util", oversampler, 1, 1000)
+
+    void call(const char *mode, const char *filter, dspu::Oversampler *os, float * const *out, const float * const *in, size_t nch, size_t block)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s %s ch=%d blk=%d", mode, filter, int(nch), int(block));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<nch; ++i)
+                os[i].process(out[i], in[i], block);
+        );
+    }
+
+    void call_multi(const char *mode, const char *filter, dspu::MultiOversampler *mos, float * const *out, const float * const *in, size_t block)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "%s %s multi ch=%d blk=%d", mode, filter, int(mos->channels()), int(block));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            mos->process(out, in, block);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *ptr          = alloc_aligned<float>(data, MAX_BLOCK * MAX_CHANNELS * 2, 64);
+        float *in[MAX_CHANNELS], *out[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            in[i]               = ptr;
+            out[i]              = &ptr[MAX_BLOCK];
+            ptr                += MAX_BLOCK * 2;
+            randomize_sign(in[i], MAX_BLOCK);
+        }
+
+        dspu::Oversampler os[MAX_CHANNELS];
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+        {
+            os[i].init();
+            os[i].set_sample_rate(SRATE);
+            os[i].set_filtering(true);
+        }
+
+        dspu::MultiOversampler mos[NUM_CHANNELS];
+        for (size_t i=0; i<NUM_CHANNELS; ++i)
+        {
+            mos[i].init(channels[i]);
+            mos[i].set_sample_rate(SRATE);
+            mos[i].set_filtering(true);
+        }
+
+        for (size_t i=0; i<sizeof(modes)/sizeof(os_mode_t); ++i)
+        {
+            const os_mode_t *m  = &modes[i];
+            for (size_t j=0; j<sizeof(filter_types)/sizeof(os_filter_t); ++j)
+            {
+                const os_filter_t *f = &filter_types[j];
+                for (size_t k=0; k<MAX_CHANNELS; ++k)
+                {
+                    os[k].set_mode(m->mode);
+                    os[k].set_filter_type(f->type);
+                    os[k].update_settings();
+                }
+                for (size_t k=0; k<NUM_CHANNELS; ++k)
+                {
+                    mos[k].set_mode(m->mode);
+                    mos[k].set_filter_type(f->type);
+                    mos[k].update_settings();
+                }
+
+                for (size_t k=0; k<NUM_CHANNELS; ++k)
+                    for (size_t l=0; l<sizeof(block_sizes)/sizeof(size_t); ++l)
+                    {
+                        call(m->name, f->name, os, out, in, channels[k], block_sizes[l]);
+                        call_multi(m->name, f->name, &mos[k], out, in, block_sizes[l]);
+                    }
+            }
+            PTEST_SEPARATOR;
+        }
+
+        for (size_t i=0; i<MAX_CHANNELS; ++i)
+            os[i].destroy();
+        for (size_t i=0; i<NUM_CHANNELS; ++i)
+            mos[i].destroy();
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/ptest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/common/alloc.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/Sidechain.h>
+#include <lsp-plug.in/dsp-units/util/MultiSidechain.h>
+
+#define SRATE           48000
+#define BLOCK_SIZE      1024
+#define MAX_LANES       36
+#define REACTIVITY      10.0f
+
+static const size_t lanes[] = { 1, 6, 12, MAX_LANES };
+
+typedef struct sc_mode_t
+{
+    const char                 *name;
+    lsp::dspu::sidechain_mode_t mode;
+} sc_mode_t;
+
+static const sc_mode_t modes[] =
+{
+    { "SCM_PEAK",       lsp::dspu::SCM_PEAK     },
+    { "SCM_RMS",        lsp::dspu::SCM_RMS      },
+    { "SCM_LPF",        lsp::dspu::SCM_LPF      },
+    { "SCM_UNIFORM",    lsp::dspu::SCM_UNIFORM  },
+};
+
+PTEST_BEGIN("dspu.util", sidechain, 2, 1000)
+
+    void call_single(const char *mode, dspu::Sidechain *sc, float * const *out, const float * const *in, size_t nlanes)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "Sidechain %s lanes=%d", mode, int(nlanes));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            for (size_t i=0; i<nlanes; ++i)
+            {
+                const float *src = in[i];
+                sc[i].process(out[i], &src, BLOCK_SIZE);
+            }
+        );
+    }
+
+    void call_multi(const char *mode, dspu::MultiSidechain *sc, float * const *out, const float * const *in, size_t nlanes)
+    {
+        char buf[80];
+        snprintf(buf, sizeof(buf), "MultiSidechain %s lanes=%d", mode, int(nlanes));
+        printf("Testing %s...\n", buf);
+
+        PTEST_LOOP(buf,
+            sc->process(out, in, BLOCK_SIZE);
+        );
+    }
+
+    PTEST_MAIN
+    {
+        uint8_t *data       = NULL;
+        float *ptr          = alloc_aligned<float>(data, BLOCK_SIZE * MAX_LANES * 2, 64);
+        float *in[MAX_LANES], *out[MAX_LANES];
+        for (size_t i=0; i<MAX_LANES; ++i)
+        {
+            in[i]               = ptr;
+            out[i]              = &ptr[BLOCK_SIZE];
+            ptr                += BLOCK_SIZE * 2;
+            randomize_sign(in[i], BLOCK_SIZE);
+        }
+
+        for (size_t i=0; i<sizeof(modes)/sizeof(sc_mode_t); ++i)
+        {
+            const sc_mode_t *m  = &modes[i];
+
+            for (size_t j=0; j<sizeof(lanes)/sizeof(size_t); ++j)
+            {
+                const size_t nlanes = lanes[j];
+
+                dspu::Sidechain sc[MAX_LANES];
+                for (size_t k=0; k<nlanes; ++k)
+                {
+                    sc[k].init(1, REACTIVITY);
+                    sc[k].set_sample_rate(SRATE);
+                    sc[k].set_mode(m->mode);
+                    sc[k].set_reactivity(REACTIVITY);
+                }
+
+                dspu::MultiSidechain msc;
+                msc.init(nlanes, REACTIVITY);
+                msc.set_sample_rate(SRATE);
+                msc.set_mode(m->mode);
+                msc.set_reactivity(REACTIVITY);
+
+                call_single(m->name, sc, out, in, nlanes);
+                call_multi(m->name, &msc, out, in, nlanes);
+
+                for (size_t k=0; k<nlanes; ++k)
+                    sc[k].destroy();
+                msc.destroy();
+            }
+            PTEST_SEPARATOR;
+        }
+
+        free_aligned(data);
+    }
+
+PTEST_END
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/dsp-units/3d/rt/bvh.h>
+#include <lsp-plug.in/dsp-units/3d/rt/context.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/stdlib/stdlib.h>
+
+#define TRIANGLES       5000
+
+UTEST_BEGIN("dspu.3d", bvh)
+
+    float rnd()
+    {
+        return (rand() % 2001) * 0.01f - 10.0f;
+    }
+
+    void set_point(dsp::point3d_t *p, float x, float y, float z)
+    {
+        p->x    = x;
+        p->y    = y;
+        p->z    = z;
+        p->w    = 1.0f;
+    }
+
+    bool inside(const dsp::point3d_t *p, const dsp::vector3d_t *pl)
+    {
+        for (size_t i=0; i<3; ++i, ++pl)
+            if ((pl->dx * p->x + pl->dy * p->y + pl->dz * p->z + pl->dw) < 0.0f)
+                return false;
+        return true;
+    }
+
+    bool in_box(const dsp::point3d_t *p, const dspu::rtx::bvh_node_t *node)
+    {
+        return (p->x >= node->min[0]) && (p->x <= node->max[0]) &&
+               (p->y >= node->min[1]) && (p->y <= node->max[1]) &&
+               (p->z >= node->min[2]) && (p->z <= node->max[2]);
+    }
+
+    UTEST_MAIN
+    {
+        dspu::rtx::triangle_t *vt = static_cast<dspu::rtx::triangle_t *>(malloc(sizeof(dspu::rtx::triangle_t) * TRIANGLES));
+        UTEST_ASSERT(vt != NULL);
+        lsp_finally { free(vt); };
+        size_t *seen = static_cast<size_t *>(malloc(sizeof(size_t) * TRIANGLES));
+        UTEST_ASSERT(seen != NULL);
+        lsp_finally { free(seen); };
+
+        // Generate small triangles randomly spread in the space
+        for (size_t i=0; i<TRIANGLES; ++i)
+        {
+            dspu::rtx::triangle_t *t  = &vt[i];
+            float x = rnd(), y = rnd(), z = rnd();
+            set_point(&t->v[0], x, y, z);
+            set_point(&t->v[1], x + 0.5f, y, z);
+            set_point(&t->v[2], x, y + 0.5f, z + 0.25f);
+            t->oid              = i;
+            t->face             = 0;
+            seen[i]             = 0;
+        }
+
+        // Build the hierarchy
+        lltl::darray<dspu::rtx::bvh_node_t> bvh;
+        UTEST_ASSERT(dspu::rt::build_bvh(&bvh, vt, TRIANGLES) == STATUS_OK);
+        UTEST_ASSERT(bvh.size() > 1);
+
+        // Prepare the view
+        dspu::rt::context_t ctx;
+        set_point(&ctx.view.s, 0.0f, 0.0f, 0.0f);
+        set_point(&ctx.view.p[0], 1.0f, 0.0f, 1.0f);
+        set_point(&ctx.view.p[1], 0.0f, 1.0f, 1.0f);
+        set_point(&ctx.view.p[2], 0.0f, 0.0f, 1.0f);
+        ctx.init_view();
+
+        dsp::vector3d_t pl[3];
+        dspu::rt::bvh_view_planes(pl, &ctx.view);
+
+        // Validate leaves and children of inner nodes
+        for (size_t i=0, n=bvh.size(); i<n; ++i)
+        {
+            const dspu::rtx::bvh_node_t *node = bvh.uget(i);
+            if (node->count <= 0)
+            {
+                UTEST_ASSERT(node->first + 1 < n);
+                for (size_t j=0; j<2; ++j)
+                {
+                    const dspu::rtx::bvh_node_t *c = bvh.uget(node->first + j);
+                    for (size_t k=0; k<3; ++k)
+                    {
+                        UTEST_ASSERT(c->min[k] >= node->min[k]);
+                        UTEST_ASSERT(c->max[k] <= node->max[k]);
+                    }
+                }
+                continue;
+            }
+
+            const bool visible = dspu::rt::bvh_check_node(node, pl);
+            for (size_t j=node->first, m=node->first + node->count; j<m; ++j)
+            {
+                const dspu::rtx::triangle_t *t = &vt[j];
+                ++seen[t->oid];
+
+                for (size_t k=0; k<3; ++k)
+                {
+                    UTEST_ASSERT_MSG(in_box(&t->v[k], node), "Triangle %d is out of the leaf bounds", int(t->oid));
+                    if (inside(&t->v[k], pl))
+                        UTEST_ASSERT_MSG(visible, "Leaf %d with visible triangle %d has been rejected", int(i), int(t->oid));
+                }
+            }
+        }
+
+        // Each triangle should be referenced exactly once
+        for (size_t i=0; i<TRIANGLES; ++i)
+            UTEST_ASSERT_MSG(seen[i] == 1, "Triangle %d referenced %d times", int(i), int(seen[i]));
+    }
+
+UTEST_END;
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/dsp-units/3d/RayTrace3D.h>
+#include <lsp-plug.in/dsp-units/3d/Scene3D.h>
+#include <lsp-plug.in/dsp-units/sampling/Sample.h>
+#include <lsp-plug.in/io/InMemoryStream.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+#define SRATE           48000
+#define THREADS         4
+
+UTEST_BEGIN("dspu.3d", raytrace)
+    UTEST_TIMELIMIT(60)
+
+    void trace(dspu::Sample *dst, size_t threads)
+    {
+        // Closed room of 4 x 3 x 2.5 meters with normals looking inside
+        static const char *room =
+            "o Room\n"
+            "v -2 -1.5 0\n"
+            "v 2 -1.5 0\n"
+            "v 2 1.5 0\n"
+            "v -2 1.5 0\n"
+            "v -2 -1.5 2.5\n"
+            "v 2 -1.5 2.5\n"
+            "v 2 1.5 2.5\n"
+            "v -2 1.5 2.5\n"
+            "vn 0 0 1\n"
+            "vn 0 0 -1\n"
+            "vn 1 0 0\n"
+            "vn -1 0 0\n"
+            "vn 0 1 0\n"
+            "vn 0 -1 0\n"
+            "f 1//1 2//1 3//1 4//1\n"
+            "f 5//2 8//2 7//2 6//2\n"
+            "f 1//3 4//3 8//3 5//3\n"
+            "f 2//4 6//4 7//4 3//4\n"
+            "f 1//5 5//5 6//5 2//5\n"
+            "f 4//6 3//6 7//6 8//6\n";
+
+        dspu::Scene3D scene;
+        io::InMemoryStream is;
+        is.wrap(room, strlen(room));
+        UTEST_ASSERT(scene.load(&is, WRAP_CLOSE) == STATUS_OK);
+        UTEST_ASSERT(scene.num_objects() == 1);
+
+        dspu::RayTrace3D rt;
+        UTEST_ASSERT(rt.init() == STATUS_OK);
+        rt.set_sample_rate(SRATE);
+        rt.set_energy_threshold(1e-3f);
+        rt.set_normalize(false);
+        UTEST_ASSERT(rt.set_scene(&scene, false) == STATUS_OK);
+
+        // Highly absorbing opaque walls keep the number of reflections small
+        dspu::rt::material_t m;
+        m.absorption[0]     = 0.5f;
+        m.absorption[1]     = 0.5f;
+        m.diffusion[0]      = 1.0f;
+        m.diffusion[1]      = 1.0f;
+        m.dispersion[0]     = 1.0f;
+        m.dispersion[1]     = 1.0f;
+        m.transparency[0]   = 0.0f;
+        m.transparency[1]   = 0.0f;
+        m.permeability      = 12.88f;
+        UTEST_ASSERT(rt.set_material(0, &m) == STATUS_OK);
+
+        // Configure the source
+        dspu::room_source_config_t scfg;
+        dspu::rt_source_settings_t src;
+        dsp::init_point_xyz(&scfg.sPos, 0.5f, 0.2f, 1.2f);
+        scfg.fYaw           = 0.0f;
+        scfg.fPitch         = 0.0f;
+        scfg.fRoll          = 0.0f;
+        scfg.enType         = dspu::RT_AS_ICOSPHERE;
+        scfg.fSize          = 0.25f;
+        scfg.fHeight        = 0.25f;
+        scfg.fAngle         = 50.0f;
+        scfg.fCurvature     = 0.0f;
+        scfg.fAmplitude     = 1.0f;
+        UTEST_ASSERT(dspu::rt_configure_source(&src, &scfg) == STATUS_OK);
+        UTEST_ASSERT(rt.add_source(&src) == STATUS_OK);
+
+        // Configure the capture
+        dspu::room_capture_config_t ccfg;
+        dspu::rt_capture_settings_t cap[2];
+        size_t ncap         = 0;
+        dsp::init_point_xyz(&ccfg.sPos, -1.0f, -0.4f, 1.2f);
+        ccfg.fYaw           = 0.0f;
+        ccfg.fPitch         = 0.0f;
+        ccfg.fRoll          = 0.0f;
+        ccfg.fCapsule       = 10.0f;
+        ccfg.sConfig        = dspu::RT_CC_MONO;
+        ccfg.fAngle         = 90.0f;
+        ccfg.fDistance      = 0.0f;
+        ccfg.enDirection    = dspu::RT_AC_OMNI;
+        ccfg.enSide         = dspu::RT_AC_OMNI;
+        UTEST_ASSERT(dspu::rt_configure_capture(&ncap, cap, &ccfg) == STATUS_OK);
+        UTEST_ASSERT(ncap == 1);
+
+        const ssize_t id    = rt.add_capture(&cap[0]);
+        UTEST_ASSERT(id >= 0);
+        UTEST_ASSERT(dst->init(1, SRATE, 0));
+        UTEST_ASSERT(rt.bind_capture(id, dst, 0, -1, -1) == STATUS_OK);
+
+        // Perform the ray tracing
+        UTEST_ASSERT(rt.process(threads, 1.0f) == STATUS_OK);
+        rt.destroy(false);
+    }
+
+    UTEST_MAIN
+    {
+        dspu::Sample s1, sn;
+
+        printf("Tracing the scene using 1 thread...\n");
+        trace(&s1, 1);
+        printf("Tracing the scene using %d threads...\n", int(THREADS));
+        trace(&sn, THREADS);
+
+        // The set of reflections does not depend on the number of threads, only the order of
+        // summation of the captured energy does
+        UTEST_ASSERT(s1.length() > 0);
+        UTEST_ASSERT_MSG(s1.length() == sn.length(), "Length mismatch: %d vs %d", int(s1.length()), int(sn.length()));
+
+        const float *b1     = s1.channel(0);
+        const float *bn     = sn.channel(0);
+        const float peak    = dsp::abs_max(b1, s1.length());
+        UTEST_ASSERT(peak > 0.0f);
+
+        for (size_t i=0, n=s1.length(); i<n; ++i)
+        {
+            const float diff    = fabsf(b1[i] - bn[i]);
+            UTEST_ASSERT_MSG(diff <= peak * 1e-4f,
+                "Sample %d differs: %g vs %g, peak=%g", int(i), b1[i], bn[i], peak);
+        }
+    }
+
+UTEST_END
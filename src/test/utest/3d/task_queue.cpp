@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 17 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/dsp-units/3d/rt/queue.h>
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/stdlib/stdlib.h>
+
+#define ITEMS           0x20000
+#define THIEVES         3
+#define BURST           0x200
+
+UTEST_BEGIN("dspu.3d", task_queue)
+
+    typedef struct state_t
+    {
+        dspu::rt::context_t    *vItems;     // Items passed through the queue
+        volatile atomic_t      *vTaken;     // Number of times each item has been taken
+        volatile atomic_t       nDone;      // The owner thread has processed all items
+    } state_t;
+
+    class Thief: public ipc::Thread
+    {
+        private:
+            dspu::rt::task_queue_t     *pQueue;
+            state_t                    *pState;
+
+        public:
+            size_t                      nStolen;
+
+        public:
+            explicit Thief(dspu::rt::task_queue_t *queue, state_t *state)
+            {
+                pQueue      = queue;
+                pState      = state;
+                nStolen     = 0;
+            }
+
+        public:
+            virtual status_t run() override
+            {
+                while (true)
+                {
+                    // The queue stays empty after the owner has finished, so read the flag before stealing
+                    const bool done         = atomic_load(&pState->nDone) != 0;
+                    dspu::rt::context_t *ctx = pQueue->steal();
+                    if (ctx != NULL)
+                    {
+                        atomic_add(&pState->vTaken[ctx - pState->vItems], 1);
+                        ++nStolen;
+                    }
+                    else if (done)
+                        break;
+                    else
+                        ipc::Thread::yield();
+                }
+
+                return STATUS_OK;
+            }
+    };
+
+    void test_single_thread()
+    {
+        printf("Testing single-threaded access...\n");
+
+        dspu::rt::context_t *items = new dspu::rt::context_t[2];
+        UTEST_ASSERT(items != NULL);
+        lsp_finally { delete [] items; };
+
+        dspu::rt::task_queue_t q;
+        UTEST_ASSERT(q.empty());
+        UTEST_ASSERT(q.pop() == NULL);
+        UTEST_ASSERT(q.steal() == NULL);
+
+        // The queue should accept exactly CAPACITY items
+        for (size_t i=0; i<dspu::rt::task_queue_t::CAPACITY; ++i)
+            UTEST_ASSERT(q.push(&items[i & 1]));
+        UTEST_ASSERT(!q.push(&items[0]));
+        UTEST_ASSERT(!q.empty());
+
+        // The owner takes items from the bottom, thieves from the top
+        UTEST_ASSERT(q.pop() == &items[1]);
+        UTEST_ASSERT(q.steal() == &items[0]);
+        UTEST_ASSERT(q.pop() == &items[0]);
+        UTEST_ASSERT(q.steal() == &items[1]);
+        UTEST_ASSERT(q.push(&items[1]));
+
+        // Drain the queue
+        size_t count = 0;
+        while (q.pop() != NULL)
+            ++count;
+        UTEST_ASSERT(count == dspu::rt::task_queue_t::CAPACITY - 3);
+        UTEST_ASSERT(q.empty());
+        UTEST_ASSERT(q.pop() == NULL);
+        UTEST_ASSERT(q.steal() == NULL);
+    }
+
+    void test_stress()
+    {
+        printf("Testing concurrent access of %d threads to %d items...\n", int(THIEVES + 1), int(ITEMS));
+
+        state_t st;
+        st.vItems       = new dspu::rt::context_t[ITEMS];
+        UTEST_ASSERT(st.vItems != NULL);
+        lsp_finally { delete [] st.vItems; };
+        st.vTaken       = new atomic_t[ITEMS];
+        UTEST_ASSERT(st.vTaken != NULL);
+        lsp_finally { delete [] st.vTaken; };
+        st.nDone        = 0;
+        for (size_t i=0; i<ITEMS; ++i)
+            st.vTaken[i]    = 0;
+
+        dspu::rt::task_queue_t q;
+        Thief *thieves[THIEVES];
+        for (size_t i=0; i<THIEVES; ++i)
+        {
+            thieves[i]      = new Thief(&q, &st);
+            UTEST_ASSERT(thieves[i] != NULL);
+            UTEST_ASSERT(thieves[i]->start() == STATUS_OK);
+        }
+
+        // Push items in bursts and pop some of them like the owner of the queue does
+        size_t popped = 0;
+        for (size_t i=0; i<ITEMS; )
+        {
+            for (size_t n = rand() % BURST; (n > 0) && (i < ITEMS); --n)
+            {
+                if (!q.push(&st.vItems[i]))
+                    break;
+                ++i;
+            }
+
+            for (size_t n = rand() % BURST; n > 0; --n)
+            {
+                dspu::rt::context_t *ctx = q.pop();
+                if (ctx == NULL)
+                    break;
+                atomic_add(&st.vTaken[ctx - st.vItems], 1);
+                ++popped;
+            }
+        }
+
+        // Take the rest of items and stop the thieves
+        for (dspu::rt::context_t *ctx; (ctx = q.pop()) != NULL; ++popped)
+            atomic_add(&st.vTaken[ctx - st.vItems], 1);
+        atomic_store(&st.nDone, 1);
+
+        size_t stolen = 0;
+        for (size_t i=0; i<THIEVES; ++i)
+        {
+            UTEST_ASSERT(thieves[i]->join() == STATUS_OK);
+            stolen         += thieves[i]->nStolen;
+            delete thieves[i];
+        }
+        printf("  popped %d items, stolen %d items\n", int(popped), int(stolen));
+
+        // Each item should be taken exactly once
+        UTEST_ASSERT(q.empty());
+        UTEST_ASSERT(popped + stolen == ITEMS);
+        for (size_t i=0; i<ITEMS; ++i)
+            UTEST_ASSERT_MSG(st.vTaken[i] == 1, "Item %d has been taken %d times", int(i), int(st.vTaken[i]));
+    }
+
+    UTEST_MAIN
+    {
+        test_single_thread();
+        test_stress();
+    }
+
+UTEST_END
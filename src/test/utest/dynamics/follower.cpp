@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/dsp-units/dynamics/Compressor.h>
+#include <lsp-plug.in/dsp-units/dynamics/DynamicProcessor.h>
+#include <lsp-plug.in/dsp-units/dynamics/Expander.h>
+#include <lsp-plug.in/dsp-units/dynamics/Gate.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#define SRATE           48000
+#define LANES           11
+#define BUF_SIZE        4000
+#define BLOCK_SIZE      357
+
+UTEST_BEGIN("dspu.dynamics", follower)
+
+    template <class T>
+        void compare(const char *name, T *a, T *b, bool per_sample)
+        {
+            FloatBuffer *in[LANES];
+            FloatBuffer *out1[LANES], *env1[LANES];
+            FloatBuffer *out2[LANES], *env2[LANES];
+            T *list[LANES];
+            float *vout[LANES], *venv[LANES];
+            const float *vin[LANES];
+
+            printf("Testing lane-parallel %s...\n", name);
+
+            for (size_t i=0; i<LANES; ++i)
+            {
+                in[i]       = new FloatBuffer(BUF_SIZE);
+                out1[i]     = new FloatBuffer(BUF_SIZE);
+                env1[i]     = new FloatBuffer(BUF_SIZE);
+                out2[i]     = new FloatBuffer(BUF_SIZE);
+                env2[i]     = new FloatBuffer(BUF_SIZE);
+                list[i]     = &b[i];
+
+                // Generate bursts of signal separated with silence
+                in[i]->randomize(0.0f, 2.0f);
+                for (size_t j=0; j<BUF_SIZE; j += 500 + i * 20)
+                    dsp::fill_zero(in[i]->data(j), lsp_min(size_t(200 + i * 10), BUF_SIZE - j));
+            }
+
+            // Reference processing
+            for (size_t i=0; i<LANES; ++i)
+            {
+                if (per_sample)
+                {
+                    for (size_t j=0; j<BUF_SIZE; ++j)
+                        out1[i]->data()[j]  = a[i].process(env1[i]->data(j), in[i]->get(j));
+                }
+                else
+                {
+                    for (size_t j=0; j<BUF_SIZE; j += BLOCK_SIZE)
+                        a[i].process(out1[i]->data(j), env1[i]->data(j), in[i]->data(j), lsp_min(size_t(BLOCK_SIZE), BUF_SIZE - j));
+                }
+            }
+
+            // Lane-parallel processing
+            for (size_t j=0; j<BUF_SIZE; j += BLOCK_SIZE)
+            {
+                for (size_t i=0; i<LANES; ++i)
+                {
+                    vin[i]      = in[i]->data(j);
+                    vout[i]     = out2[i]->data(j);
+                    venv[i]     = (i & 1) ? NULL : env2[i]->data(j);
+                }
+                T::process(list, vout, venv, vin, LANES, lsp_min(size_t(BLOCK_SIZE), BUF_SIZE - j));
+            }
+
+            // Check results
+            for (size_t i=0; i<LANES; ++i)
+            {
+                UTEST_ASSERT_MSG(out1[i]->valid(), "Output buffer 1 corrupted");
+                UTEST_ASSERT_MSG(out2[i]->valid(), "Output buffer 2 corrupted");
+                UTEST_ASSERT_MSG(env2[i]->valid(), "Envelope buffer 2 corrupted");
+
+                if ((!(i & 1)) && (!env2[i]->equals_relative(*env1[i], 1e-5)))
+                {
+                    size_t index = env2[i]->last_diff();
+                    UTEST_FAIL_MSG("Envelope of lane %d differs at sample=%d: %.6f vs %.6f",
+                            int(i), int(index), env1[i]->get(index), env2[i]->get(index));
+                }
+                if (!out2[i]->equals_relative(*out1[i], 1e-5))
+                {
+                    size_t index = out2[i]->last_diff();
+                    UTEST_FAIL_MSG("Gain of lane %d differs at sample=%d: %.6f vs %.6f",
+                            int(i), int(index), out1[i]->get(index), out2[i]->get(index));
+                }
+            }
+
+            for (size_t i=0; i<LANES; ++i)
+            {
+                delete in[i];
+                delete out1[i];
+                delete env1[i];
+                delete out2[i];
+                delete env2[i];
+            }
+        }
+
+    void test_compressor()
+    {
+        dspu::Compressor a[LANES], b[LANES];
+
+        for (size_t i=0; i<LANES; ++i)
+        {
+            dspu::Compressor *c[2] = { &a[i], &b[i] };
+            for (size_t j=0; j<2; ++j)
+            {
+                c[j]->set_sample_rate(SRATE);
+                c[j]->set_mode((i % 3 == 0) ? dspu::CM_DOWNWARD : (i % 3 == 1) ? dspu::CM_UPWARD : dspu::CM_BOOSTING);
+                c[j]->set_threshold(0.25f + 0.05f * i, 0.1f + 0.02f * i);
+                c[j]->set_timings(1.0f + i, 10.0f + 5.0f * i);
+                c[j]->set_hold((i & 1) ? 2.0f : 0.0f);
+                c[j]->set_ratio(2.0f + i);
+                c[j]->set_knee(0.5f);
+            }
+        }
+
+        compare("Compressor", a, b, false);
+    }
+
+    void test_expander()
+    {
+        dspu::Expander a[LANES], b[LANES];
+
+        for (size_t i=0; i<LANES; ++i)
+        {
+            dspu::Expander *c[2] = { &a[i], &b[i] };
+            for (size_t j=0; j<2; ++j)
+            {
+                c[j]->set_sample_rate(SRATE);
+                c[j]->set_mode((i & 1) ? dspu::EM_UPWARD : dspu::EM_DOWNWARD);
+                c[j]->set_threshold(0.25f + 0.05f * i, 0.1f + 0.02f * i);
+                c[j]->set_timings(1.0f + i, 10.0f + 5.0f * i);
+                c[j]->set_hold((i % 3) * 1.5f);
+                c[j]->set_ratio(1.5f + i);
+                c[j]->set_knee(0.5f);
+            }
+        }
+
+        compare("Expander", a, b, false);
+    }
+
+    void test_gate()
+    {
+        dspu::Gate a[LANES], b[LANES];
+
+        for (size_t i=0; i<LANES; ++i)
+        {
+            dspu::Gate *c[2] = { &a[i], &b[i] };
+            for (size_t j=0; j<2; ++j)
+            {
+                c[j]->set_sample_rate(SRATE);
+                c[j]->set_threshold(0.5f + 0.02f * i, 0.2f + 0.01f * i);
+                c[j]->set_zone(0.5f, 0.5f);
+                c[j]->set_reduction(0.01f);
+                c[j]->set_timings(1.0f + i, 10.0f + 5.0f * i);
+                c[j]->set_hold((i & 1) ? 3.0f : 0.0f);
+                c[j]->update_settings();
+            }
+        }
+
+        compare("Gate", a, b, true);
+    }
+
+    void test_dynamic_processor()
+    {
+        dspu::DynamicProcessor a[LANES], b[LANES];
+
+        for (size_t i=0; i<LANES; ++i)
+        {
+            dspu::DynamicProcessor *c[2] = { &a[i], &b[i] };
+            for (size_t j=0; j<2; ++j)
+            {
+                c[j]->set_sample_rate(SRATE);
+                c[j]->set_in_ratio(1.0f);
+                c[j]->set_out_ratio(0.5f);
+                c[j]->set_dot(0, 0.1f, 0.1f, 0.5f);
+                c[j]->set_dot(1, 0.5f + 0.02f * i, 0.3f, 0.5f);
+                for (size_t k=0; k<DYNAMIC_PROCESSOR_RANGES; ++k)
+                {
+                    c[j]->set_attack_time(k, 1.0f + k + i);
+                    c[j]->set_release_time(k, 10.0f + 5.0f * k + i);
+                }
+                for (size_t k=0; k<i % DYNAMIC_PROCESSOR_DOTS; ++k)
+                {
+                    c[j]->set_attack_level(k, 0.8f - 0.15f * k);
+                    c[j]->set_release_level(k, 0.1f + 0.2f * k);
+                }
+                c[j]->set_hold((i & 1) ? 2.0f : 0.0f);
+                c[j]->update_settings();
+            }
+        }
+
+        compare("DynamicProcessor", a, b, false);
+    }
+
+    UTEST_MAIN
+    {
+        test_compressor();
+        test_expander();
+        test_gate();
+        test_dynamic_processor();
+    }
+UTEST_END;
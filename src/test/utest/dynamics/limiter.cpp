@@ -34,6 +34,11 @@
 
 UTEST_BEGIN("dspu.dynamics", limiter)
 
+    static float randf(float min, float max)
+    {
+        return min + (max - min) * (float(rand()) / RAND_MAX);
+    }
+
     void test_triangle_peak()
     {
         FloatBuffer in(BUF_SIZE);
@@ -175,10 +180,137 @@ UTEST_BEGIN("dspu.dynamics", limiter)
         l.destroy();
     }
 
+    void test_engines()
+    {
+        static const dspu::limiter_mode_t modes[] =
+        {
+            dspu::LM_HERM_THIN, dspu::LM_HERM_WIDE, dspu::LM_HERM_TAIL, dspu::LM_HERM_DUCK,
+            dspu::LM_EXP_THIN, dspu::LM_EXP_WIDE, dspu::LM_EXP_TAIL, dspu::LM_EXP_DUCK,
+            dspu::LM_LINE_THIN, dspu::LM_LINE_WIDE, dspu::LM_LINE_TAIL, dspu::LM_LINE_DUCK
+        };
+        static const dspu::limiter_engine_t engines[] =
+        {
+            dspu::LE_ITERATIVE, dspu::LE_SINGLE_PASS
+        };
+
+        FloatBuffer in(BUF_SIZE * 4);
+        FloatBuffer out(BUF_SIZE * 4);
+        FloatBuffer gain(BUF_SIZE * 4);
+
+        in.randomize(0.0f, 2.0f);
+
+        for (size_t i=0; i<sizeof(modes)/sizeof(modes[0]); ++i)
+            for (size_t j=0; j<sizeof(engines)/sizeof(engines[0]); ++j)
+            {
+                printf("Testing mode=%d, engine=%d...\n", int(modes[i]), int(engines[j]));
+
+                dspu::Limiter l;
+                dspu::Delay d;
+
+                UTEST_ASSERT(l.init(SRATE * OVERSAMPLE, 20.0f));
+                UTEST_ASSERT(d.init(20.0f * SRATE * 4));
+
+                l.set_sample_rate(SRATE);
+                l.set_mode(modes[i]);
+                l.set_engine(engines[j]);
+                UTEST_ASSERT(l.get_engine() == engines[j]);
+                l.set_knee(1.0f);
+                l.set_threshold(0.5f, true);
+                l.set_attack(1.5);
+                l.set_release(1.5);
+                l.set_lookahead(5); // 5 ms lookahead
+                l.update_settings();
+                d.set_delay(l.get_latency());
+
+                l.process(gain, in, BUF_SIZE * 4);
+                d.process(out, in, BUF_SIZE * 4);
+                dsp::mul2(out, gain, BUF_SIZE * 4);
+
+                UTEST_ASSERT(gain.valid());
+                UTEST_ASSERT(out.valid());
+                UTEST_ASSERT_MSG(dsp::max(out, BUF_SIZE * 4) <= 0.5f + 1e-5f, "Peak %f over threshold", dsp::max(out, BUF_SIZE * 4));
+                UTEST_ASSERT(dsp::min(gain, BUF_SIZE * 4) >= 0.0f);
+                UTEST_ASSERT(dsp::max(gain, BUF_SIZE * 4) <= 1.0f);
+
+                l.destroy();
+            }
+    }
+
+    void process_engine(FloatBuffer &gain, FloatBuffer &in, dspu::limiter_mode_t mode, dspu::limiter_engine_t engine)
+    {
+        dspu::Limiter l;
+
+        UTEST_ASSERT(l.init(SRATE * OVERSAMPLE, 20.0f));
+
+        l.set_sample_rate(SRATE);
+        l.set_mode(mode);
+        l.set_engine(engine);
+        l.set_knee(1.0f);
+        l.set_threshold(0.5f, true);
+        l.set_attack(1.5);
+        l.set_release(1.5);
+        l.set_lookahead(5); // 5 ms lookahead
+        l.update_settings();
+
+        l.process(gain, in, BUF_SIZE * 4);
+        UTEST_ASSERT(gain.valid());
+
+        l.destroy();
+    }
+
+    void compare_engines(const char *label, size_t min_dist, size_t max_dist, float max_diff, float mean_diff)
+    {
+        static const dspu::limiter_mode_t modes[] =
+        {
+            dspu::LM_HERM_THIN, dspu::LM_HERM_WIDE, dspu::LM_HERM_TAIL, dspu::LM_HERM_DUCK,
+            dspu::LM_EXP_THIN, dspu::LM_EXP_WIDE, dspu::LM_EXP_TAIL, dspu::LM_EXP_DUCK,
+            dspu::LM_LINE_THIN, dspu::LM_LINE_WIDE, dspu::LM_LINE_TAIL, dspu::LM_LINE_DUCK
+        };
+
+        FloatBuffer in(BUF_SIZE * 4);
+        FloatBuffer g1(BUF_SIZE * 4);
+        FloatBuffer g2(BUF_SIZE * 4);
+
+        // Low-level noise with peaks over the threshold
+        for (size_t i=0; i<BUF_SIZE * 4; ++i)
+            in[i]       = randf(-0.2f, 0.2f);
+        for (size_t i=min_dist; i<BUF_SIZE * 4; i += min_dist + rand() % (max_dist - min_dist))
+            in[i]       = randf(0.6f, 2.0f);
+
+        for (size_t i=0; i<sizeof(modes)/sizeof(modes[0]); ++i)
+        {
+            printf("Comparing engines for %s peaks, mode=%d...\n", label, int(modes[i]));
+
+            process_engine(g1, in, modes[i], dspu::LE_ITERATIVE);
+            process_engine(g2, in, modes[i], dspu::LE_SINGLE_PASS);
+
+            float diff = 0.0f, sum = 0.0f;
+            for (size_t j=0; j<BUF_SIZE * 4; ++j)
+            {
+                const float d   = fabsf(g1[j] - g2[j]);
+                diff            = lsp_max(diff, d);
+                sum            += d;
+            }
+            sum        /= BUF_SIZE * 4;
+
+            UTEST_ASSERT_MSG(diff <= max_diff,
+                "Gain curves differ too much for mode=%d: max difference %g > %g", int(modes[i]), diff, max_diff);
+            UTEST_ASSERT_MSG(sum <= mean_diff,
+                "Gain curves differ too much for mode=%d: mean difference %g > %g", int(modes[i]), sum, mean_diff);
+        }
+    }
+
     UTEST_MAIN
     {
         test_triangle_peak();
         test_trapezoid_peak();
+        test_engines();
+
+        // The patches of isolated peaks do not overlap, both engines should produce the same gain curve
+        compare_engines("isolated", 400, 800, 1e-4f, 1e-6f);
+        // The single-pass engine takes the maximum of overlapping patches while the iterative engine
+        // multiplies them, the difference is local and is limited by the depth of the patch
+        compare_engines("overlapping", 100, 800, 0.5f, 2e-3f);
     }
 
 UTEST_END
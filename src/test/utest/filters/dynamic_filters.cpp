@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/dsp-units/const.h>
+#include <lsp-plug.in/dsp-units/filters/DynamicFilters.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+#define SRATE           48000
+#define BUF_SIZE        0x1800
+#define STEP            0x2e1
+
+typedef struct filter_spec_t
+{
+    const char     *name;
+    uint32_t        type;
+    uint32_t        slope;
+} filter_spec_t;
+
+static const filter_spec_t filters[] =
+{
+    { "BT_RLC_BELL",        lsp::dspu::FLT_BT_RLC_BELL,         1 },
+    { "MT_RLC_BELL",        lsp::dspu::FLT_MT_RLC_BELL,         2 },
+    { "BT_BWC_HISHELF",     lsp::dspu::FLT_BT_BWC_HISHELF,      4 },
+    { "BT_BWC_BELL",        lsp::dspu::FLT_BT_BWC_BELL,         4 },
+    { "BT_LRX_LADDERPASS",  lsp::dspu::FLT_BT_LRX_LADDERPASS,   2 },
+    { "BT_LRX_HISHELF",     lsp::dspu::FLT_BT_LRX_HISHELF,      3 },
+};
+
+UTEST_BEGIN("dspu.filters", dynamic_filters)
+
+    void process(dspu::DynamicFilters &df, FloatBuffer &dst, FloatBuffer &src, FloatBuffer &gain)
+    {
+        for (size_t i=0; i<BUF_SIZE; )
+        {
+            size_t to_do    = lsp_min(BUF_SIZE - i, size_t(STEP));
+            df.process(0, dst.data(i), src.data(i), gain.data(i), to_do);
+            i              += to_do;
+        }
+    }
+
+    void test_table(const filter_spec_t *spec, size_t cascades)
+    {
+        dspu::DynamicFilters df1, df2;
+        dspu::filter_params_t fp;
+        FloatBuffer src(BUF_SIZE);
+        FloatBuffer gain(BUF_SIZE);
+        FloatBuffer dst1(BUF_SIZE);
+        FloatBuffer dst2(BUF_SIZE);
+
+        printf("Testing gain table for %s filter, cascades=%d\n", spec->name, int(cascades));
+
+        fp.nType            = spec->type;
+        fp.nSlope           = spec->slope;
+        fp.fFreq            = 1000.0f;
+        fp.fFreq2           = 4000.0f;
+        fp.fGain            = 1.0f;
+        fp.fQuality         = 0.5f;
+
+        UTEST_ASSERT(df1.init(1) == STATUS_OK);
+        UTEST_ASSERT(df2.init(1) == STATUS_OK);
+        df1.set_sample_rate(SRATE);
+        df2.set_sample_rate(SRATE);
+        UTEST_ASSERT(df2.set_gain_table(GAIN_AMP_M_36_DB, GAIN_AMP_P_36_DB, 0.05f, cascades) == STATUS_OK);
+        UTEST_ASSERT(df2.gain_table());
+        UTEST_ASSERT(df1.set_params(0, &fp));
+        UTEST_ASSERT(df2.set_params(0, &fp));
+        UTEST_ASSERT(df1.set_filter_active(0, true));
+        UTEST_ASSERT(df2.set_filter_active(0, true));
+
+        // Gain sweeps from -24 dB to +24 dB and back
+        src.randomize(-1.0f, 1.0f);
+        for (size_t i=0; i<BUF_SIZE; ++i)
+        {
+            float k             = float(i) / BUF_SIZE;
+            k                   = (k < 0.5f) ? 2.0f * k : 2.0f - 2.0f * k;
+            gain[i]             = GAIN_AMP_M_24_DB * expf(k * logf(GAIN_AMP_P_24_DB / GAIN_AMP_M_24_DB));
+        }
+
+        process(df1, dst1, src, gain);
+        process(df2, dst2, src, gain);
+
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst2.equals_absolute(dst1, 5e-3f))
+        {
+            size_t index = dst2.last_diff();
+            UTEST_FAIL_MSG("Output of filter with gain table differs at sample=%d: %.6f vs %.6f",
+                    int(index), dst1[index], dst2[index]);
+        }
+
+        df1.destroy();
+        df2.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        for (size_t i=0; i<sizeof(filters)/sizeof(filter_spec_t); ++i)
+        {
+            test_table(&filters[i], 16);
+            test_table(&filters[i], 1); // Most of filters do not fit into the table
+        }
+    }
+UTEST_END;
@@ -24,11 +24,14 @@
 #include <lsp-plug.in/test-fw/FloatBuffer.h>
 #include <lsp-plug.in/dsp-units/filters/Equalizer.h>
 #include <lsp-plug.in/io/File.h>
+#include <lsp-plug.in/ipc/Thread.h>
 
 using namespace lsp;
 
 #define FFT_RANK        13
 #define BUF_SIZE        (1 << (FFT_RANK + 2))
+#define FILTERS         8
+#define WAIT_TIMEOUT    10000   /* Maximum time to wait for the background worker in milliseconds */
 
 UTEST_BEGIN("dspu.filters", equalizer)
 
@@ -84,11 +87,116 @@ UTEST_BEGIN("dspu.filters", equalizer)
         eq.destroy();
     }
 
+    void set_params(dspu::Equalizer &eq, float gain)
+    {
+        dspu::filter_params_t fp;
+
+        fp.nType    = dspu::FLT_BT_BWC_BELL;
+        fp.fFreq2   = 0.0f;
+        fp.nSlope   = 2;
+        fp.fQuality = 0.5f;
+
+        for (size_t i=0; i<FILTERS; ++i)
+        {
+            fp.fFreq    = 50.0f * (1 << i);
+            fp.fGain    = (i & 1) ? gain : 1.0f / gain;
+            eq.set_params(i, &fp);
+        }
+    }
+
+    void change_band(dspu::Equalizer &eq, size_t id)
+    {
+        dspu::filter_params_t fp;
+        eq.get_params(id, &fp);
+        fp.fGain   *= 4.0f;
+        fp.fFreq   *= 1.5f;
+        eq.set_params(id, &fp);
+    }
+
+    void compare_output(dspu::Equalizer &eq1, dspu::Equalizer &eq2)
+    {
+        FloatBuffer src(BUF_SIZE);
+        FloatBuffer dst1(BUF_SIZE);
+        FloatBuffer dst2(BUF_SIZE);
+
+        eq1.reset();
+        eq2.reset();
+
+        src.randomize_sign();
+        eq1.process(dst1, src, BUF_SIZE);
+        eq2.process(dst2, src, BUF_SIZE);
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst2.equals_absolute(dst1, 1e-4f))
+        {
+            dst1.dump("dst1");
+            dst2.dump("dst2");
+            UTEST_FAIL_MSG("Output of equalizers differs at sample %d: %.6f vs %.6f",
+                int(dst2.last_diff()), dst1.get(dst2.last_diff()), dst2.get(dst2.last_diff()));
+        }
+    }
+
+    void test_rebuild(const char *label, dspu::equalizer_mode_t mode, bool background)
+    {
+        dspu::Equalizer eq1, eq2;
+        FloatBuffer tmp(BUF_SIZE);
+        tmp.fill_zero();
+
+        printf("Testing %s kernel rebuild for %s mode\n", (background) ? "background" : "incremental", label);
+
+        // Reference equalizer is built at once with final parameters
+        UTEST_ASSERT(eq1.init(FILTERS, FFT_RANK));
+        eq1.set_mode(mode);
+        eq1.set_sample_rate(48000);
+        set_params(eq1, 2.0f);
+        change_band(eq1, 3);
+        change_band(eq1, 6);
+        eq1.process(tmp, tmp, BUF_SIZE);
+
+        // The tested equalizer rebuilds the kernel after changing of some bands
+        UTEST_ASSERT(eq2.init(FILTERS, FFT_RANK, background));
+        UTEST_ASSERT(eq2.background() == background);
+        eq2.set_mode(mode);
+        eq2.set_sample_rate(48000);
+        set_params(eq2, 2.0f);
+        eq2.process(tmp, tmp, BUF_SIZE);
+
+        change_band(eq2, 3);
+        eq2.process(tmp, tmp, BUF_SIZE);
+        change_band(eq2, 6);
+        eq2.process(tmp, tmp, BUF_SIZE);
+
+        // Let the background worker complete the job and crossfade to the new kernel
+        for (size_t i=0; eq2.kernel_pending(); ++i)
+        {
+            if (i >= WAIT_TIMEOUT)
+                UTEST_FAIL_MSG("%s: the kernel has not been applied in %d ms", label, int(WAIT_TIMEOUT));
+            if (background)
+                ipc::Thread::sleep(1);
+            eq2.process(tmp, tmp, eq2.fir_ir_size());
+        }
+
+        compare_output(eq1, eq2);
+
+        eq1.destroy();
+        eq2.destroy();
+    }
+
     UTEST_MAIN
     {
         test_latency("FIR", dspu::EQM_FIR);
         test_latency("FFT", dspu::EQM_FFT);
         test_latency("SPM", dspu::EQM_SPM);
+
+        test_rebuild("FIR", dspu::EQM_FIR, false);
+        test_rebuild("FFT", dspu::EQM_FFT, false);
+        test_rebuild("SPM", dspu::EQM_SPM, false);
+
+        test_rebuild("FIR", dspu::EQM_FIR, true);
+        test_rebuild("FFT", dspu::EQM_FFT, true);
+        test_rebuild("SPM", dspu::EQM_SPM, true);
     }
 
 UTEST_END
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/dsp-units/filters/FilterBank.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdlib.h>
+
+#define FILTERS         7
+#define BUF_SIZE        0x1000
+#define STEP            0x40
+
+UTEST_BEGIN("dspu.filters", filterbank)
+
+    static float randf(float min, float max)
+    {
+        return min + (max - min) * (float(rand()) / RAND_MAX);
+    }
+
+    void make_chain(dsp::biquad_x1_t *c, float r, float w)
+    {
+        // Stable filter: complex pole pair with radius r < 1 and random zeros
+        c->b0               = randf(0.5f, 1.0f);
+        c->b1               = randf(-1.0f, 1.0f);
+        c->b2               = randf(-0.5f, 0.5f);
+        c->a1               = 2.0f * r * cosf(w);
+        c->a2               = -r * r;
+        c->p0               = 0.0f;
+        c->p1               = 0.0f;
+        c->p2               = 0.0f;
+    }
+
+    void build(dspu::FilterBank &fb, size_t seed, bool resonant)
+    {
+        srand(seed);
+        fb.begin();
+        for (size_t j=0; j<FILTERS; ++j)
+        {
+            const float r   = (resonant) ? 0.99f : 0.5f + 0.06f * j;
+            const float w   = (resonant) ? 0.05f + 0.4f * j : 0.1f + 0.35f * j;
+            make_chain(fb.add_chain(), r, w);
+        }
+        fb.end();
+    }
+
+    void test_static()
+    {
+        dspu::FilterBank fb1, fb2;
+        FloatBuffer src(BUF_SIZE);
+        FloatBuffer dst1(BUF_SIZE);
+        FloatBuffer dst2(BUF_SIZE);
+
+        printf("Testing smooth mode with static parameters\n");
+
+        UTEST_ASSERT(fb1.init(FILTERS));
+        UTEST_ASSERT(fb2.init(FILTERS));
+        fb2.set_smooth(true);
+        UTEST_ASSERT(fb2.smooth());
+
+        build(fb1, 1, false);
+        build(fb2, 1, false);
+
+        src.randomize(-1.0f, 1.0f);
+        fb1.process(dst1.data(), src.data(), BUF_SIZE);
+        for (size_t i=0; i<BUF_SIZE; i += STEP)
+            fb2.process(dst2.data(i), src.data(i), lsp_min(size_t(STEP), BUF_SIZE - i));
+
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst2.equals_adaptive(dst1, 1e-3))
+        {
+            size_t index = dst2.last_diff();
+            UTEST_FAIL_MSG("Output of smooth filter bank differs at sample=%d: %.6f vs %.6f",
+                    int(index), dst1[index], dst2[index]);
+        }
+
+        // The impulse response should not depend on the mode
+        fb1.impulse_response(dst1.data(), BUF_SIZE);
+        fb2.impulse_response(dst2.data(), BUF_SIZE);
+        UTEST_ASSERT_MSG(dst2.equals_adaptive(dst1, 1e-5), "Impulse response differs");
+
+        fb1.destroy();
+        fb2.destroy();
+    }
+
+    void test_ramp()
+    {
+        dspu::FilterBank fb1, fb2;
+        FloatBuffer src(BUF_SIZE);
+        FloatBuffer dst1(BUF_SIZE);
+        FloatBuffer dst2(BUF_SIZE);
+
+        printf("Testing smooth mode with modulated parameters\n");
+
+        UTEST_ASSERT(fb1.init(FILTERS));
+        UTEST_ASSERT(fb2.init(FILTERS));
+        fb2.set_smooth(true);
+
+        // Switch between two very different sets of resonant filters on each block
+        src.randomize(-1.0f, 1.0f);
+        build(fb2, 1, true);
+        for (size_t i=0, n=0; i<BUF_SIZE/2; i += STEP, ++n)
+        {
+            build(fb2, (n & 1) + 2, true);
+            fb2.process(dst2.data(i), src.data(i), STEP);
+        }
+
+        // The filter should stay stable
+        for (size_t i=0; i<BUF_SIZE/2; ++i)
+            UTEST_ASSERT_MSG(fabsf(dst2[i]) < 1e+6f, "Unstable output at sample=%d: %f", int(i), dst2[i]);
+
+        // After the ramp the output should converge to the output of the static filter bank
+        build(fb1, 4, false);
+        build(fb2, 4, false);
+        fb1.process(dst1.data(BUF_SIZE/2), src.data(BUF_SIZE/2), BUF_SIZE/2);
+        fb2.process(dst2.data(BUF_SIZE/2), src.data(BUF_SIZE/2), STEP);
+        fb2.process(dst2.data(BUF_SIZE/2 + STEP), src.data(BUF_SIZE/2 + STEP), BUF_SIZE/2 - STEP);
+
+        for (size_t i=BUF_SIZE - STEP; i<BUF_SIZE; ++i)
+            UTEST_ASSERT_MSG(fabsf(dst1[i] - dst2[i]) < 1e-3f,
+                "Output did not converge at sample=%d: %f vs %f", int(i), dst1[i], dst2[i]);
+
+        fb1.destroy();
+        fb2.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        test_static();
+        test_ramp();
+    }
+UTEST_END;
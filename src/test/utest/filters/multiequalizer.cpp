@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/dsp-units/filters/MultiEqualizer.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#define CHANNELS        5
+#define FILTERS         6
+#define FFT_RANK        10
+#define SRATE           48000
+#define BUF_SIZE        0x3000
+#define STEP            0x1e5
+
+UTEST_BEGIN("dspu.filters", multiequalizer)
+
+    void set_params(dspu::Equalizer *eq, dspu::MultiEqualizer &meq, size_t id, float gain)
+    {
+        dspu::filter_params_t fp;
+
+        fp.nType    = dspu::FLT_BT_BWC_BELL;
+        fp.fFreq    = 60.0f + 3000.0f * id;
+        fp.fFreq2   = 0.0f;
+        fp.fGain    = gain;
+        fp.nSlope   = 2;
+        fp.fQuality = 0.5f;
+
+        for (size_t i=0; i<CHANNELS; ++i)
+            eq[i].set_params(id, &fp);
+        meq.set_params(id, &fp);
+    }
+
+    void test_mode(const char *label, dspu::equalizer_mode_t mode)
+    {
+        dspu::Equalizer eq[CHANNELS];
+        dspu::MultiEqualizer meq;
+        FloatBuffer *src[CHANNELS];
+        FloatBuffer *dst1[CHANNELS];
+        FloatBuffer *dst2[CHANNELS];
+        const float *vsrc[CHANNELS];
+        float *vdst[CHANNELS];
+
+        printf("Testing %d-channel equalizer in %s mode\n", CHANNELS, label);
+
+        // Initialize equalizers
+        UTEST_ASSERT(meq.init(CHANNELS, FILTERS, FFT_RANK));
+        UTEST_ASSERT(meq.channels() == CHANNELS);
+        meq.set_mode(mode);
+        meq.set_sample_rate(SRATE);
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            UTEST_ASSERT(eq[i].init(FILTERS, FFT_RANK));
+            eq[i].set_mode(mode);
+            eq[i].set_sample_rate(SRATE);
+        }
+        for (size_t i=0; i<FILTERS; ++i)
+            set_params(eq, meq, i, (i & 1) ? 2.0f : 0.5f);
+
+        // Initialize buffers
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            src[i]      = new FloatBuffer(BUF_SIZE);
+            dst1[i]     = new FloatBuffer(BUF_SIZE);
+            dst2[i]     = new FloatBuffer(BUF_SIZE);
+            src[i]->randomize_sign();
+            dst1[i]->fill_zero();
+            dst2[i]->fill_zero();
+        }
+
+        // Process data, change the parameters of one band in the middle
+        for (size_t off=0; off < BUF_SIZE; off += STEP)
+        {
+            if ((off <= BUF_SIZE/2) && (off + STEP > BUF_SIZE/2))
+                set_params(eq, meq, 2, 4.0f);
+
+            size_t to_do = lsp_min(size_t(BUF_SIZE - off), size_t(STEP));
+            for (size_t i=0; i<CHANNELS; ++i)
+            {
+                eq[i].process(dst1[i]->data(off), src[i]->data(off), to_do);
+                vsrc[i]     = src[i]->data(off);
+                vdst[i]     = dst2[i]->data(off);
+            }
+            meq.process(vdst, vsrc, to_do);
+        }
+
+        UTEST_ASSERT(meq.get_latency() == eq[0].get_latency());
+
+        // Check results
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            UTEST_ASSERT_MSG(src[i]->valid(), "Source buffer %d corrupted", int(i));
+            UTEST_ASSERT_MSG(dst1[i]->valid(), "Destination buffer 1 of channel %d corrupted", int(i));
+            UTEST_ASSERT_MSG(dst2[i]->valid(), "Destination buffer 2 of channel %d corrupted", int(i));
+
+            if (!dst2[i]->equals_absolute(*dst1[i], 1e-5f))
+            {
+                size_t index = dst2[i]->last_diff();
+                UTEST_FAIL_MSG("Output of channel %d differs at sample=%d: %.6f vs %.6f",
+                    int(i), int(index), dst1[i]->get(index), dst2[i]->get(index));
+            }
+        }
+
+        // Destroy data
+        meq.destroy();
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            eq[i].destroy();
+            delete src[i];
+            delete dst1[i];
+            delete dst2[i];
+        }
+    }
+
+    UTEST_MAIN
+    {
+        test_mode("BYPASS", dspu::EQM_BYPASS);
+        test_mode("IIR", dspu::EQM_IIR);
+        test_mode("FIR", dspu::EQM_FIR);
+        test_mode("FFT", dspu::EQM_FFT);
+        test_mode("SPM", dspu::EQM_SPM);
+    }
+
+UTEST_END
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/dsp-units/filters/FilterBank.h>
+#include <lsp-plug.in/dsp-units/filters/MultiFilterBank.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/stdlib.h>
+
+#define FILTERS         7
+#define BUF_SIZE        0x1200
+#define STEP            0x1e5
+
+UTEST_BEGIN("dspu.filters", multifilterbank)
+
+    static float randf(float min, float max)
+    {
+        return min + (max - min) * (float(rand()) / RAND_MAX);
+    }
+
+    void make_chain(dsp::biquad_x1_t *c, size_t id)
+    {
+        // Stable filter: complex pole pair with radius r < 1 and random zeros
+        const float r       = 0.5f + 0.06f * id;
+        const float w       = 0.1f + 0.35f * id;
+
+        c->b0               = randf(0.5f, 1.0f);
+        c->b1               = randf(-1.0f, 1.0f);
+        c->b2               = randf(-0.5f, 0.5f);
+        c->a1               = 2.0f * r * cosf(w);
+        c->a2               = -r * r;
+        c->p0               = 0.0f;
+        c->p1               = 0.0f;
+        c->p2               = 0.0f;
+    }
+
+    void test_bank(size_t channels, bool interleaved)
+    {
+        dspu::FilterBank *fb        = new dspu::FilterBank[channels];
+        dspu::MultiFilterBank mfb;
+        FloatBuffer *src[16];
+        FloatBuffer *dst1[16];
+        FloatBuffer *dst2[16];
+        const float *vsrc[16];
+        float *vdst[16];
+
+        printf("Testing %d-channel filter bank with %s I/O\n", int(channels), (interleaved) ? "interleaved" : "planar");
+
+        // Initialize filter banks
+        UTEST_ASSERT(mfb.init(channels, FILTERS));
+        UTEST_ASSERT(mfb.channels() == channels);
+        UTEST_ASSERT(mfb.max_chains() == FILTERS);
+        for (size_t i=0; i<channels; ++i)
+            UTEST_ASSERT(fb[i].init(FILTERS));
+
+        mfb.begin();
+        for (size_t i=0; i<channels; ++i)
+            fb[i].begin();
+        for (size_t j=0; j<FILTERS; ++j)
+        {
+            dsp::biquad_x1_t *c = mfb.add_chain();
+            UTEST_ASSERT(c != NULL);
+            make_chain(c, j);
+            for (size_t i=0; i<channels; ++i)
+                *(fb[i].add_chain()) = *c;
+        }
+        mfb.end(true);
+        for (size_t i=0; i<channels; ++i)
+            fb[i].end(true);
+        UTEST_ASSERT(mfb.size() == FILTERS);
+
+        // Initialize buffers
+        for (size_t i=0; i<channels; ++i)
+        {
+            src[i]      = new FloatBuffer(BUF_SIZE);
+            dst1[i]     = new FloatBuffer(BUF_SIZE);
+            dst2[i]     = new FloatBuffer(BUF_SIZE);
+            src[i]->randomize(-1.0f, 1.0f);
+            dst1[i]->fill_zero();
+            dst2[i]->fill_zero();
+        }
+
+        // Compute reference result
+        for (size_t i=0; i<channels; ++i)
+            fb[i].process(dst1[i]->data(), src[i]->data(), BUF_SIZE);
+
+        // Process with multi-channel filter bank
+        if (interleaved)
+        {
+            FloatBuffer ibuf(BUF_SIZE * channels);
+            for (size_t i=0; i<BUF_SIZE; ++i)
+                for (size_t j=0; j<channels; ++j)
+                    ibuf[i*channels + j]    = (*src[j])[i];
+
+            for (size_t i=0; i<BUF_SIZE; )
+            {
+                size_t to_do    = lsp_min(BUF_SIZE - i, size_t(STEP));
+                mfb.process_interleaved(ibuf.data(i * channels), ibuf.data(i * channels), to_do);
+                i              += to_do;
+            }
+            UTEST_ASSERT_MSG(ibuf.valid(), "Interleaved buffer corrupted");
+
+            for (size_t i=0; i<BUF_SIZE; ++i)
+                for (size_t j=0; j<channels; ++j)
+                    (*dst2[j])[i]           = ibuf[i*channels + j];
+        }
+        else
+        {
+            for (size_t i=0; i<BUF_SIZE; )
+            {
+                size_t to_do    = lsp_min(BUF_SIZE - i, size_t(STEP));
+                for (size_t j=0; j<channels; ++j)
+                {
+                    vsrc[j]         = src[j]->data(i);
+                    vdst[j]         = dst2[j]->data(i);
+                }
+                mfb.process(vdst, vsrc, to_do);
+                i              += to_do;
+            }
+        }
+
+        // Check result
+        for (size_t i=0; i<channels; ++i)
+        {
+            UTEST_ASSERT_MSG(dst1[i]->valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2[i]->valid(), "Destination buffer 2 corrupted");
+
+            if (!dst2[i]->equals_adaptive(*dst1[i], 1e-4))
+            {
+                dst1[i]->dump("dst1");
+                dst2[i]->dump("dst2");
+                size_t index = dst2[i]->last_diff();
+                UTEST_FAIL_MSG("Output of channel %d differs at sample=%d: %.6f vs %.6f",
+                        int(i), int(index), (*dst1[i])[index], (*dst2[i])[index]);
+            }
+        }
+
+        // Check impulse response
+        fb[0].impulse_response(dst1[0]->data(), BUF_SIZE);
+        mfb.impulse_response(dst2[0]->data(), BUF_SIZE);
+        UTEST_ASSERT_MSG(dst2[0]->equals_adaptive(*dst1[0], 1e-4), "Impulse response differs");
+
+        // Destroy data
+        mfb.destroy();
+        for (size_t i=0; i<channels; ++i)
+        {
+            fb[i].destroy();
+            delete src[i];
+            delete dst1[i];
+            delete dst2[i];
+        }
+        delete [] fb;
+    }
+
+    UTEST_MAIN
+    {
+        static const size_t channels[] = { 1, 2, 3, 5, 8, 11, 16 };
+
+        for (size_t i=0; i<sizeof(channels)/sizeof(channels[0]); ++i)
+        {
+            test_bank(channels[i], false);
+            test_bank(channels[i], true);
+        }
+    }
+UTEST_END;
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/dsp-units/meters/ILUFSMeter.h>
+#include <lsp-plug.in/dsp-units/units.h>
+
+#define SRATE           48000
+#define BUF_SIZE        0x400
+
+using namespace lsp;
+
+UTEST_BEGIN("dspu.meters", ilufs)
+
+    typedef struct segment_t
+    {
+        float       level;      // Level of the sine wave in dB
+        float       duration;   // Duration in seconds
+    } segment_t;
+
+    void generate(FloatBuffer &buf, const segment_t *segments, size_t count)
+    {
+        const float kf  = 2.0f * M_PI * 1000.0f / SRATE;
+        float *dst      = buf.data();
+
+        for (size_t i=0, offset=0; i<count; ++i)
+        {
+            const segment_t *s  = &segments[i];
+            const float gain    = dspu::db_to_gain(s->level) * M_SQRT2;
+            const size_t length = dspu::seconds_to_samples(SRATE, s->duration);
+            for (size_t j=0; j<length; ++j, ++offset)
+                dst[offset]         = gain * sinf(kf * offset);
+        }
+    }
+
+    size_t total_length(const segment_t *segments, size_t count)
+    {
+        size_t length = 0;
+        for (size_t i=0; i<count; ++i)
+            length     += dspu::seconds_to_samples(SRATE, segments[i].duration);
+        return length;
+    }
+
+    void process(dspu::ILUFSMeter &m, FloatBuffer &src)
+    {
+        for (size_t offset=0; offset < src.size(); )
+        {
+            const size_t to_do  = lsp_min(src.size() - offset, size_t(BUF_SIZE));
+            m.bind(0, src.data(offset));
+            m.process(NULL, to_do);
+            offset         += to_do;
+        }
+    }
+
+    void init_meter(dspu::ILUFSMeter &m, bool histogram)
+    {
+        UTEST_ASSERT(m.init(1, 60.0f) == STATUS_OK);
+        UTEST_ASSERT(m.set_sample_rate(SRATE) == STATUS_OK);
+        m.set_integration_period(60.0f);
+        m.set_histogram(histogram);
+        UTEST_ASSERT(m.histogram() == histogram);
+    }
+
+    void test_gating()
+    {
+        static const segment_t segments[] =
+        {
+            { -20.0f, 10.0f },
+            { -40.0f, 10.0f },
+            { -90.0f, 5.0f  },
+            { -26.0f, 10.0f }
+        };
+        const size_t count = sizeof(segments) / sizeof(segment_t);
+
+        printf("Testing gated loudness in histogram mode...\n");
+
+        FloatBuffer src(total_length(segments, count));
+        generate(src, segments, count);
+
+        dspu::ILUFSMeter m1, m2;
+        init_meter(m1, false);
+        init_meter(m2, true);
+
+        process(m1, src);
+        process(m2, src);
+
+        const float l1 = dspu::gain_to_db(m1.loudness() * dspu::bs::DBFS_TO_LUFS_SHIFT_GAIN);
+        const float l2 = dspu::gain_to_db(m2.loudness() * dspu::bs::DBFS_TO_LUFS_SHIFT_GAIN);
+        printf("  ring buffer: %.3f LUFS, histogram: %.3f LUFS\n", l1, l2);
+
+        UTEST_ASSERT_MSG(fabsf(l1 - l2) < 0.1f, "Loudness mismatch: %.3f vs %.3f LUFS", l1, l2);
+        UTEST_ASSERT(m1.loudness_range() == 0.0f);
+
+        m1.destroy();
+        m2.destroy();
+    }
+
+    void test_loudness_range()
+    {
+        static const segment_t segments[] =
+        {
+            { -20.0f, 20.0f },
+            { -30.0f, 20.0f }
+        };
+        const size_t count = sizeof(segments) / sizeof(segment_t);
+
+        printf("Testing loudness range in histogram mode...\n");
+
+        FloatBuffer src(total_length(segments, count));
+        generate(src, segments, count);
+
+        dspu::ILUFSMeter m;
+        init_meter(m, true);
+        process(m, src);
+
+        const float lra = m.loudness_range();
+        printf("  loudness range: %.3f LU\n", lra);
+        UTEST_ASSERT_MSG(fabsf(lra - 10.0f) < 0.3f, "Invalid loudness range: %.3f LU", lra);
+
+        // Switching the mode should reset the measurements
+        m.set_histogram(false);
+        UTEST_ASSERT(m.loudness() == 0.0f);
+        UTEST_ASSERT(m.loudness_range() == 0.0f);
+
+        m.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        test_gating();
+        test_loudness_range();
+    }
+
+UTEST_END;
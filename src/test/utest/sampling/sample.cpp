@@ -24,6 +24,7 @@
 #include <lsp-plug.in/fmt/lspc/lspc.h>
 #include <lsp-plug.in/fmt/lspc/util.h>
 #include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/stdlib/string.h>
 #include <lsp-plug.in/test-fw/utest.h>
 #include <lsp-plug.in/test-fw/FloatBuffer.h>
 
@@ -272,6 +273,85 @@ UTEST_BEGIN("dspu.sampling", sample)
         UTEST_ASSERT(l.sample_rate() == srate);
     }
 
+    void compare_samples_exact(const dspu::Sample &s, const dspu::Sample &c)
+    {
+        UTEST_ASSERT_MSG(
+            s.length() == c.length(),
+            "Sample length differ: %d vs %d",
+            int(s.length()), int(c.length()));
+        UTEST_ASSERT(s.channels() == c.channels());
+        UTEST_ASSERT(s.sample_rate() == c.sample_rate());
+
+        for (size_t i=0; i<s.channels(); ++i)
+        {
+            const float *s0 = s.channel(i);
+            const float *s1 = c.channel(i);
+
+            for (size_t j=0; j<s.length(); ++j)
+            {
+                if (memcmp(&s0[j], &s1[j], sizeof(float)) != 0)
+                {
+                    eprintf("Failed exact sample check at sample %d, channel %d: s0=%f, s1=%f\n",
+                            int(j), int(i), s0[j], s1[j]);
+                    UTEST_FAIL();
+                }
+            }
+        }
+    }
+
+    void test_parallel_resample(size_t srate, size_t threads)
+    {
+        printf("Testing resample with sample rate %d using %d threads...\n", int(srate), int(threads));
+
+        dspu::Sample o, s, p;
+        init_sample(&o);
+
+        UTEST_ASSERT(s.copy(&o) == STATUS_OK);
+        UTEST_ASSERT(p.copy(&o) == STATUS_OK);
+        UTEST_ASSERT(s.resample(srate) == STATUS_OK);
+        UTEST_ASSERT(p.resample(srate, threads) == STATUS_OK);
+
+        compare_samples_exact(s, p);
+    }
+
+    void test_parallel_stretch(size_t threads)
+    {
+        printf("Testing sample stretch using %d threads...\n", int(threads));
+
+        static const dspu::sample_crossfade_t crossfades[] =
+        {
+            dspu::SAMPLE_CROSSFADE_LINEAR,
+            dspu::SAMPLE_CROSSFADE_CONST_POWER
+        };
+
+        dspu::Sample o, s, p;
+        init_sample(&o);
+
+        for (size_t i=0, n=sizeof(crossfades)/sizeof(dspu::sample_crossfade_t); i<n; ++i)
+        {
+            // Single cross-fade stretch
+            UTEST_ASSERT(s.copy(o) == STATUS_OK);
+            UTEST_ASSERT(p.copy(o) == STATUS_OK);
+            UTEST_ASSERT(s.stretch(3072, 2048, crossfades[i], 0.25f, TEST_SRATE/2, TEST_SRATE/2 + 8192) == STATUS_OK);
+            UTEST_ASSERT(p.stretch(3072, 2048, crossfades[i], 0.25f, TEST_SRATE/2, TEST_SRATE/2 + 8192, threads) == STATUS_OK);
+            compare_samples_exact(s, p);
+
+            // Widening stretch
+            UTEST_ASSERT(s.copy(o) == STATUS_OK);
+            UTEST_ASSERT(p.copy(o) == STATUS_OK);
+            UTEST_ASSERT(s.stretch(TEST_SRATE, 1024, crossfades[i], 0.25f, TEST_SRATE/4, TEST_SRATE/2) == STATUS_OK);
+            UTEST_ASSERT(p.stretch(TEST_SRATE, 1024, crossfades[i], 0.25f, TEST_SRATE/4, TEST_SRATE/2, threads) == STATUS_OK);
+            compare_samples_exact(s, p);
+
+            // Shortening stretch
+            UTEST_ASSERT(s.copy(o) == STATUS_OK);
+            UTEST_ASSERT(p.copy(o) == STATUS_OK);
+            UTEST_ASSERT(s.stretch(4200, 1024, crossfades[i], 0.25f, TEST_SRATE/2, TEST_SRATE/2 + 16000) == STATUS_OK);
+            UTEST_ASSERT(p.stretch(4200, 1024, crossfades[i], 0.25f, TEST_SRATE/2, TEST_SRATE/2 + 16000, threads) == STATUS_OK);
+            compare_samples_exact(s, p);
+        }
+    }
+
     void create_lspc_file(const dspu::Sample *s, const io::Path *path, const char *relpath)
     {
         lspc::File fd;
@@ -391,6 +471,11 @@ UTEST_BEGIN("dspu.sampling", sample)
         test_resample(44100);
         test_resample(88200);
         test_stretch();
+        test_parallel_resample(TEST_SRATE / 2, 4);
+        test_parallel_resample(TEST_SRATE * 2, 4);
+        test_parallel_resample(44100, 3);
+        test_parallel_resample(88200, 8);
+        test_parallel_stretch(4);
         test_lspc_named_files();
     }
 UTEST_END
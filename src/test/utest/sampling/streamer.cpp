@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/dsp-units/sampling/SamplePlayer.h>
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/common/finally.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/stdlib/math.h>
+
+#define TEST_SRATE          48000
+#define SAMPLE_HEAD         0x1000
+#define STREAM_CAPACITY     0x2000
+#define STREAM_TIMEOUT      5000
+#define BLOCK_SIZE          0x100
+
+UTEST_BEGIN("dspu.sampling", streamer)
+    UTEST_TIMELIMIT(30)
+
+    class Player: public dspu::SamplePlayer
+    {
+        public:
+            // Check that all requests have been served and the ring buffers are filled by the reader thread
+            bool stream_ready()
+            {
+                for (size_t i=0, n=sStreamer.streams(); i<n; ++i)
+                {
+                    dspu::playback::stream_t *s = sStreamer.stream(i);
+                    if (s->bQueued)
+                        return false;
+                    if (s->pSample == NULL)
+                        continue;
+                    if (atomic_load(&s->nServed) != s->nRequest)
+                        return false;
+
+                    const size_t limit  = lsp_min(size_t(s->nRead) + s->nCapacity, s->pSample->full_length());
+                    if (atomic_load(&s->nEnd) < limit)
+                        return false;
+                }
+
+                return true;
+            }
+
+            bool wait_stream()
+            {
+                for (size_t i=0; i<STREAM_TIMEOUT; ++i)
+                {
+                    if (stream_ready())
+                        return true;
+                    ipc::Thread::sleep(1);
+                }
+
+                return false;
+            }
+    };
+
+    void test_stream_state(const io::Path *path)
+    {
+        printf("Testing the streaming state of the sample...\n");
+
+        dspu::Sample s, sc;
+        UTEST_ASSERT(s.loads_streamed(path, SAMPLE_HEAD) == STATUS_OK);
+        UTEST_ASSERT(s.streamed());
+
+        // The copy should refer to the same stream
+        UTEST_ASSERT(sc.copy(&s) == STATUS_OK);
+        UTEST_ASSERT(sc.streamed());
+        UTEST_ASSERT(sc.length() == SAMPLE_HEAD);
+        UTEST_ASSERT(sc.full_length() == TEST_SRATE);
+
+        mm::IInAudioStream *is = NULL;
+        UTEST_ASSERT(sc.open_stream(&is) == STATUS_OK);
+        UTEST_ASSERT(is != NULL);
+        is->close();
+        delete is;
+
+        // The copy of the regular sample is not streamed
+        dspu::Sample sr;
+        UTEST_ASSERT(sr.init(2, 0x100, 0x100));
+        UTEST_ASSERT(sc.copy(&sr) == STATUS_OK);
+        UTEST_ASSERT(!sc.streamed());
+        UTEST_ASSERT(sc.full_length() == 0x100);
+        UTEST_ASSERT(sc.open_stream(&is) == STATUS_BAD_STATE);
+
+        // Resizing drops the stream
+        UTEST_ASSERT(sc.copy(&s) == STATUS_OK);
+        UTEST_ASSERT(sc.resize(sc.channels(), sc.max_length(), SAMPLE_HEAD / 2));
+        UTEST_ASSERT(!sc.streamed());
+        UTEST_ASSERT(sc.full_length() == SAMPLE_HEAD / 2);
+
+        UTEST_ASSERT(sc.copy(&s) == STATUS_OK);
+        UTEST_ASSERT(sc.resize(1, SAMPLE_HEAD * 2, SAMPLE_HEAD * 2));
+        UTEST_ASSERT(!sc.streamed());
+        UTEST_ASSERT(sc.full_length() == SAMPLE_HEAD * 2);
+
+        // Initialization drops the stream
+        UTEST_ASSERT(s.init(2, 0x100, 0x100));
+        UTEST_ASSERT(!s.streamed());
+        UTEST_ASSERT(s.full_length() == 0x100);
+    }
+
+    void play(FloatBuffer &dst, dspu::Sample *s, bool streaming)
+    {
+        Player sp;
+        UTEST_ASSERT(sp.init(1, 2));
+        if (streaming)
+        {
+            UTEST_ASSERT(sp.enable_streaming(STREAM_CAPACITY));
+            UTEST_ASSERT(sp.streaming());
+        }
+
+        s->gc_acquire();
+        UTEST_ASSERT(sp.bind(0, s));
+
+        dspu::PlaySettings ps;
+        ps.set_channel(0, 1);
+        ps.set_playback(0, 0, 0.5f);
+        UTEST_ASSERT(sp.play(&ps).valid());
+
+        // Let the reader thread keep ahead of the playback position
+        for (size_t offset=0; offset < dst.size(); offset += BLOCK_SIZE)
+        {
+            if (streaming)
+                UTEST_ASSERT_MSG(sp.wait_stream(), "Timeout waiting for the streamed data at offset=%d", int(offset));
+            sp.process(dst.data(offset), lsp_min(dst.size() - offset, size_t(BLOCK_SIZE)));
+        }
+
+        sp.stop();
+        sp.disable_streaming();
+        UTEST_ASSERT(!sp.streaming());
+        sp.unbind_all();
+        sp.destroy(false);
+        UTEST_ASSERT(s->gc_release() == 0);
+    }
+
+    UTEST_MAIN
+    {
+        io::Path path;
+        UTEST_ASSERT(path.fmt("%s/utest-%s.wav", tempdir(), full_name()) > 0);
+
+        // Generate the sample and save it to file
+        dspu::Sample s;
+        UTEST_ASSERT(s.init(2, TEST_SRATE, TEST_SRATE));
+        s.set_sample_rate(TEST_SRATE);
+        for (size_t i=0; i<TEST_SRATE; ++i)
+        {
+            s.channel(0)[i]     = sinf(i * 0.01f);
+            s.channel(1)[i]     = cosf(i * 0.03f) * (i & 0xff) / 256.0f;
+        }
+        printf("Saving sample to '%s'\n", path.as_utf8());
+        UTEST_ASSERT(s.save(&path) == TEST_SRATE);
+        lsp_finally { path.remove(); };
+
+        // Load the sample completely and in streamed mode
+        dspu::Sample sf, ss;
+        UTEST_ASSERT(sf.load(&path) == STATUS_OK);
+        UTEST_ASSERT(!sf.streamed());
+        UTEST_ASSERT(sf.length() == TEST_SRATE);
+        UTEST_ASSERT(sf.full_length() == TEST_SRATE);
+
+        UTEST_ASSERT(ss.loads_streamed(&path, SAMPLE_HEAD) == STATUS_OK);
+        UTEST_ASSERT(ss.streamed());
+        UTEST_ASSERT(ss.length() == SAMPLE_HEAD);
+        UTEST_ASSERT(ss.full_length() == TEST_SRATE);
+        UTEST_ASSERT(ss.channels() == 2);
+
+        // Short file should be loaded completely
+        dspu::Sample sc;
+        UTEST_ASSERT(sc.loads_streamed(&path, TEST_SRATE * 2) == STATUS_OK);
+        UTEST_ASSERT(!sc.streamed());
+        UTEST_ASSERT(sc.length() == TEST_SRATE);
+
+        test_stream_state(&path);
+
+        // Play samples and compare
+        FloatBuffer dst1(TEST_SRATE + BLOCK_SIZE);
+        FloatBuffer dst2(TEST_SRATE + BLOCK_SIZE);
+        play(dst1, &sf, false);
+        play(dst2, &ss, true);
+
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        if (!dst1.equals_absolute(dst2, 1e-5))
+        {
+            size_t index = dst1.last_diff();
+            UTEST_FAIL_MSG("Streamed playback differs at sample=%d: %.6f vs %.6f",
+                int(index), dst1[index], dst2[index]);
+        }
+    }
+UTEST_END;
@@ -221,6 +221,92 @@ UTEST_BEGIN("dspu.shared", audiostream)
         UTEST_ASSERT(out.close() == STATUS_OK);
     }
 
+    void test_spans()
+    {
+        LSPString id;
+        dspu::AudioStream out, in;
+        dspu::AudioStream::write_span_t ws;
+        dspu::AudioStream::read_span_t rs;
+
+        printf("Testing zero-copy read/write on audio stream...\n");
+        UTEST_ASSERT(out.allocate(&id, ".shm", 2, 1024) == STATUS_OK);
+        printf("  allocated stream with unique id=%s ...\n", id.get_native());
+        UTEST_ASSERT(in.open(&id) == STATUS_OK);
+
+        // Spans are not available outside of begin() and end() calls
+        UTEST_ASSERT(out.write_span(0, &ws, 0x10) == STATUS_BAD_STATE);
+        UTEST_ASSERT(in.read_span(0, &rs, 0x10) == STATUS_BAD_STATE);
+
+        // Initialize buffers
+        const size_t block  = 0x180;
+        const size_t length = out.length();
+        FloatBuffer bout(block);
+        FloatBuffer bin(block);
+
+        // Perform several cycles to get wrap-around of the shared buffer
+        size_t wrapped = 0;
+        for (size_t j=0; j<8; ++j)
+        {
+            for (size_t i=0; i<block; ++i)
+                bout[i] = float(i + j * block) + 1.0f;
+
+            // Write the block
+            UTEST_ASSERT(out.begin() == STATUS_OK);
+            for (size_t c=0; c<2; ++c)
+            {
+                UTEST_ASSERT(out.write_span(c, &ws, block) == STATUS_OK);
+                UTEST_ASSERT(ws.vCount[0] + ws.vCount[1] == block);
+                UTEST_ASSERT(ws.vData[0] != NULL);
+                UTEST_ASSERT((ws.vCount[1] > 0) == (ws.vData[1] != NULL));
+
+                dsp::copy(ws.vData[0], bout.data(), ws.vCount[0]);
+                if (ws.vCount[1] > 0)
+                    dsp::copy(ws.vData[1], bout.data(ws.vCount[0]), ws.vCount[1]);
+            }
+            UTEST_ASSERT(out.end() == STATUS_OK);
+
+            // Read the block
+            UTEST_ASSERT(in.begin(block) == STATUS_OK);
+            for (size_t c=0; c<2; ++c)
+            {
+                bin.fill_zero();
+                UTEST_ASSERT(in.read_span(c, &rs, block) == STATUS_OK);
+                UTEST_ASSERT(rs.vCount[0] + rs.vCount[1] == block);
+                if (rs.vCount[1] > 0)
+                    ++wrapped;
+
+                dsp::copy(bin.data(), rs.vData[0], rs.vCount[0]);
+                if (rs.vCount[1] > 0)
+                    dsp::copy(bin.data(rs.vCount[0]), rs.vData[1], rs.vCount[1]);
+
+                UTEST_ASSERT(!bin.corrupted());
+                UTEST_ASSERT(bin.equals_absolute(bout));
+            }
+
+            // Out of channel read does not return any data
+            UTEST_ASSERT(in.read_span(2, &rs, block) == STATUS_OK);
+            UTEST_ASSERT(rs.vCount[0] + rs.vCount[1] == 0);
+            UTEST_ASSERT(in.end() == STATUS_OK);
+        }
+        UTEST_ASSERT(wrapped > 0);
+
+        // Nothing to read: no data is returned
+        UTEST_ASSERT(in.begin(block) == STATUS_OK);
+        UTEST_ASSERT(in.read_span(0, &rs, block) == STATUS_OK);
+        UTEST_ASSERT(rs.vCount[0] + rs.vCount[1] == 0);
+        UTEST_ASSERT(in.end() == STATUS_OK);
+
+        // The write span is limited by the length of the shared buffer
+        UTEST_ASSERT(out.begin() == STATUS_OK);
+        UTEST_ASSERT(out.write_span(0, &ws, length * 2) == STATUS_OK);
+        UTEST_ASSERT(ws.vCount[0] + ws.vCount[1] == length);
+        UTEST_ASSERT(out.end() == STATUS_OK);
+
+        // Close the stream
+        UTEST_ASSERT(in.close() == STATUS_OK);
+        UTEST_ASSERT(out.close() == STATUS_OK);
+    }
+
     void test_overrun()
     {
         LSPString id;
@@ -403,6 +489,7 @@ UTEST_BEGIN("dspu.shared", audiostream)
         test_create_open();
         test_allocate_open();
         test_read_write();
+        test_spans();
         test_overrun();
         test_underrun();
         test_close();
@@ -164,6 +164,54 @@ UTEST_BEGIN("dspu.shared", catalog)
         UTEST_ASSERT(cat.sync());
         UTEST_ASSERT(!cat.changed());
 
+        // Fill up the catalog, revoke each second record and fill it up again
+        printf("Testing Catalog fill-up...\n");
+        LSPString name;
+        dspu::Catalog::Record recs[16];
+        for (size_t i=0; i<16; ++i)
+        {
+            UTEST_ASSERT(name.fmt_utf8("record-%d", int(i)));
+            UTEST_ASSERT(cat.publish(&recs[i], 0x12345678, &name, &name) >= 0);
+        }
+        UTEST_ASSERT(cat.size() == 16);
+        UTEST_ASSERT(cat.publish(NULL, 0x12345678, "overflow", "overflow.shm") < 0);
+
+        for (size_t i=0; i<16; i += 2)
+            UTEST_ASSERT(cat.revoke(recs[i].index, recs[i].version) == STATUS_OK);
+        UTEST_ASSERT(cat.size() == 8);
+
+        for (size_t i=0; i<16; ++i)
+        {
+            dspu::Catalog::Record rec;
+            UTEST_ASSERT(name.fmt_utf8("record-%d", int(i)));
+            if (i & 1)
+            {
+                UTEST_ASSERT(cat.get(&rec, &name) == STATUS_OK);
+                UTEST_ASSERT(rec.index == recs[i].index);
+                UTEST_ASSERT(rec.name.equals(&name));
+            }
+            else
+                UTEST_ASSERT(cat.get(&rec, &name) == STATUS_NOT_FOUND);
+        }
+
+        for (size_t i=0; i<16; i += 2)
+        {
+            UTEST_ASSERT(name.fmt_utf8("record-%d", int(i)));
+            UTEST_ASSERT(cat.get_or_reserve(&recs[i], &name, 0x12345678) == STATUS_OK);
+        }
+        UTEST_ASSERT(cat.size() == 16);
+
+        for (size_t i=0; i<16; ++i)
+        {
+            dspu::Catalog::Record rec;
+            UTEST_ASSERT(name.fmt_utf8("record-%d", int(i)));
+            UTEST_ASSERT(cat.get(&rec, &name) == STATUS_OK);
+            UTEST_ASSERT(rec.index == recs[i].index);
+            UTEST_ASSERT(cat.revoke(rec.index, rec.version) == STATUS_OK);
+        }
+        UTEST_ASSERT(cat.size() == 0);
+        UTEST_ASSERT(cat.sync());
+
         // Close catalog
         cat.close();
     }
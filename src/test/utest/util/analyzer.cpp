@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/Analyzer.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#define SRATE       48000u
+#define BUF_SIZE    SRATE
+#define BLOCK_SIZE  511u
+#define RANK        10u
+#define CHANNELS    5u
+#define FFT_CSIZE   ((1u << (RANK - 1)) + 1u)
+
+UTEST_BEGIN("dspu.util", analyzer)
+
+    UTEST_MAIN
+    {
+        // Channels 0-1 and 2-3 are analyzed in pairs, channel 4 is analyzed alone
+        static const size_t sources[CHANNELS] = { 0, 1, 1, 0, 1 };
+
+        FloatBuffer a(BUF_SIZE), b(BUF_SIZE);
+        a.randomize_sign();
+        b.randomize_sign();
+
+        FloatBuffer *spec[CHANNELS];
+        uint32_t idx[FFT_CSIZE];
+        for (size_t i=0; i<FFT_CSIZE; ++i)
+            idx[i]      = uint32_t(i);
+
+        dspu::Analyzer an;
+        UTEST_ASSERT(an.init(CHANNELS, RANK, SRATE, 20.0f));
+        an.set_sample_rate(SRATE);
+        an.set_rate(20.0f);
+        an.set_reactivity(100.0f);
+        an.reconfigure();
+
+        // Process the signal
+        const float *in[CHANNELS];
+        for (size_t offset=0; offset < BUF_SIZE; )
+        {
+            size_t to_do    = lsp_min(BUF_SIZE - offset, BLOCK_SIZE);
+            for (size_t i=0; i<CHANNELS; ++i)
+                in[i]           = (sources[i]) ? b.data(offset) : a.data(offset);
+
+            an.process(in, to_do);
+            offset         += to_do;
+        }
+
+        // Read spectrum
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            spec[i]         = new FloatBuffer(FFT_CSIZE);
+            UTEST_ASSERT(an.get_spectrum(i, spec[i]->data(), idx, FFT_CSIZE));
+            UTEST_ASSERT(spec[i]->valid());
+            UTEST_ASSERT(dsp::max(spec[i]->data(), FFT_CSIZE) > 0.0f);
+        }
+
+        // All channels analyze the same time frame, the spectrum should match for the same source
+        for (size_t i=2; i<CHANNELS; ++i)
+        {
+            const size_t j  = sources[i];
+            printf("Comparing spectrum of channel %d with channel %d\n", int(i), int(j));
+
+            if (!spec[i]->equals_relative(*spec[j], 1e-3f))
+            {
+                spec[i]->dump("spec1");
+                spec[j]->dump("spec2");
+                size_t index = spec[i]->last_diff();
+                UTEST_FAIL_MSG("Spectrum of channel %d differs from channel %d at index=%d: %.6f vs %.6f",
+                        int(i), int(j), int(index), spec[i]->get(index), spec[j]->get(index));
+            }
+        }
+
+        for (size_t i=0; i<CHANNELS; ++i)
+            delete spec[i];
+
+        an.destroy();
+    }
+
+UTEST_END
@@ -28,6 +28,8 @@
 #define CONV_SIZE       0x2000
 #define SRC_SIZE        0x2000
 #define SRC2_SIZE       0x20
+#define BCONV_SIZE      0x4000
+#define BSRC_SIZE       0x1000
 
 static void convolve(float *dst, const float *src, const float *conv, size_t length, size_t count)
 {
@@ -222,11 +224,55 @@ UTEST_BEGIN("dspu.util", convolver)
         c.destroy();
     }
 
+    void test_background()
+    {
+        dspu::Convolver c1, c2;
+
+        FloatBuffer conv(BCONV_SIZE);
+        FloatBuffer src(BSRC_SIZE + conv.size());
+        FloatBuffer dst1(src.size());
+        FloatBuffer dst2(dst1);
+        FloatBuffer dst3(dst1);
+        dsp::fill_zero(src.data(BSRC_SIZE), src.size() - BSRC_SIZE);
+
+        printf("Testing convolution with background tail processing...\n");
+
+        dst1.fill_zero();
+        dst2.fill_zero();
+        dst3.fill_zero();
+
+        UTEST_ASSERT(c1.init(conv, conv.size(), 10, 0, false));
+        UTEST_ASSERT(c2.init(conv, conv.size(), 10, 0, true));
+        UTEST_ASSERT(!c1.background());
+        UTEST_ASSERT(c2.background());
+
+        dsp::convolve(dst1, src, conv, conv.size(), BSRC_SIZE);
+        convolve(c1, dst2, src, src.size(), 127);
+        convolve(c2, dst3, src, src.size(), 127);
+
+        UTEST_ASSERT_MSG(src.valid(), "Source buffer corrupted");
+        UTEST_ASSERT_MSG(conv.valid(), "Convolution buffer corrupted");
+        UTEST_ASSERT_MSG(dst1.valid(), "Destination buffer 1 corrupted");
+        UTEST_ASSERT_MSG(dst2.valid(), "Destination buffer 2 corrupted");
+        UTEST_ASSERT_MSG(dst3.valid(), "Destination buffer 3 corrupted");
+
+        if ((!dst2.equals_absolute(dst1, 1e-3)) || (!dst3.equals_absolute(dst2, 1e-3)))
+        {
+            size_t index = dst3.last_diff();
+            UTEST_FAIL_MSG("Output of convolver is invalid, started at sample=%d: %.5f vs %.5f",
+                    int(index), dst2[index], dst3[index]);
+        }
+
+        c1.destroy();
+        c2.destroy();
+    }
+
     UTEST_MAIN
     {
 //        test_collisions();
         test_small();
         test_large();
+        test_background();
     }
 UTEST_END;
 
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/dsp-units/util/MultiConvolver.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#define INPUTS          2
+#define OUTPUTS         3
+#define SRC_SIZE        0x80
+
+static const size_t ir_sizes[INPUTS * OUTPUTS] =
+{
+    0x2000, 0x1f, 0,
+    0x300, 0x3456, 0x81
+};
+
+UTEST_BEGIN("dspu.util", multiconvolver)
+
+    void process(dspu::MultiConvolver &conv, FloatBuffer **dst, FloatBuffer **src, size_t count, size_t step)
+    {
+        float *vdst[OUTPUTS];
+        const float *vsrc[INPUTS];
+
+        for (size_t i=0; i<count;)
+        {
+            size_t todo = lsp_min(count - i, step);
+            for (size_t j=0; j<INPUTS; ++j)
+                vsrc[j]     = src[j]->data(i);
+            for (size_t j=0; j<OUTPUTS; ++j)
+                vdst[j]     = dst[j]->data(i);
+
+            conv.process(vdst, vsrc, todo);
+            i += todo;
+        }
+    }
+
+    void test_matrix(size_t rank, size_t step)
+    {
+        dspu::MultiConvolver c;
+        FloatBuffer *ir[INPUTS * OUTPUTS];
+        FloatBuffer *src[INPUTS];
+        FloatBuffer *dst1[OUTPUTS];
+        FloatBuffer *dst2[OUTPUTS];
+        const float *vir[INPUTS * OUTPUTS];
+        size_t length = 0;
+
+        printf("Testing %dx%d convolution matrix rank=%d, step=%d...\n", INPUTS, OUTPUTS, int(rank), int(step));
+
+        // Initialize data
+        for (size_t i=0; i<INPUTS * OUTPUTS; ++i)
+        {
+            ir[i]       = new FloatBuffer(lsp_max(ir_sizes[i], size_t(1)));
+            ir[i]->randomize(-1.0f, 1.0f);
+            vir[i]      = (ir_sizes[i] > 0) ? ir[i]->data() : NULL;
+            length      = lsp_max(length, ir_sizes[i]);
+        }
+        length     += SRC_SIZE;
+
+        for (size_t i=0; i<INPUTS; ++i)
+        {
+            src[i]      = new FloatBuffer(length);
+            src[i]->randomize(-1.0f, 1.0f);
+            dsp::fill_zero(src[i]->data(SRC_SIZE), length - SRC_SIZE);
+        }
+        for (size_t i=0; i<OUTPUTS; ++i)
+        {
+            dst1[i]     = new FloatBuffer(length);
+            dst2[i]     = new FloatBuffer(length);
+            dst1[i]->fill_zero();
+            dst2[i]->fill_zero();
+        }
+
+        // Compute reference result
+        for (size_t i=0; i<INPUTS; ++i)
+            for (size_t j=0; j<OUTPUTS; ++j)
+            {
+                const size_t k = i * OUTPUTS + j;
+                if (ir_sizes[k] > 0)
+                    dsp::convolve(dst1[j]->data(), src[i]->data(), ir[k]->data(), ir_sizes[k], SRC_SIZE);
+            }
+
+        // Process with convolver
+        UTEST_ASSERT(c.init(vir, ir_sizes, INPUTS, OUTPUTS, rank, 0.0f));
+        UTEST_ASSERT(c.inputs() == INPUTS);
+        UTEST_ASSERT(c.outputs() == OUTPUTS);
+        process(c, dst2, src, length, step);
+
+        // Check result
+        for (size_t i=0; i<OUTPUTS; ++i)
+        {
+            UTEST_ASSERT_MSG(dst1[i]->valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2[i]->valid(), "Destination buffer 2 corrupted");
+
+            if (!dst2[i]->equals_absolute(*dst1[i], 1e-3))
+            {
+                size_t index = dst2[i]->last_diff();
+                UTEST_FAIL_MSG("Output %d of convolver is invalid, started at sample=%d: %.5f vs %.5f",
+                        int(i), int(index), (*dst1[i])[index], (*dst2[i])[index]);
+            }
+        }
+
+        c.destroy();
+
+        // Destroy data
+        for (size_t i=0; i<INPUTS * OUTPUTS; ++i)
+            delete ir[i];
+        for (size_t i=0; i<INPUTS; ++i)
+            delete src[i];
+        for (size_t i=0; i<OUTPUTS; ++i)
+        {
+            delete dst1[i];
+            delete dst2[i];
+        }
+    }
+
+    UTEST_MAIN
+    {
+        test_matrix(8, 31);
+        test_matrix(10, 127);
+        test_matrix(12, 1024);
+    }
+UTEST_END;
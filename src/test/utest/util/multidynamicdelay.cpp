@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/dsp-units/util/MultiDynamicDelay.h>
+#include <lsp-plug.in/dsp-units/util/DynamicDelay.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+#define VOICES          4
+#define MAX_DELAY       3000
+#define SAMPLES         20000
+#define BLOCK_SIZE      777
+
+UTEST_BEGIN("dspu.util", multidynamicdelay)
+
+    void process(dspu::MultiDynamicDelay &dl, FloatBuffer **out, FloatBuffer &in, FloatBuffer **delay, FloatBuffer *fgain)
+    {
+        float *vout[VOICES];
+        const float *vdelay[VOICES];
+
+        for (size_t offset=0; offset < SAMPLES; )
+        {
+            const size_t to_do  = lsp_min(SAMPLES - offset, size_t(BLOCK_SIZE));
+            for (size_t i=0; i<VOICES; ++i)
+            {
+                vout[i]             = out[i]->data(offset);
+                vdelay[i]           = delay[i]->data(offset);
+            }
+            dl.process(vout, in.data(offset), vdelay, (fgain != NULL) ? fgain->data(offset) : NULL, to_do);
+            offset             += to_do;
+        }
+    }
+
+    static float history(const float *buf, ssize_t index, ssize_t current)
+    {
+        return ((index >= 0) && (index <= current)) ? buf[index] : 0.0f;
+    }
+
+    // Straightforward implementation of the delay line with infinite history
+    void reference(FloatBuffer **out, FloatBuffer &in, FloatBuffer **delay, FloatBuffer *fgain, dspu::delay_interp_t interp)
+    {
+        FloatBuffer hist(SAMPLES);
+        float *h        = hist.data();
+        float ap[VOICES];
+        for (size_t i=0; i<VOICES; ++i)
+            ap[i]           = 0.0f;
+
+        for (ssize_t i=0; i<SAMPLES; ++i)
+        {
+            h[i]            = in.get(i);
+            float sum       = 0.0f;
+
+            for (size_t j=0; j<VOICES; ++j)
+            {
+                float d         = lsp_limit(delay[j]->get(i), 0.0f, float(MAX_DELAY));
+                if (interp == dspu::DI_CUBIC)
+                    d               = lsp_max(d, 1.0f);
+                ssize_t n       = ssize_t(d);
+                float f         = d - float(n);
+                float y;
+
+                switch (interp)
+                {
+                    case dspu::DI_LINEAR:
+                        y               = history(h, i-n, i) * (1.0f - f) + history(h, i-n-1, i) * f;
+                        break;
+                    case dspu::DI_CUBIC:
+                    {
+                        const float p0  = history(h, i-n+1, i);
+                        const float p1  = history(h, i-n, i);
+                        const float p2  = history(h, i-n-1, i);
+                        const float p3  = history(h, i-n-2, i);
+                        y               = p1 + 0.5f * f * (p2 - p0 + f * (2.0f*p0 - 5.0f*p1 + 4.0f*p2 - p3 + f * (3.0f*(p1 - p2) + p3 - p0)));
+                        break;
+                    }
+                    case dspu::DI_ALLPASS:
+                    {
+                        if ((f < 0.5f) && (n > 0))
+                        {
+                            --n;
+                            f              += 1.0f;
+                        }
+                        const float a   = (1.0f - f) / (1.0f + f);
+                        y               = a * (history(h, i-n, i) - ap[j]) + history(h, i-n-1, i);
+                        ap[j]           = y;
+                        break;
+                    }
+                    default:
+                        y               = history(h, i-n, i);
+                        break;
+                }
+
+                out[j]->data()[i]   = y;
+                sum                += y;
+            }
+
+            if (fgain != NULL)
+                h[i]           += sum * fgain->get(i);
+        }
+    }
+
+    void test_interpolation(dspu::delay_interp_t interp, bool feedback)
+    {
+        printf("Testing interpolation=%d, feedback=%s...\n", int(interp), (feedback) ? "true" : "false");
+
+        FloatBuffer in(SAMPLES);
+        FloatBuffer fgain(SAMPLES);
+        FloatBuffer *delay[VOICES];
+        FloatBuffer *out1[VOICES];
+        FloatBuffer *out2[VOICES];
+
+        in.randomize_sign();
+        dsp::fill(fgain.data(), 0.2f / VOICES, SAMPLES);
+        for (size_t i=0; i<VOICES; ++i)
+        {
+            delay[i]        = new FloatBuffer(SAMPLES);
+            out1[i]         = new FloatBuffer(SAMPLES);
+            out2[i]         = new FloatBuffer(SAMPLES);
+
+            // Modulated delay which also goes out of the allowed range
+            float *d        = delay[i]->data();
+            for (size_t j=0; j<SAMPLES; ++j)
+                d[j]            = (i * 900.0f + 0.3f) + 1000.0f * sinf(j * 0.001f * (i + 1));
+        }
+
+        dspu::MultiDynamicDelay dl;
+        UTEST_ASSERT(dl.init(VOICES, MAX_DELAY) == STATUS_OK);
+        UTEST_ASSERT(dl.voices() == VOICES);
+        UTEST_ASSERT(dl.max_delay() == MAX_DELAY);
+        dl.set_interpolation(interp);
+        UTEST_ASSERT(dl.interpolation() == interp);
+
+        process(dl, out2, in, delay, (feedback) ? &fgain : NULL);
+        reference(out1, in, delay, (feedback) ? &fgain : NULL, interp);
+
+        for (size_t i=0; i<VOICES; ++i)
+        {
+            UTEST_ASSERT_MSG(out1[i]->valid(), "Reference buffer %d corrupted", int(i));
+            UTEST_ASSERT_MSG(out2[i]->valid(), "Output buffer %d corrupted", int(i));
+            if (!out2[i]->equals_absolute(*out1[i], 1e-4))
+            {
+                out1[i]->dump("out1");
+                out2[i]->dump("out2");
+                size_t index = out2[i]->last_diff();
+                UTEST_FAIL_MSG("Output of voice %d differs at sample %d: %.6f vs %.6f",
+                    int(i), int(index), out1[i]->get(index), out2[i]->get(index));
+            }
+        }
+
+        dl.destroy();
+        for (size_t i=0; i<VOICES; ++i)
+        {
+            delete delay[i];
+            delete out1[i];
+            delete out2[i];
+        }
+    }
+
+    void test_dynamic_delay()
+    {
+        printf("Testing compatibility with DynamicDelay...\n");
+
+        FloatBuffer in(SAMPLES);
+        FloatBuffer zero(SAMPLES);
+        FloatBuffer *delay[VOICES];
+        FloatBuffer *out1[VOICES];
+        FloatBuffer *out2[VOICES];
+
+        in.randomize_sign();
+        zero.fill_zero();
+
+        dspu::MultiDynamicDelay mdl;
+        UTEST_ASSERT(mdl.init(VOICES, MAX_DELAY) == STATUS_OK);
+
+        for (size_t i=0; i<VOICES; ++i)
+        {
+            delay[i]        = new FloatBuffer(SAMPLES);
+            out1[i]         = new FloatBuffer(SAMPLES);
+            out2[i]         = new FloatBuffer(SAMPLES);
+
+            float *d        = delay[i]->data();
+            for (size_t j=0; j<SAMPLES; ++j)
+                d[j]            = float((i * 700 + j / 3) % MAX_DELAY);
+
+            // Process each voice with standalone delay
+            dspu::DynamicDelay dl;
+            UTEST_ASSERT(dl.init(MAX_DELAY) == STATUS_OK);
+            dl.process(out1[i]->data(), in.data(), delay[i]->data(), zero.data(), zero.data(), SAMPLES);
+            dl.destroy();
+        }
+
+        process(mdl, out2, in, delay, NULL);
+
+        for (size_t i=0; i<VOICES; ++i)
+        {
+            UTEST_ASSERT_MSG(out1[i]->valid(), "Reference buffer %d corrupted", int(i));
+            UTEST_ASSERT_MSG(out2[i]->valid(), "Output buffer %d corrupted", int(i));
+            if (!out2[i]->equals_absolute(*out1[i], 1e-6))
+            {
+                size_t index = out2[i]->last_diff();
+                UTEST_FAIL_MSG("Output of voice %d differs at sample %d: %.6f vs %.6f",
+                    int(i), int(index), out1[i]->get(index), out2[i]->get(index));
+            }
+        }
+
+        mdl.destroy();
+        for (size_t i=0; i<VOICES; ++i)
+        {
+            delete delay[i];
+            delete out1[i];
+            delete out2[i];
+        }
+    }
+
+    UTEST_MAIN
+    {
+        test_dynamic_delay();
+
+        for (size_t i=dspu::DI_NONE; i<=dspu::DI_ALLPASS; ++i)
+        {
+            test_interpolation(dspu::delay_interp_t(i), false);
+            test_interpolation(dspu::delay_interp_t(i), true);
+        }
+    }
+
+UTEST_END;
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/MultiOversampler.h>
+#include <lsp-plug.in/dsp-units/util/Oversampler.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+using namespace lsp;
+
+#define SRATE       48000u
+#define BUF_SIZE    8192u
+#define BLOCK_SIZE  1027u
+#define CHANNELS    8u
+
+static void single_callback(float *out, const float *in, size_t samples, void *arg)
+{
+    dsp::mul_k3(out, in, 0.5f, samples);
+}
+
+static void multi_callback(float * const *out, const float * const *in, size_t channels, size_t samples, void *arg)
+{
+    for (size_t i=0; i<channels; ++i)
+        dsp::mul_k3(out[i], in[i], 0.5f, samples);
+}
+
+UTEST_BEGIN("dspu.util", multioversampler)
+
+    void test_mode(dspu::over_mode_t mode, dspu::over_filter_t type, size_t channels)
+    {
+        printf("Testing mode=%d, filter=%d, channels=%d...\n", int(mode), int(type), int(channels));
+
+        FloatBuffer *src[CHANNELS];
+        FloatBuffer *dst1[CHANNELS];
+        FloatBuffer *dst2[CHANNELS];
+        dspu::Oversampler os[CHANNELS];
+        dspu::MultiOversampler mos;
+
+        // Initialize oversamplers
+        UTEST_ASSERT(mos.init(channels));
+        UTEST_ASSERT(mos.channels() == channels);
+        mos.set_sample_rate(SRATE);
+        mos.set_mode(mode);
+        mos.set_filter_type(type);
+        mos.update_settings();
+
+        for (size_t i=0; i<channels; ++i)
+        {
+            src[i]      = new FloatBuffer(BUF_SIZE);
+            dst1[i]     = new FloatBuffer(BUF_SIZE);
+            dst2[i]     = new FloatBuffer(BUF_SIZE);
+            src[i]->randomize_sign();
+
+            UTEST_ASSERT(os[i].init());
+            os[i].set_sample_rate(SRATE);
+            os[i].set_mode(mode);
+            os[i].set_filter_type(type);
+            os[i].update_settings();
+        }
+
+        UTEST_ASSERT(mos.get_oversampling() == os[0].get_oversampling());
+        UTEST_ASSERT(mos.latency() == os[0].latency());
+
+        // Process data
+        float *vdst[CHANNELS];
+        const float *vsrc[CHANNELS];
+        for (size_t offset=0; offset < BUF_SIZE; )
+        {
+            size_t to_do    = lsp_min(BUF_SIZE - offset, BLOCK_SIZE);
+            for (size_t i=0; i<channels; ++i)
+            {
+                os[i].process(dst1[i]->data(offset), src[i]->data(offset), to_do, single_callback, NULL);
+                vsrc[i]         = src[i]->data(offset);
+                vdst[i]         = dst2[i]->data(offset);
+            }
+            mos.process(vdst, vsrc, to_do, multi_callback, NULL);
+
+            offset         += to_do;
+        }
+
+        // Check result
+        for (size_t i=0; i<channels; ++i)
+        {
+            UTEST_ASSERT_MSG(dst1[i]->valid(), "Destination buffer 1 corrupted");
+            UTEST_ASSERT_MSG(dst2[i]->valid(), "Destination buffer 2 corrupted");
+
+            if (!dst2[i]->equals_absolute(*dst1[i], 1e-5f))
+            {
+                size_t index = dst2[i]->last_diff();
+                UTEST_FAIL_MSG("Output of channel %d differs at sample=%d: %.6f vs %.6f",
+                        int(i), int(index), (*dst1[i])[index], (*dst2[i])[index]);
+            }
+
+            delete src[i];
+            delete dst1[i];
+            delete dst2[i];
+        }
+
+        for (size_t i=0; i<channels; ++i)
+            os[i].destroy();
+        mos.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        static const dspu::over_mode_t modes[] =
+        {
+            dspu::OM_NONE,
+            dspu::OM_LANCZOS_2X3,
+            dspu::OM_LANCZOS_3X16BIT,
+            dspu::OM_LANCZOS_4X2,
+            dspu::OM_LANCZOS_6X12BIT,
+            dspu::OM_LANCZOS_8X24BIT
+        };
+
+        static const dspu::over_filter_t types[] =
+        {
+            dspu::OF_IIR,
+            dspu::OF_FIR_LINEAR
+        };
+
+        for (size_t i=0; i<sizeof(modes)/sizeof(modes[0]); ++i)
+            for (size_t j=0; j<sizeof(types)/sizeof(types[0]); ++j)
+            {
+                test_mode(modes[i], types[j], 1);
+                test_mode(modes[i], types[j], 2);
+                test_mode(modes[i], types[j], 6);
+                test_mode(modes[i], types[j], CHANNELS);
+            }
+    }
+
+UTEST_END
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/MultiSidechain.h>
+#include <lsp-plug.in/dsp-units/util/Sidechain.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#define SRATE       48000u
+#define BUF_SIZE    (SRATE * 4)
+#define BLOCK_SIZE  511u
+#define LANES       6
+
+UTEST_BEGIN("dspu.util", multisidechain)
+
+    void test_mode(dspu::sidechain_mode_t mode)
+    {
+        printf("Testing mode=%d...\n", int(mode));
+
+        FloatBuffer *in[LANES];
+        FloatBuffer *out1[LANES];
+        FloatBuffer *out2[LANES];
+        dspu::Sidechain sc[LANES];
+        dspu::MultiSidechain msc;
+
+        UTEST_ASSERT(msc.init(LANES, 50.0f));
+        UTEST_ASSERT(msc.lanes() == LANES);
+        UTEST_ASSERT(msc.set_sample_rate(SRATE));
+        msc.set_mode(mode);
+        UTEST_ASSERT(msc.mode() == mode);
+
+        for (size_t i=0; i<LANES; ++i)
+        {
+            in[i]           = new FloatBuffer(BUF_SIZE);
+            out1[i]         = new FloatBuffer(BUF_SIZE);
+            out2[i]         = new FloatBuffer(BUF_SIZE);
+
+            // Make the signal level change significantly
+            in[i]->randomize_sign();
+            dsp::mul_k2(in[i]->data(BUF_SIZE/2), 100.0f, BUF_SIZE/2);
+
+            const float reactivity  = 5.0f + i * 7.0f;
+            const float gain        = 1.0f + i * 0.5f;
+
+            UTEST_ASSERT(sc[i].init(1, 50.0f));
+            sc[i].set_sample_rate(SRATE);
+            sc[i].set_mode(mode);
+            sc[i].set_reactivity(reactivity);
+            sc[i].set_gain(gain);
+
+            msc.set_reactivity(i, reactivity);
+            msc.set_gain(i, gain);
+            UTEST_ASSERT(msc.get_gain(i) == gain);
+        }
+
+        // Process data
+        const float *vin[LANES];
+        float *vout[LANES];
+        for (size_t offset=0; offset<BUF_SIZE; )
+        {
+            const size_t count  = lsp_min(BUF_SIZE - offset, BLOCK_SIZE);
+            for (size_t i=0; i<LANES; ++i)
+            {
+                const float *src    = in[i]->data(offset);
+                sc[i].process(out1[i]->data(offset), &src, count);
+
+                vin[i]              = src;
+                vout[i]             = out2[i]->data(offset);
+            }
+            msc.process(vout, vin, count);
+
+            offset             += count;
+        }
+
+        // Check results
+        for (size_t i=0; i<LANES; ++i)
+        {
+            UTEST_ASSERT_MSG(out1[i]->valid(), "Reference buffer %d corrupted", int(i));
+            UTEST_ASSERT_MSG(out2[i]->valid(), "Output buffer %d corrupted", int(i));
+            if (!out2[i]->equals_relative(*out1[i], 1e-3f))
+            {
+                size_t index = out2[i]->last_diff();
+                UTEST_FAIL_MSG("Output of lane %d differs at sample %d: %.6f vs %.6f",
+                    int(i), int(index), out1[i]->get(index), out2[i]->get(index));
+            }
+        }
+
+        msc.destroy();
+        for (size_t i=0; i<LANES; ++i)
+        {
+            sc[i].destroy();
+            delete in[i];
+            delete out1[i];
+            delete out2[i];
+        }
+    }
+
+    UTEST_MAIN
+    {
+        test_mode(dspu::SCM_PEAK);
+        test_mode(dspu::SCM_LPF);
+        test_mode(dspu::SCM_RMS);
+        test_mode(dspu::SCM_UNIFORM);
+    }
+
+UTEST_END
@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/MultiSpectralProcessor.h>
+#include <lsp-plug.in/common/atomic.h>
+#include <lsp-plug.in/ipc/Thread.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+using namespace lsp;
+
+#define MAX_RANK    12u
+#define RANK        10u
+#define BUF_SIZE    16384u
+#define CHANNELS    16u
+
+static void spectral_func(void *object, void *subject, float * const * spectrum, size_t rank)
+{
+    const size_t count = 2 << rank;
+    for (size_t i=0; i<CHANNELS; ++i)
+    {
+        if (spectrum[i] != NULL)
+            dsp::mul_k2(spectrum[i], 0.25f + i * 0.125f, count);
+    }
+}
+
+static void transform_func(void *object, float * const * buf, size_t count, size_t rank, bool inverse)
+{
+    size_t *calls = static_cast<size_t *>(object);
+    ++calls[(inverse) ? 1 : 0];
+
+    for (size_t i=0; i<count; ++i)
+    {
+        if (inverse)
+            dsp::packed_reverse_fft(buf[i], buf[i], rank);
+        else
+            dsp::packed_direct_fft(buf[i], buf[i], rank);
+    }
+}
+
+UTEST_BEGIN("dspu.util", multispectral_proc)
+
+    class Processor: public dspu::MultiSpectralProcessor
+    {
+        public:
+            bool claim(uatomic_t *job)          { return claim_job(job);                        }
+            void take(uatomic_t job)            { process_job(job);                             }
+            bool idle()                         { return atomic_load(&nJob) == JOB_NONE;        }
+
+        public:
+            // Simulate the worker which has claimed the channel in the direct pass and has been
+            // preempted until the caller thread submitted the channel to the reverse pass
+            bool take_stale_job()
+            {
+                channel_t *c                = &vChannels[0];
+                const size_t fft_size       = 2 << nRank;
+                for (size_t i=0; i<fft_size; ++i)
+                    c->pJobBuf[i]               = float(i);
+
+                atomic_store(&c->nState, CS_PENDING);
+                atomic_store(&nJob, make_job(JOB_REVERSE, nRank, 1));
+                process_job(make_job(JOB_DIRECT, nRank, 0));
+
+                // The channel should stay submitted to the reverse pass and its buffer should be untouched
+                bool valid                  = atomic_load(&c->nState) == CS_PENDING;
+                for (size_t i=0; (valid) && (i<fft_size); ++i)
+                    valid                       = c->pJobBuf[i] == float(i);
+
+                // The job of the current pass should be processed
+                process_job(make_job(JOB_REVERSE, nRank, 0));
+                valid                       = (valid) && (atomic_load(&c->nState) == CS_DONE);
+
+                atomic_store(&nJob, JOB_NONE);
+                atomic_store(&c->nState, CS_IDLE);
+
+                return valid;
+            }
+    };
+
+    // The worker which is always preempted after claiming the channel: it takes
+    // the claimed channel only when the caller thread has started the next pass
+    class PreemptedWorker: public ipc::Thread
+    {
+        private:
+            Processor      *pProc;
+
+        public:
+            size_t          nClaimed;
+
+        public:
+            explicit PreemptedWorker(Processor *proc)
+            {
+                pProc       = proc;
+                nClaimed    = 0;
+            }
+
+        public:
+            virtual status_t run() override
+            {
+                uatomic_t job;
+
+                while (!ipc::Thread::is_cancelled())
+                {
+                    if (!pProc->claim(&job))
+                    {
+                        ipc::Thread::yield();
+                        continue;
+                    }
+
+                    while ((!pProc->idle()) && (!ipc::Thread::is_cancelled()))
+                        ipc::Thread::yield();
+                    while ((pProc->idle()) && (!ipc::Thread::is_cancelled()))
+                        ipc::Thread::yield();
+                    if (ipc::Thread::is_cancelled())
+                        break;
+
+                    pProc->take(job);
+                    ++nClaimed;
+                }
+
+                return STATUS_OK;
+            }
+    };
+
+    void process(FloatBuffer **dst, FloatBuffer **src, size_t workers, bool batch, bool preempted)
+    {
+        Processor sp;
+        size_t calls[2] = { 0, 0 };
+
+        UTEST_ASSERT(sp.init(CHANNELS, MAX_RANK, workers));
+        UTEST_ASSERT(sp.workers() <= workers);
+        sp.set_rank(RANK);
+        sp.set_phase(0.5f);
+        sp.bind_handler(spectral_func, NULL, NULL);
+        if (batch)
+            sp.bind_transform(transform_func, calls);
+
+        // Channel 3 has no input, channel 5 has no output
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            UTEST_ASSERT(sp.bind(i,
+                (i != 5) ? dst[i]->data() : NULL,
+                (i != 3) ? src[i]->data() : NULL) == STATUS_OK);
+        }
+
+        PreemptedWorker *pw = NULL;
+        if (preempted)
+        {
+            pw                  = new PreemptedWorker(&sp);
+            UTEST_ASSERT(pw != NULL);
+            UTEST_ASSERT(pw->start() == STATUS_OK);
+        }
+
+        // Process data using blocks of different size
+        for (size_t offset=0; offset < BUF_SIZE; )
+        {
+            size_t to_do    = lsp_min(BUF_SIZE - offset, size_t(113 + offset % 1031));
+            sp.process(to_do);
+            offset         += to_do;
+        }
+
+        if (pw != NULL)
+        {
+            pw->cancel();
+            pw->join();
+            printf("  preempted worker has taken %d claimed channels\n", int(pw->nClaimed));
+            delete pw;
+        }
+
+        if (batch)
+        {
+            UTEST_ASSERT(calls[0] > 0);
+            UTEST_ASSERT(calls[0] == calls[1]);
+        }
+
+        sp.destroy();
+    }
+
+    void test_parallel(size_t workers, bool batch, bool preempted)
+    {
+        printf("Testing workers=%d, batch=%s, preempted=%s...\n",
+            int(workers), (batch) ? "true" : "false", (preempted) ? "true" : "false");
+
+        FloatBuffer *src[CHANNELS];
+        FloatBuffer *dst1[CHANNELS];
+        FloatBuffer *dst2[CHANNELS];
+
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            src[i]      = new FloatBuffer(BUF_SIZE);
+            dst1[i]     = new FloatBuffer(BUF_SIZE);
+            dst2[i]     = new FloatBuffer(BUF_SIZE);
+            src[i]->randomize_sign();
+            dst1[i]->fill_zero();
+            dst2[i]->fill_zero();
+        }
+
+        // Process data by the caller thread and by the worker threads
+        process(dst1, src, 0, false, false);
+        process(dst2, src, workers, batch, preempted);
+
+        // Compare results
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            UTEST_ASSERT(dst1[i]->valid());
+            UTEST_ASSERT(dst2[i]->valid());
+
+            if (!dst1[i]->equals_absolute(*dst2[i], 1e-6f))
+            {
+                dst1[i]->dump("dst1");
+                dst2[i]->dump("dst2");
+                UTEST_FAIL_MSG("Output of channel %d differs at sample %d", int(i), int(dst1[i]->last_diff()));
+            }
+        }
+
+        for (size_t i=0; i<CHANNELS; ++i)
+        {
+            delete src[i];
+            delete dst1[i];
+            delete dst2[i];
+        }
+    }
+
+    void test_stale_job()
+    {
+        printf("Testing the job claimed in the previous pass...\n");
+
+        // The worker threads sleep until the job is submitted by the process() call
+        Processor sp;
+        UTEST_ASSERT(sp.init(CHANNELS, MAX_RANK, 1));
+        UTEST_ASSERT(sp.workers() == 1);
+        sp.set_rank(RANK);
+        UTEST_ASSERT(sp.take_stale_job());
+
+        sp.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        test_stale_job();
+        test_parallel(3, false, false);
+        test_parallel(0, true, false);
+        test_parallel(2, true, false);
+        test_parallel(1, false, true);
+    }
+UTEST_END;
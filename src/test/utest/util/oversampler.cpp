@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 15 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/dsp/dsp.h>
+#include <lsp-plug.in/dsp-units/util/Oversampler.h>
+#include <lsp-plug.in/stdlib/math.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/test-fw/utest.h>
+
+#define SRATE       48000u
+#define BUF_SIZE    8192u
+#define BLOCK_SIZE  1027u
+#define SKIP        256u
+#define RESP_STEPS  100u        /* Number of frequency steps per sample rate */
+#define RESP_SKIP   64u         /* Number of samples to skip before measuring response */
+#define RESP_SIZE   2000u       /* Number of samples to measure response, integer number of periods for each frequency */
+#define RESP_PASS   0.42f       /* Upper frequency of the pass band relative to the sample rate */
+#define RESP_STOP   0.58f       /* Lower frequency of the stop band relative to the sample rate */
+
+UTEST_BEGIN("dspu.util", oversampler)
+
+    void test_fir(dspu::over_mode_t mode)
+    {
+        printf("Testing polyphase FIR filter for mode=%d...\n", int(mode));
+
+        FloatBuffer src(BUF_SIZE);
+        FloatBuffer dst(BUF_SIZE);
+        dspu::Oversampler os;
+
+        // Generate 1 kHz sine wave
+        const float kf  = 2.0f * M_PI * 1000.0f / SRATE;
+        for (size_t i=0; i<BUF_SIZE; ++i)
+            src[i]          = 0.5f * sinf(kf * i);
+
+        UTEST_ASSERT(os.init());
+        os.set_sample_rate(SRATE);
+        os.set_mode(mode);
+        os.set_filter_type(dspu::OF_FIR_LINEAR);
+        UTEST_ASSERT(os.filter_type() == dspu::OF_FIR_LINEAR);
+        os.update_settings();
+
+        const size_t latency = os.latency();
+        UTEST_ASSERT(latency <= os.max_latency());
+
+        for (size_t offset=0; offset < BUF_SIZE; )
+        {
+            size_t to_do    = lsp_min(BUF_SIZE - offset, BLOCK_SIZE);
+            os.process(dst.data(offset), src.data(offset), to_do);
+            offset         += to_do;
+        }
+
+        // The linear-phase filter should pass the signal with the reported latency
+        UTEST_ASSERT(dst.valid());
+        for (size_t i=SKIP; i<BUF_SIZE; ++i)
+        {
+            const float a = src.get(i - latency);
+            const float b = dst.get(i);
+            if (fabsf(a - b) > 1e-2f)
+                UTEST_FAIL_MSG("Output differs at sample=%d: %.6f vs %.6f", int(i), a, b);
+        }
+
+        os.destroy();
+    }
+
+    void test_fir_response(dspu::over_mode_t mode)
+    {
+        printf("Testing frequency response of polyphase FIR filter for mode=%d...\n", int(mode));
+
+        dspu::Oversampler os;
+        UTEST_ASSERT(os.init());
+        os.set_sample_rate(SRATE);
+        os.set_mode(mode);
+        os.set_filter_type(dspu::OF_FIR_LINEAR);
+        os.update_settings();
+
+        const size_t ratio  = os.get_oversampling();
+        const size_t length = RESP_SKIP + RESP_SIZE;
+        FloatBuffer src(length * ratio);
+        FloatBuffer dst(length);
+
+        float pass_dev  = 0.0f;
+        float stop_max  = -1000.0f;
+
+        // Feed sine waves of different frequencies up to the Nyquist frequency of the oversampled signal
+        for (size_t k=1; k < RESP_STEPS * ratio / 2; ++k)
+        {
+            // Skip frequencies which are folded to DC and Nyquist frequency
+            if ((k % (RESP_STEPS / 2)) == 0)
+                continue;
+            const float f   = float(k) / RESP_STEPS;
+            if ((f > RESP_PASS) && (f < RESP_STOP))
+                continue;
+
+            const double kf = 2.0 * M_PI * k / (RESP_STEPS * ratio);
+            for (size_t i=0; i<length * ratio; ++i)
+                src[i]          = sin(kf * i);
+            os.downsample(dst.data(), src.data(), length);
+            UTEST_ASSERT(dst.valid());
+
+            // The measured interval contains integer number of periods of the output signal
+            double e        = 0.0;
+            for (size_t i=RESP_SKIP; i<length; ++i)
+                e              += double(dst[i]) * dst[i];
+            const float db  = 10.0f * log10f(2.0 * e / RESP_SIZE + 1e-20);
+
+            if (f <= RESP_PASS)
+                pass_dev        = lsp_max(pass_dev, fabsf(db));
+            else
+                stop_max        = lsp_max(stop_max, db);
+        }
+
+        printf("  pass band deviation: %.4f dB, stop band level: %.2f dB\n", pass_dev, stop_max);
+        UTEST_ASSERT_MSG(pass_dev <= 0.002f, "Pass band deviation %.4f dB is too high", pass_dev);
+        UTEST_ASSERT_MSG(stop_max <= -80.0f, "Stop band attenuation %.2f dB is too low", -stop_max);
+
+        os.destroy();
+    }
+
+    UTEST_MAIN
+    {
+        test_fir(dspu::OM_LANCZOS_2X3);
+        test_fir(dspu::OM_LANCZOS_3X4);
+        test_fir(dspu::OM_LANCZOS_4X16BIT);
+        test_fir(dspu::OM_LANCZOS_6X12BIT);
+        test_fir(dspu::OM_LANCZOS_8X24BIT);
+
+        test_fir_response(dspu::OM_LANCZOS_2X3);
+        test_fir_response(dspu::OM_LANCZOS_3X3);
+        test_fir_response(dspu::OM_LANCZOS_4X3);
+        test_fir_response(dspu::OM_LANCZOS_6X3);
+        test_fir_response(dspu::OM_LANCZOS_8X3);
+    }
+
+UTEST_END
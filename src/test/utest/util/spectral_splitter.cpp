@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026 Linux Studio Plugins Project <https://lsp-plug.in/>
+ *           (C) 2026 Vladimir Sadovnikov <sadko4u@gmail.com>
+ *
+ * This file is part of lsp-dsp-units
+ * Created on: 16 окт. 2026 г.
+ *
+ * lsp-dsp-units is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * lsp-dsp-units is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with lsp-dsp-units. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <lsp-plug.in/test-fw/utest.h>
+#include <lsp-plug.in/test-fw/helpers.h>
+#include <lsp-plug.in/test-fw/FloatBuffer.h>
+#include <lsp-plug.in/dsp-units/util/SpectralSplitter.h>
+#include <lsp-plug.in/dsp/dsp.h>
+
+using namespace lsp;
+
+#define MAX_RANK        13
+#define RANK            12
+#define SAMPLES         16384
+#define HANDLERS        4
+
+namespace
+{
+    typedef struct band_t
+    {
+        size_t      nFirst;     // First non-zero bin of the positive half
+        size_t      nLast;      // Last non-zero bin of the positive half
+        size_t      nNegFirst;  // First non-zero mirrored bin of the negative half
+        size_t      nNegLast;   // Last non-zero mirrored bin of the negative half
+        float      *vOut;       // Output buffer
+    } band_t;
+
+    void band_func(void *object, void *subject, float *out, const float *in, size_t rank)
+    {
+        const band_t *b     = static_cast<band_t *>(subject);
+        const size_t size   = 1 << rank;
+        const size_t half   = size >> 1;
+
+        dsp::fill_zero(out, size * 2);
+        for (size_t k=b->nFirst; k<=b->nLast; ++k)
+        {
+            out[k*2]        = in[k*2] * 0.5f;
+            out[k*2 + 1]    = in[k*2 + 1] * 0.5f;
+        }
+        for (size_t k=b->nNegFirst; k<=b->nNegLast; ++k)
+        {
+            if ((k <= 0) || (k >= half))
+                continue;
+            const size_t j  = size - k;
+            out[j*2]        = in[j*2];
+            out[j*2 + 1]    = -in[j*2 + 1];
+        }
+    }
+
+    void band_sink(void *object, void *subject, const float *samples, size_t first, size_t count)
+    {
+        const band_t *b     = static_cast<band_t *>(subject);
+        dsp::copy(&b->vOut[first], samples, count);
+    }
+}
+
+UTEST_BEGIN("dspu.util", spectral_splitter)
+
+    void process(FloatBuffer **out, FloatBuffer &in, const band_t *bands, bool pruning, ssize_t chunk_rank)
+    {
+        dspu::SpectralSplitter ss;
+        band_t vb[HANDLERS];
+
+        UTEST_ASSERT(ss.init(MAX_RANK, HANDLERS) == STATUS_OK);
+        ss.set_rank(RANK);
+        ss.set_chunk_rank(chunk_rank);
+        ss.set_phase(0.5f);
+        ss.set_pruning(pruning);
+        UTEST_ASSERT(ss.pruning() == pruning);
+
+        for (size_t i=0; i<HANDLERS; ++i)
+        {
+            vb[i]           = bands[i];
+            vb[i].vOut      = out[i]->data();
+            UTEST_ASSERT(ss.bind(i, NULL, &vb[i], band_func, band_sink) == STATUS_OK);
+        }
+
+        // Process the data using blocks of different size
+        const float *src    = in.data();
+        for (size_t offset=0; offset < SAMPLES; )
+        {
+            size_t to_do    = lsp_min(SAMPLES - offset, size_t(77 + offset % 311));
+            ss.process(&src[offset], to_do);
+            for (size_t i=0; i<HANDLERS; ++i)
+                vb[i].vOut     += to_do;
+            offset         += to_do;
+        }
+
+        ss.destroy();
+    }
+
+    void test_pruning(ssize_t chunk_rank)
+    {
+        static const band_t bands[HANDLERS] =
+        {
+            {   0,  20,     1,  20,     NULL    },  // Low band with DC
+            {  37,  90,    40, 101,     NULL    },  // Narrow band, asymmetric spectrum
+            { 100, 2048,  100, 2047,    NULL    },  // Wide band, full FFT fallback
+            {   1,   0,     1,   0,     NULL    },  // Empty spectrum
+        };
+
+        printf("Testing pruned reverse FFT for chunk rank=%d\n", int(chunk_rank));
+
+        FloatBuffer in(SAMPLES);
+        FloatBuffer *ref[HANDLERS], *out[HANDLERS];
+        in.randomize(-1.0f, 1.0f);
+
+        for (size_t i=0; i<HANDLERS; ++i)
+        {
+            ref[i]      = new FloatBuffer(SAMPLES);
+            out[i]      = new FloatBuffer(SAMPLES);
+            ref[i]->fill_zero();
+            out[i]->fill_zero();
+        }
+
+        process(ref, in, bands, false, chunk_rank);
+        process(out, in, bands, true, chunk_rank);
+
+        for (size_t i=0; i<HANDLERS; ++i)
+        {
+            UTEST_ASSERT(ref[i]->valid());
+            UTEST_ASSERT(out[i]->valid());
+            if (!out[i]->equals_absolute(*ref[i], 1e-4f))
+            {
+                ref[i]->dump("ref");
+                out[i]->dump("out");
+                UTEST_FAIL_MSG("Output of handler %d differs at sample %d: %f vs %f",
+                    int(i), int(out[i]->last_diff()),
+                    (*ref[i])[out[i]->last_diff()], (*out[i])[out[i]->last_diff()]);
+            }
+        }
+
+        for (size_t i=0; i<HANDLERS; ++i)
+        {
+            delete ref[i];
+            delete out[i];
+        }
+    }
+
+    UTEST_MAIN
+    {
+        test_pruning(-1);
+        test_pruning(9);
+    }
+UTEST_END;